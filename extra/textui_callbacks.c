@@ -374,7 +374,43 @@ update_patches(const char *key, const char *value)
         return;
     }
 
-    patch_section_dirty[section] = 0;
+    gui_data_clear_patch_section(section);
+
+    /* patch names may have changed, so if the UI is displaying a patch list,
+     * it should be updated now. */
+}
+
+void
+update_patches_blob(const char *key, const uint8_t *data, int size)
+{
+    int section = key[7] - '0';
+
+    TUIDB_MESSAGE(DB_OSC, ": update_patches_blob: received new '%s'\n", key);
+
+    if (section < 0 || section > 3)
+        return;
+
+    if (!gui_data_blob_value(data, size, 32 * sizeof(dx7_patch_t),
+                             (uint8_t *)&patches[section * 32])) {
+        TUIDB_MESSAGE(DB_OSC, " update_patches_blob: wrong size!\n");
+        return;
+    }
+
+    gui_data_clear_patch_section(section);
+
+    /* patch names may have changed, so if the UI is displaying a patch list,
+     * it should be updated now. */
+}
+
+void
+update_patch_delta(const char *value)
+{
+    TUIDB_MESSAGE(DB_OSC, ": update_patch_delta called\n");
+
+    if (gui_data_apply_patch_delta(value) < 0) {
+        TUIDB_MESSAGE(DB_OSC, " update_patch_delta: corrupt data!\n");
+        return;
+    }
 
     /* patch names may have changed, so if the UI is displaying a patch list,
      * it should be updated now. */
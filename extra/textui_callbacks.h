@@ -22,6 +22,8 @@ void readline_callback(char *line);
 int  test_note_callback(int a, int b);
 void update_from_program_select(unsigned long bank, unsigned long program);
 void update_patches(const char *key, const char *value);
+void update_patches_blob(const char *key, const uint8_t *data, int size);
+void update_patch_delta(const char *value);
 void update_monophonic(const char *value);
 void update_polyphony(const char *value);
 void update_global_polyphony(const char *value);
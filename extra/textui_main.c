@@ -157,6 +157,10 @@ osc_configure_handler(const char *path, const char *types, lo_arg **argv,
 
         update_patches(key, value);
 
+    } else if (!strcmp(key, "patch_delta")) {
+
+        update_patch_delta(value);
+
     } else if (!strcmp(key, "edit_buffer")) {
 
         /* -FIX- update_edit_buffer(value); */
@@ -192,6 +196,42 @@ osc_configure_handler(const char *path, const char *types, lo_arg **argv,
     return 0;
 }
 
+int
+osc_configure_blob_handler(const char *path, const char *types, lo_arg **argv,
+                           int argc, lo_message msg, void *user_data)
+{
+    char *key;
+    lo_blob blob;
+    const uint8_t *data;
+    int size;
+
+    if (argc < 2) {
+        TUIDB_MESSAGE(DB_OSC, " error: too few arguments to osc_configure_blob_handler\n");
+        return 1;
+    }
+
+    key  = &argv[0]->s;
+    blob = (lo_blob)argv[1];
+    data = (const uint8_t *)lo_blob_dataptr(blob);
+    size = lo_blob_datasize(blob);
+
+    /* a host that sends us blobs will take them from us too */
+    gui_data_enable_blob_configure();
+
+    if (strlen(key) == 8 && !strncmp(key, "patches", 7) &&
+        key[7] >= '0' && key[7] <= '3') {
+
+        update_patches_blob(key, data, size);
+
+    } else {
+
+        return osc_debug_handler(path, types, argv, argc, msg, user_data);
+
+    }
+
+    return 0;
+}
+
 int
 osc_control_handler(const char *path, const char *types, lo_arg **argv,
                   int argc, lo_message msg, void *user_data)
@@ -286,6 +326,7 @@ main(int argc, char *argv[])
 
     osc_server = lo_server_new(NULL, osc_error);
     lo_server_add_method(osc_server, osc_configure_path, "ss", osc_configure_handler, NULL);
+    lo_server_add_method(osc_server, osc_configure_path, "sb", osc_configure_blob_handler, NULL);
     lo_server_add_method(osc_server, osc_control_path, "if", osc_control_handler, NULL);
     lo_server_add_method(osc_server, osc_hide_path, "", osc_action_handler, "hide");
     lo_server_add_method(osc_server, osc_program_path, "ii", osc_program_handler, NULL);
@@ -0,0 +1,604 @@
+/* hexter accuracy regression harness
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Renders a fixed corpus -- every patch of each bank file given, times
+ * several keys, velocities and modulation scenarios -- through the
+ * reference fixed-point engine and through each candidate engine in the
+ * table below, and compares the results.  For each patch and candidate it
+ * reports the worst case maximum absolute error, signal-to-error ratio,
+ * log-spectral distance, and difference in RMS level, and marks the patch
+ * as failing if any exceeds the candidate's tolerance, or the patch's own
+ * from the exception list below (the -e, -s, -d and -l options override
+ * the tolerances for all candidates and patches).  A candidate that
+ * renders some voices from steady-state wavetables also fails if none
+ * ever was.  The exit status is non-zero if anything failed.
+ *
+ * usage: accuracy [-v] [-e <max abs error>] [-s <min SNR dB>]
+ *                 [-d <max spectral distance dB>] [-l <max level difference dB>]
+ *                 <bank file> ...
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include <ladspa.h>
+#include <dssi.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "dx7_voice.h"
+
+#define SAMPLE_RATE    44100
+#define HOLD_FRAMES       (SAMPLE_RATE / 2)
+#define LONG_HOLD_FRAMES  (SAMPLE_RATE * 3 / 2)
+#define RELEASE_FRAMES    (SAMPLE_RATE / 4)
+#define MAX_RENDER_FRAMES (LONG_HOLD_FRAMES + RELEASE_FRAMES)
+
+#define FFT_SHIFT      11
+#define FFT_SIZE       (1 << FFT_SHIFT)
+#define FFT_HOP        (FFT_SIZE / 2)
+#define SPECTRAL_RANGE 60.0    /* dB below the frame's reference peak that count */
+
+/* in hexter.c and dx7_voice_data.c: */
+const DSSI_Descriptor *dssi_descriptor_fix(unsigned long index);
+const DSSI_Descriptor *dssi_descriptor_float(unsigned long index);
+int  dx7_patchbank_load_fix(const char *filename, dx7_patch_t *firstpatch,
+                            int maxpatches, char **errmsg);
+void dx7_voice_copy_name_fix(char *name, dx7_patch_t *patch);
+void hexter_instance_get_stats_fix(hexter_instance_t *instance, hexter_stats_t *stats);
+
+/* Candidate engines.  Each is a build of the engine plus an optional
+ * configure() key/value selecting an alternate rendering path, and the
+ * tolerances it must meet against the reference.  The level tolerance
+ * bounds each render's RMS level against the reference render's in
+ * either direction, so a silent candidate, whose error is just the
+ * reference and scores 0 dB SNR, fails it outright. */
+typedef struct {
+    const char             *name;
+    const DSSI_Descriptor *(*descriptor)(unsigned long index);
+    const char             *key;
+    const char             *value;
+    double                  max_abs;   /* maximum absolute error */
+    double                  snr;       /* minimum signal-to-error ratio, dB */
+    double                  spectral;  /* maximum RMS log-spectral distance, dB */
+    double                  level;     /* maximum difference in RMS level, dB */
+    int                     wavetables;        /* true if it must play some of the corpus from wavetables, */
+    unsigned long           wavetable_nuggets; /*   and the voice nuggets it did over the run */
+} candidate_t;
+
+static candidate_t reference = { "fix", dssi_descriptor_fix, NULL, NULL };
+
+static candidate_t candidates[] = {
+    /* The floating-point build differs in phase accumulation and rounding.
+     * Most patches stay well correlated with the reference; the exceptions
+     * are listed below.  Worst measured otherwise: 0.52 (BeatMeHrdr),
+     * 3.8 dB (FB:SnareD2, FB:Space 1), 13.4 dB (FB:Helicop); level
+     * -2.7 dB (FB:Hand Dr). */
+    { "float", dssi_descriptor_float, NULL, NULL,   0.6, 3.0, 18.0, 3.5 },
+    /* The quality tiers of the fixed-point build.  Eco's nearest-entry sine
+     * lookups and envelopes stepped every few samples add a noise floor,
+     * which feedback amplifies as it does the float build's.  Worst
+     * measured: 0.52 (KARIMBA B), 3.1 dB (WASP STING), 7.6 dB (FB:Wave),
+     * level -0.4 dB (FB:Pizzic1). */
+    { "eco",   dssi_descriptor_fix,   "quality", "eco",  0.6, 3.0, 10.0, 1.0 },
+    /* High, which interpolates where the reference does not, comes within
+     * about 48 dB of it without pitch modulation; under vibrato or bend
+     * its pitch glides bring each operator's phase back to the reference's
+     * at every control update, but the sidebands of deep modulation stay
+     * apart in between.  Worst measured: 0.52 (KARIMBA A), 3.7 dB and
+     * 13.7 dB (FB:Helicop), level -0.5 dB (SYNBRASS 1). */
+    { "high",  dssi_descriptor_fix,   "quality", "high", 0.6, 3.0, 16.0, 1.0 },
+    /* Level of detail: voices below -30 dB, such as release tails and soft
+     * notes, at eco quality, and those below -50 dB whose modulators have
+     * died away with carriers alone.  Voices above the thresholds render
+     * exactly as the reference's, so the error is bounded by twice the
+     * level a voice can reach before it regains detail, -27 dB with the
+     * hysteresis, or 0.09.  Worst measured: 0.064 (FB:Wave), 11.9 dB
+     * (FB:Fuzz Gt), 6.1 dB (FB:SynTimp), all in noisy feedback tails, and
+     * level 0.05 dB (FB:Clock). */
+    { "lod",   dssi_descriptor_fix,   "lod",     "-30 -50", 0.09, 10.0, 8.0, 0.25 },
+    /* Steady-state wavetables.  Only the long hold gives envelopes time
+     * to sustain, and then only a few patches (PIPES, SYN-LEADs, organs)
+     * are steady enough to be captured; every other render matches
+     * the reference exactly.  Worst measured, the interpolated table's
+     * error: 0.0064, 31.0 dB and 0.40 dB (PIPES B), level 0.01 dB. */
+    { "wavetable", dssi_descriptor_fix, "wavetable", "on", 0.01, 28.0, 0.5, 0.1, 1 },
+};
+#define CANDIDATE_COUNT  (sizeof(candidates) / sizeof(candidate_t))
+
+/* Patches whose renders by a candidate are expected to decorrelate from
+ * the reference's, and the SNR floor they get instead of the candidate's.
+ * Small differences in phase or rounding grow, through high operator
+ * feedback, into noise that sounds alike but does not cancel; or, in the
+ * float build's slowly drifting phases, into the same spectrum shifted in
+ * time (the bells, EVOLUTION, SYN-LEAD 5).  Two uncorrelated signals of
+ * equal power are -3 dB apart, so SNR says little here, but the spectral
+ * distance and RMS level must still be within the candidate's tolerance,
+ * which is what catches silence or a wrong pitch.  Names are matched
+ * without their trailing blanks, in every bank. */
+typedef struct {
+    const char *patch;
+    const char *candidate;
+    double      snr;       /* minimum signal-to-error ratio, dB */
+} exception_t;
+
+static exception_t exceptions[] = {
+    { "BELL VOICE", "float",  0.0 },
+    { "CELESTA",    "float", -2.0 },
+    { "EVOLUTION",  "float", -2.0 },
+    { "FB:Smash",   "float", -1.5 },
+    { "FB:Smash",   "high",  -3.0 },
+    { "FB:SnareD3", "float",  0.5 },
+    { "FB:SnareD3", "eco",    1.0 },
+    { "FB:SnareD3", "high",   0.0 },
+    { "FB:Strings", "float",  0.5 },
+    { "FB:SynTimp", "float",  1.0 },
+    { "FB:SynTimp", "eco",    1.0 },
+    { "FB:SynTimp", "high",   1.5 },
+    { "FB:Wave",    "float", -4.0 },
+    { "FB:Wave",    "eco",   -2.5 },
+    { "FB:Wave",    "high",  -4.0 },
+    { "FB:Winds",   "float",  1.0 },
+    { "FB:Winds",   "eco",    1.5 },
+    { "FB:Winds",   "high",   1.5 },
+    { "LASER GUN",  "float", -1.0 },
+    { "ST.HELENS",  "float", -1.5 },
+    { "ST.HELENS",  "eco",    0.0 },
+    { "ST.HELENS",  "high",  -1.5 },
+    { "SYN-LEAD 5", "float", -1.5 },
+    { "TAKE OFF",   "float", -4.0 },
+    { "WASP STING", "float", -3.5 },
+    { "WASP STING", "high",   1.5 },
+};
+#define EXCEPTION_COUNT  (sizeof(exceptions) / sizeof(exception_t))
+
+static const unsigned char test_keys[] = { 36, 60, 84 };
+static const unsigned char test_velocities[] = { 40, 100, 127 };
+
+enum scenario {
+    SCENARIO_PLAIN,
+    SCENARIO_MODWHEEL,   /* mod wheel full on */
+    SCENARIO_PRESSURE,   /* channel pressure full on */
+    SCENARIO_BEND,       /* pitch bend sweep up during the hold */
+    SCENARIO_LONG_HOLD,  /* plain, held until most patches' envelopes sustain */
+    SCENARIO_COUNT
+};
+static const char *scenario_names[SCENARIO_COUNT] = {
+    "plain", "modwheel", "pressure", "bend", "long hold"
+};
+
+static unsigned long
+hold_frames(int scenario)
+{
+    return scenario == SCENARIO_LONG_HOLD ? LONG_HOLD_FRAMES : HOLD_FRAMES;
+}
+
+static float tuning = 440.0f, volume = 0.0f;
+
+/* per-render comparison results */
+typedef struct {
+    double max_abs;
+    double signal;      /* reference energy */
+    double error;       /* error energy */
+    double level;       /* candidate RMS level relative to the reference's, dB */
+    double spectral;    /* RMS log-spectral distance, dB */
+} compare_t;
+
+static LADSPA_Handle
+setup(candidate_t *c, const char *bankfile)
+{
+    const DSSI_Descriptor *d = c->descriptor(0);
+    LADSPA_Handle handle;
+
+    /* the bank is loaded at instantiation by the plugin's own loader */
+    setenv("HEXTER_DEFAULT_BANK_PATH", bankfile, 1);
+    setenv("HEXTER_DEFAULT_BANK_SYNC", "1", 1);
+    handle = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, SAMPLE_RATE);
+    if (!handle) {
+        fprintf(stderr, "accuracy: instantiate() failed for %s\n", c->name);
+        exit(1);
+    }
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_TUNING, &tuning);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_VOLUME, &volume);
+    d->LADSPA_Plugin->activate(handle);
+    if (c->key) {
+        char *err = d->configure(handle, c->key, c->value);
+
+        if (err) {
+            fprintf(stderr, "accuracy: configure('%s', '%s') failed for %s: %s\n",
+                    c->key, c->value, c->name, err);
+            exit(1);
+        }
+    }
+    return handle;
+}
+
+/* Each render gets a fresh instance, so that nothing (e.g. the phases of
+ * operators without key sync) carries over from the previous render.
+ * Returns the number of frames rendered. */
+static unsigned long
+render(candidate_t *c, const char *bankfile, int slot, unsigned char key,
+       unsigned char velocity, int scenario, float *buffer)
+{
+    const DSSI_Descriptor *d = c->descriptor(0);
+    LADSPA_Handle handle = setup(c, bankfile);
+    snd_seq_event_t events[3];
+    unsigned long n, hold = hold_frames(scenario),
+                  frames = hold + RELEASE_FRAMES;
+    int e;
+
+    d->select_program(handle, 0, slot);
+
+    for (n = 0; n < frames; n += HEXTER_NUGGET_SIZE) {
+        unsigned long count = frames - n;
+
+        if (count > HEXTER_NUGGET_SIZE)
+            count = HEXTER_NUGGET_SIZE;
+        memset(events, 0, sizeof(events));
+        e = 0;
+        if (n == 0) {
+            events[e].type = SND_SEQ_EVENT_CONTROLLER;
+            events[e].data.control.param = 121;  /* reset controllers */
+            e++;
+            if (scenario == SCENARIO_MODWHEEL) {
+                events[e].type = SND_SEQ_EVENT_CONTROLLER;
+                events[e].data.control.param = 1;
+                events[e].data.control.value = 127;
+                e++;
+            } else if (scenario == SCENARIO_PRESSURE) {
+                events[e].type = SND_SEQ_EVENT_CHANPRESS;
+                events[e].data.control.value = 127;
+                e++;
+            }
+            events[e].type = SND_SEQ_EVENT_NOTEON;
+            events[e].data.note.note = key;
+            events[e].data.note.velocity = velocity;
+            e++;
+        } else if (n == hold / HEXTER_NUGGET_SIZE * HEXTER_NUGGET_SIZE) {
+            events[e].type = SND_SEQ_EVENT_NOTEOFF;
+            events[e].data.note.note = key;
+            events[e].data.note.velocity = 64;
+            e++;
+        } else if (scenario == SCENARIO_BEND && n < HOLD_FRAMES) {
+            events[e].type = SND_SEQ_EVENT_PITCHBEND;
+            events[e].data.control.value = 8191 * n / HOLD_FRAMES;
+            e++;
+        }
+        d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_OUTPUT, buffer + n);
+        d->run_synth(handle, count, events, e);
+    }
+
+    if (c->wavetables) {
+        hexter_stats_t stats;
+
+        hexter_instance_get_stats_fix((hexter_instance_t *)handle, &stats);
+        c->wavetable_nuggets += stats.wavetable;
+    }
+    d->LADSPA_Plugin->cleanup(handle);
+    return frames;
+}
+
+static double window[FFT_SIZE], twiddle_re[FFT_SIZE / 2], twiddle_im[FFT_SIZE / 2];
+
+static void
+fft_init(void)
+{
+    int i;
+
+    for (i = 0; i < FFT_SIZE; i++)
+        window[i] = 0.5 - 0.5 * cos(2.0 * M_PI * i / (FFT_SIZE - 1));
+    for (i = 0; i < FFT_SIZE / 2; i++) {
+        twiddle_re[i] = cos(-2.0 * M_PI * i / FFT_SIZE);
+        twiddle_im[i] = sin(-2.0 * M_PI * i / FFT_SIZE);
+    }
+}
+
+/* in-place radix-2 complex FFT */
+static void
+fft(double *re, double *im)
+{
+    int i, j, k, m, step;
+
+    for (i = 1, j = 0; i < FFT_SIZE; i++) {
+        int bit = FFT_SIZE >> 1;
+
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j) {
+            double t;
+            t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+    for (step = 2; step <= FFT_SIZE; step <<= 1) {
+        m = step >> 1;
+        for (k = 0; k < m; k++) {
+            double wr = twiddle_re[k * (FFT_SIZE / step)],
+                   wi = twiddle_im[k * (FFT_SIZE / step)];
+
+            for (i = k; i < FFT_SIZE; i += step) {
+                double tr = wr * re[i + m] - wi * im[i + m],
+                       ti = wr * im[i + m] + wi * re[i + m];
+
+                re[i + m] = re[i] - tr;
+                im[i + m] = im[i] - ti;
+                re[i] += tr;
+                im[i] += ti;
+            }
+        }
+    }
+}
+
+static void
+power_spectrum_db(const float *x, double *db)
+{
+    static double re[FFT_SIZE], im[FFT_SIZE];
+    int i;
+
+    for (i = 0; i < FFT_SIZE; i++) {
+        re[i] = x[i] * window[i];
+        im[i] = 0.0;
+    }
+    fft(re, im);
+    for (i = 0; i <= FFT_SIZE / 2; i++)
+        db[i] = 10.0 * log10(re[i] * re[i] + im[i] * im[i] + 1e-30);
+}
+
+static void
+compare(const float *ref, const float *cand, unsigned long frames, compare_t *r)
+{
+    static double ref_db[FFT_SIZE / 2 + 1], cand_db[FFT_SIZE / 2 + 1];
+    double sum = 0.0, energy = 0.0;
+    unsigned long n, bins = 0;
+    int i;
+
+    r->max_abs = r->signal = r->error = 0.0;
+    for (n = 0; n < frames; n++) {
+        double e = (double)cand[n] - (double)ref[n];
+
+        if (fabs(e) > r->max_abs)
+            r->max_abs = fabs(e);
+        r->signal += (double)ref[n] * (double)ref[n];
+        r->error += e * e;
+        energy += (double)cand[n] * (double)cand[n];
+    }
+    if (r->signal <= 0.0)
+        r->level = energy > 0.0 ? INFINITY : 0.0;
+    else if (energy <= 0.0)
+        r->level = -INFINITY;  /* silence */
+    else
+        r->level = 10.0 * log10(energy / r->signal);
+
+    for (n = 0; n + FFT_SIZE <= frames; n += FFT_HOP) {
+        double peak = -1e30, floor;
+
+        power_spectrum_db(ref + n, ref_db);
+        power_spectrum_db(cand + n, cand_db);
+        for (i = 0; i <= FFT_SIZE / 2; i++)
+            if (ref_db[i] > peak) peak = ref_db[i];
+        if (peak < -200.0)
+            continue;  /* silent frame */
+        floor = peak - SPECTRAL_RANGE;
+        for (i = 0; i <= FFT_SIZE / 2; i++) {
+            double a = ref_db[i] > floor ? ref_db[i] : floor,
+                   b = cand_db[i] > floor ? cand_db[i] : floor;
+
+            sum += (a - b) * (a - b);
+            bins++;
+        }
+    }
+    r->spectral = bins ? sqrt(sum / (double)bins) : 0.0;
+}
+
+static double
+snr_db(double signal, double error)
+{
+    if (error <= 0.0)
+        return INFINITY;
+    if (signal <= 0.0)
+        return -INFINITY;
+    return 10.0 * log10(signal / error);
+}
+
+/*
+ * snr_floor
+ *
+ * The minimum SNR for the named patch rendered by candidate c: its entry
+ * in the exception list if it has one, otherwise the candidate's.
+ */
+static double
+snr_floor(candidate_t *c, const char *name)
+{
+    unsigned int i;
+
+    for (i = 0; i < EXCEPTION_COUNT; i++)
+        if (!strcmp(exceptions[i].patch, name) &&
+            !strcmp(exceptions[i].candidate, c->name))
+            return exceptions[i].snr;
+    return c->snr;
+}
+
+int
+main(int argc, char **argv)
+{
+    double max_abs_tolerance = -1.0,
+           snr_tolerance = -1000.0,
+           spectral_tolerance = -1.0,
+           level_tolerance = -1.0;
+    unsigned int i;
+    int verbose = 0, failures = 0, compared = 0, c, b;
+    float *ref, *cand;
+
+    while ((c = getopt(argc, argv, "ve:s:d:l:")) != -1) {
+        switch (c) {
+          case 'v': verbose = 1;                       break;
+          case 'e': max_abs_tolerance = atof(optarg);  break;
+          case 's': snr_tolerance = atof(optarg);      break;
+          case 'd': spectral_tolerance = atof(optarg); break;
+          case 'l': level_tolerance = atof(optarg);    break;
+          default:
+            fprintf(stderr, "usage: %s [-v] [-e <max abs error>] [-s <min SNR dB>] "
+                            "[-d <max spectral distance dB>] [-l <max level difference dB>] "
+                            "<bank file> ...\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-v] [-e <max abs error>] [-s <min SNR dB>] "
+                        "[-d <max spectral distance dB>] [-l <max level difference dB>] "
+                            "<bank file> ...\n", argv[0]);
+        exit(1);
+    }
+
+    unsetenv("HEXTER_RECORD_PATH");
+    unsetenv("HEXTER_VOLUME");
+    fft_init();
+
+    ref = (float *)malloc(MAX_RENDER_FRAMES * sizeof(float));
+    cand = (float *)malloc(MAX_RENDER_FRAMES * sizeof(float));
+    if (!ref || !cand) {
+        fprintf(stderr, "accuracy: out of memory\n");
+        exit(1);
+    }
+
+    for (i = 0; i < CANDIDATE_COUNT; i++) {
+        if (max_abs_tolerance >= 0.0)   candidates[i].max_abs = max_abs_tolerance;
+        if (snr_tolerance > -1000.0)    candidates[i].snr = snr_tolerance;
+        if (spectral_tolerance >= 0.0)  candidates[i].spectral = spectral_tolerance;
+        if (level_tolerance >= 0.0)     candidates[i].level = level_tolerance;
+        printf("%s tolerances: max abs error %g, SNR %g dB, spectral distance %g dB, "
+               "level difference %g dB\n",
+               candidates[i].name, candidates[i].max_abs, candidates[i].snr,
+               candidates[i].spectral, candidates[i].level);
+    }
+    if (snr_tolerance > -1000.0)
+        for (i = 0; i < EXCEPTION_COUNT; i++)
+            exceptions[i].snr = snr_tolerance;
+    else
+        for (i = 0; i < EXCEPTION_COUNT; i++)
+            printf("%s exception: %s SNR %g dB\n", exceptions[i].candidate,
+                   exceptions[i].patch, exceptions[i].snr);
+    printf("bank\tslot\tname\tengine\tmax_abs\tsnr_db\tspec_db\tlevel_db\tresult\n");
+
+    for (b = optind; b < argc; b++) {
+        const char *bankfile = argv[b], *bankname = strrchr(bankfile, '/');
+        dx7_patch_t bank[128];
+        char *errmsg = NULL;
+        int count, slot;
+
+        bankname = bankname ? bankname + 1 : bankfile;
+        count = dx7_patchbank_load_fix(bankfile, bank, 128, &errmsg);
+        if (count == 0) {
+            fprintf(stderr, "accuracy: could not load '%s': %s\n", bankfile,
+                    errmsg ? errmsg : "no patches found");
+            exit(1);
+        }
+
+        for (slot = 0; slot < count; slot++) {
+            compare_t worst[CANDIDATE_COUNT];
+            char name[11];
+            int k, v, s;
+
+            dx7_voice_copy_name_fix(name, &bank[slot]);
+            for (k = 10; k > 0 && name[k - 1] == ' '; k--);
+            name[k] = 0;
+            for (i = 0; i < CANDIDATE_COUNT; i++) {
+                worst[i].max_abs = 0.0;
+                worst[i].signal = 1.0;
+                worst[i].error = 0.0;
+                worst[i].spectral = 0.0;
+                worst[i].level = 0.0;
+            }
+
+            for (k = 0; k < sizeof(test_keys); k++) {
+                for (v = 0; v < sizeof(test_velocities); v++) {
+                    for (s = 0; s < SCENARIO_COUNT; s++) {
+
+                        unsigned long frames;
+
+                        frames = render(&reference, bankfile, slot, test_keys[k],
+                                        test_velocities[v], s, ref);
+
+                        for (i = 0; i < CANDIDATE_COUNT; i++) {
+                            compare_t r;
+
+                            render(&candidates[i], bankfile, slot, test_keys[k],
+                                   test_velocities[v], s, cand);
+                            compare(ref, cand, frames, &r);
+                            compared++;
+                            if (verbose)
+                                printf("  %s %d key %d vel %d %s: %s max_abs %.6f snr %.1f spec %.3f level %.2f\n",
+                                       bankname, slot, test_keys[k], test_velocities[v],
+                                       scenario_names[s], candidates[i].name, r.max_abs,
+                                       snr_db(r.signal, r.error), r.spectral, r.level);
+                            if (r.max_abs > worst[i].max_abs)
+                                worst[i].max_abs = r.max_abs;
+                            if (snr_db(r.signal, r.error) < snr_db(worst[i].signal, worst[i].error)) {
+                                worst[i].signal = r.signal;
+                                worst[i].error = r.error;
+                            }
+                            if (r.spectral > worst[i].spectral)
+                                worst[i].spectral = r.spectral;
+                            if (fabs(r.level) > fabs(worst[i].level))
+                                worst[i].level = r.level;
+                        }
+                    }
+                }
+            }
+
+            for (i = 0; i < CANDIDATE_COUNT; i++) {
+                double snr = snr_db(worst[i].signal, worst[i].error);
+                int fail = (worst[i].max_abs > candidates[i].max_abs ||
+                            snr < snr_floor(&candidates[i], name) ||
+                            worst[i].spectral > candidates[i].spectral ||
+                            fabs(worst[i].level) > candidates[i].level);
+
+                printf("%s\t%d\t%s\t%s\t%.6f\t%.1f\t%.3f\t%.2f\t%s\n", bankname, slot,
+                       name, candidates[i].name, worst[i].max_abs, snr, worst[i].spectral,
+                       worst[i].level, fail ? "FAIL" : "ok");
+                if (fail)
+                    failures++;
+            }
+        }
+    }
+
+    printf("%d renders compared, %d patch/engine combinations out of tolerance\n",
+           compared, failures);
+
+    /* a candidate whose alternate path never ran was not tested at all */
+    for (i = 0; i < CANDIDATE_COUNT; i++) {
+        if (!candidates[i].wavetables)
+            continue;
+        printf("%s: %lu voice nuggets played from steady-state wavetables\n",
+               candidates[i].name, candidates[i].wavetable_nuggets);
+        if (candidates[i].wavetable_nuggets == 0) {
+            printf("%s: no wavetable was ever captured\n", candidates[i].name);
+            failures++;
+        }
+    }
+    free(ref);
+    free(cand);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,641 @@
+/* hexter engine benchmark
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Runs a set of named cases through the engine and reports the CPU time
+ * run_synth() takes for each, so the cost of engine features can be
+ * measured, and compared between builds.  A case is a note pattern plus
+ * the configure() settings to play it with; a case may name a base case,
+ * and then its cost relative to that base is shown too.  Each case is run
+ * several times (-n, default 5) on a fresh instance, and the fastest run is
+ * reported, as a tab-separated line:
+ *
+ *   case      case name
+ *   cpu_s     CPU seconds spent in run_synth()
+ *   realtime  rendered seconds per CPU second
+ *   steals    voices stolen for new notes
+ *   declicks  stolen voices faded out by the de-click path
+ *   lod       voice nuggets rendered at a reduced level of detail
+ *   wavetable voice nuggets played from a steady-state wavetable
+ *   onset     voice bursts played from the note-onset cache
+ *   vs_base   percentage CPU time over (or under) the base case
+ *
+ * The 'pads' cases hold their chords long enough for steady-state
+ * wavetables to pay off, but only patches without modulation, detune or
+ * strong feedback can use them; pick one with -p (the ROM bank's PIPES 4 or
+ * SYNORGAN 1, say).  The 'seq' cases repeat a bassline whose note starts
+ * the onset cache can replay; they take a patch with oscillator key sync,
+ * and gain most where the notes are short (the ROM bank's XYLOPHONE, -p 13).
+ *
+ * The pseudo-case 'startup' instead measures the wall-clock time from
+ * instantiate() to the first audible output of a note played right away,
+ * which is what a host scanning plugins or loading a session waits on.  It
+ * is repeated 20 times as often as the other cases, and the fastest time
+ * is reported against a target (-u, default 50 microseconds).
+ *
+ * The pseudo-case 'session' measures the wall-clock time to bring up a
+ * saved session of 16 instances, each with its own bank, edit buffer,
+ * performance parameters and polyphony: with the separate 'patches0' to
+ * 'patches3', 'edit_buffer', 'performance', 'polyphony' and 'monophonic'
+ * configure() calls a host would replay (session_us), with a single
+ * 'snapshot' call per instance (snapshot_us), and with
+ * hexter_instance_restore_snapshot() from snapshots already in memory
+ * (restore_us), as an embedding host could.  The GUIs do not send
+ * 'snapshot', so DSSI hosts replay the separate keys; the latter two are
+ * only open to programs that save snapshots themselves.  All are checked
+ * to restore the same state, then timed 20 times per repeat, and the
+ * fastest time of each is reported, with the speedups of the latter two.
+ *
+ * usage: bench [-r <sample rate>] [-s <seconds>] [-n <repeats>]
+ *              [-b <bank file>] [-p <program>] [-u <startup target us>]
+ *              [<case> ...]
+ *
+ * With no case names, all cases, startup and session are run.
+ */
+
+#define _GNU_SOURCE 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <ladspa.h>
+#include <dssi.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "dx7_voice_data.h"
+
+typedef struct {
+    const char  *name;
+    const char  *base;             /* case to compare against, or NULL */
+    void       (*pattern)(void);
+    const char  *configure[8];     /* key, value pairs, NULL terminated */
+} bench_case_t;
+
+static void pattern_chords(void);
+static void pattern_run(void);
+static void pattern_pads(void);
+static void pattern_seq(void);
+
+static bench_case_t cases[] = {
+    /* 8-note chords, twice a second, without voice stealing */
+    { "chords",        NULL,    pattern_chords, { "polyphony", "32", NULL } },
+    { "chords-eco",    "chords", pattern_chords, { "polyphony", "32", "quality", "eco", NULL } },
+    { "chords-high",   "chords", pattern_chords, { "polyphony", "32", "quality", "high", NULL } },
+    /* quiet voices, mostly release tails, at eco quality or carriers alone */
+    { "chords-lod",    "chords", pattern_chords, { "polyphony", "32", "lod", "-30 -50", NULL } },
+    /* voices rendered at half the host rate, then resampled, as for a
+     * 96kHz session (-r 96000) */
+    { "chords-half",   "chords", pattern_chords, { "polyphony", "32", "internal_rate", "half", NULL } },
+    /* 4-note chords held for four seconds, played from steady-state
+     * wavetables once the envelopes sustain */
+    { "pads",          NULL,    pattern_pads,   { "polyphony", "16", NULL } },
+    { "pads-wavetable", "pads", pattern_pads,   { "polyphony", "16", "wavetable", "on", NULL } },
+    /* a sequenced bassline, eight notes a second, with and without the
+     * note-onset cache */
+    { "seq",           NULL,    pattern_seq,    { "polyphony", "8", NULL } },
+    { "seq-onset",     "seq",   pattern_seq,    { "polyphony", "8", "onset_cache", "32 100", NULL } },
+    /* a fast run of overlapping notes at a tight polyphony limit, so nearly
+     * every note-on steals a voice */
+    { "steal",         NULL,    pattern_run,    { "polyphony", "4", "declick", "off", NULL } },
+    { "steal-declick", "steal", pattern_run,    { "polyphony", "4", "declick", "on", NULL } },
+    { NULL }
+};
+
+static const DSSI_Descriptor *d;
+static LADSPA_Handle handle;
+static unsigned long sample_rate = 44100;
+static unsigned long nuggets;      /* length of each case */
+static float output[HEXTER_NUGGET_SIZE];
+static float tuning = 440.0f, volume = 0.0f;
+static double cpu_seconds;
+
+static double
+cpu_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+static void
+run_nugget(snd_seq_event_t *events, unsigned long event_count)
+{
+    double start = cpu_time();
+
+    d->run_synth(handle, HEXTER_NUGGET_SIZE, events, event_count);
+    cpu_seconds += cpu_time() - start;
+}
+
+static void
+note_event(snd_seq_event_t *event, int on, unsigned char key,
+           unsigned char velocity)
+{
+    memset(event, 0, sizeof(snd_seq_event_t));
+    event->type = on ? SND_SEQ_EVENT_NOTEON : SND_SEQ_EVENT_NOTEOFF;
+    event->data.note.note = key;
+    event->data.note.velocity = velocity;
+}
+
+static void
+pattern_chords(void)
+{
+    static const unsigned char chord[8] = { 36, 43, 48, 52, 55, 60, 64, 67 };
+    unsigned long step = sample_rate / 2 / HEXTER_NUGGET_SIZE,
+                  gate = step * 3 / 4, n;
+    snd_seq_event_t events[8];
+    int i, transpose = 0;
+
+    for (n = 0; n < nuggets; n++) {
+        if (n % step == 0) {
+            transpose = (n / step) % 5;
+            for (i = 0; i < 8; i++)
+                note_event(&events[i], 1, chord[i] + transpose, 100);
+            run_nugget(events, 8);
+        } else if (n % step == gate) {
+            for (i = 0; i < 8; i++)
+                note_event(&events[i], 0, chord[i] + transpose, 64);
+            run_nugget(events, 8);
+        } else
+            run_nugget(NULL, 0);
+    }
+}
+
+static void
+pattern_run(void)
+{
+    unsigned long step = sample_rate / 40 / HEXTER_NUGGET_SIZE,  /* 40 notes per second */
+                  gate = 8 * step, n;
+    snd_seq_event_t events[2];
+    int e;
+
+    if (step < 1)
+        step = 1;
+    for (n = 0; n < nuggets; n++) {
+        e = 0;
+        if (n % step == 0)
+            note_event(&events[e++], 1, 48 + (n / step * 7) % 37, 100);
+        if (n >= gate && (n - gate) % step == 0)
+            note_event(&events[e++], 0, 48 + ((n - gate) / step * 7) % 37, 64);
+        run_nugget(e ? events : NULL, e);
+    }
+}
+
+static void
+pattern_pads(void)
+{
+    static const unsigned char chord[4] = { 48, 55, 60, 64 };
+    unsigned long step = sample_rate * 9 / 2 / HEXTER_NUGGET_SIZE,
+                  gate = sample_rate * 4 / HEXTER_NUGGET_SIZE, n;
+    snd_seq_event_t events[4];
+    int i, transpose = 0;
+
+    for (n = 0; n < nuggets; n++) {
+        if (n % step == 0) {
+            transpose = (n / step) % 5;
+            for (i = 0; i < 4; i++)
+                note_event(&events[i], 1, chord[i] + transpose, 100);
+            run_nugget(events, 4);
+        } else if (n % step == gate) {
+            for (i = 0; i < 4; i++)
+                note_event(&events[i], 0, chord[i] + transpose, 64);
+            run_nugget(events, 4);
+        } else
+            run_nugget(NULL, 0);
+    }
+}
+
+static void
+pattern_seq(void)
+{
+    static const unsigned char line[16] = { 36, 36, 48, 36, 43, 36, 46, 48,
+                                            36, 36, 48, 36, 41, 43, 46, 48 };
+    unsigned long step = sample_rate / 8 / HEXTER_NUGGET_SIZE,
+                  gate = step / 2, n;
+    snd_seq_event_t event;
+    int s = 0;
+
+    if (step < 2)
+        step = 2;
+    for (n = 0; n < nuggets; n++) {
+        if (n % step == 0) {
+            s = (n / step) % 16;
+            note_event(&event, 1, line[s], s % 4 ? 90 : 120);
+            run_nugget(&event, 1);
+        } else if (n % step == gate) {
+            note_event(&event, 0, line[s], 64);
+            run_nugget(&event, 1);
+        } else
+            run_nugget(NULL, 0);
+    }
+}
+
+static double
+wall_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+static double
+run_startup(unsigned long program)
+{
+    snd_seq_event_t event;
+    double start, end;
+    unsigned long n, i;
+
+    start = wall_time();
+    handle = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, sample_rate);
+    if (!handle) {
+        fprintf(stderr, "bench: instantiate() failed!\n");
+        exit(1);
+    }
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_OUTPUT, output);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_TUNING, &tuning);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_VOLUME, &volume);
+    d->LADSPA_Plugin->activate(handle);
+    d->select_program(handle, 0, program);
+    note_event(&event, 1, 60, 100);
+    for (n = 0; n < 1000; n++) {
+        d->run_synth(handle, HEXTER_NUGGET_SIZE, n ? NULL : &event, n ? 0 : 1);
+        for (i = 0; i < HEXTER_NUGGET_SIZE; i++)
+            if (output[i] != 0.0f)
+                goto heard;
+    }
+    fprintf(stderr, "bench: startup: no output from program %lu\n", program);
+    exit(1);
+  heard:
+    end = wall_time();
+
+    d->LADSPA_Plugin->cleanup(handle);
+    return end - start;
+}
+
+#define SESSION_INSTANCES  16
+
+static const char *session_keys[] = {
+    "patches0", "patches1", "patches2", "patches3", "edit_buffer",
+    "performance", "polyphony", "monophonic", NULL
+};
+
+/* each instance's saved state, as the configure() values above, as an
+ * encoded snapshot, and as a snapshot */
+static char *session_values[SESSION_INSTANCES][8];
+static char *session_snapshot[SESSION_INSTANCES];
+static hexter_snapshot_t *session_saved[SESSION_INSTANCES];
+
+static void
+session_configure(LADSPA_Handle h, const char *key, const char *value)
+{
+    char *err = d->configure(h, key, value);
+
+    if (err) {
+        fprintf(stderr, "bench: session: configure '%s' returned: %s\n", key, err);
+        exit(1);
+    }
+}
+
+static LADSPA_Handle
+session_instantiate(void)
+{
+    LADSPA_Handle h = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, sample_rate);
+
+    if (!h) {
+        fprintf(stderr, "bench: instantiate() failed!\n");
+        exit(1);
+    }
+    return h;
+}
+
+/*
+ * make_sessions
+ *
+ * Build the 16 instances' states from the built-in patches, each with its
+ * banks in a different order and renamed, so no two instances share one.
+ * Restore each both ways, and check the snapshots saved from the two
+ * instances agree.
+ */
+static void
+make_sessions(void)
+{
+    uint8_t builtin[128 * DX7_VOICE_SIZE_PACKED], bank[sizeof(builtin)];
+    struct {
+        int     program;
+        uint8_t buffer[DX7_VOICE_SIZE_UNPACKED];
+    } edit_buffer;
+    uint8_t performance[DX7_PERFORMANCE_SIZE];
+    hexter_snapshot_t *saved;
+    LADSPA_Handle h[2];
+    int i, k, p;
+
+    hexter_data_patches_init((dx7_patch_t *)builtin);
+    for (i = 0; i < SESSION_INSTANCES; i++) {
+        for (p = 0; p < 128; p++) {
+            memcpy(bank + p * DX7_VOICE_SIZE_PACKED,
+                   builtin + ((p + i * 7) % 128) * DX7_VOICE_SIZE_PACKED,
+                   DX7_VOICE_SIZE_PACKED);
+            bank[p * DX7_VOICE_SIZE_PACKED + DX7_VOICE_SIZE_PACKED - 1] = 'A' + i;
+        }
+        for (k = 0; k < 4; k++) {
+            session_values[i][k] = (char *)malloc(ENCODE_7IN6_SIZE(32 * DX7_VOICE_SIZE_PACKED));
+            encode_7in6(bank + k * 32 * DX7_VOICE_SIZE_PACKED,
+                        32 * DX7_VOICE_SIZE_PACKED, session_values[i][k]);
+        }
+        memset(&edit_buffer, 0, sizeof(edit_buffer));
+        edit_buffer.program = i * 5;
+        dx7_patch_unpack((dx7_patch_t *)bank, i * 5 + 1, edit_buffer.buffer);
+        session_values[i][4] = (char *)malloc(ENCODE_7IN6_SIZE(sizeof(edit_buffer)));
+        encode_7in6((uint8_t *)&edit_buffer, sizeof(edit_buffer), session_values[i][4]);
+        hexter_data_performance_init(performance);
+        performance[3] = i % 13;  /* pitch bend range */
+        session_values[i][5] = (char *)malloc(ENCODE_7IN6_SIZE(DX7_PERFORMANCE_SIZE));
+        encode_7in6(performance, DX7_PERFORMANCE_SIZE, session_values[i][5]);
+        session_values[i][6] = (char *)malloc(4);
+        snprintf(session_values[i][6], 4, "%d", 8 + i * 3);
+        session_values[i][7] = strdup(i % 4 ? "off" : "on");
+
+        saved = (hexter_snapshot_t *)malloc(2 * sizeof(hexter_snapshot_t));
+        h[0] = session_instantiate();
+        for (k = 0; session_keys[k]; k++)
+            session_configure(h[0], session_keys[k], session_values[i][k]);
+        d->select_program(h[0], 0, i * 5);
+        hexter_instance_save_snapshot((hexter_instance_t *)h[0], &saved[0], NULL);
+        session_snapshot[i] = (char *)malloc(ENCODE_7IN6_SIZE(sizeof(hexter_snapshot_t)));
+        encode_7in6((uint8_t *)&saved[0], sizeof(hexter_snapshot_t), session_snapshot[i]);
+
+        h[1] = session_instantiate();
+        session_configure(h[1], "snapshot", session_snapshot[i]);
+        hexter_instance_save_snapshot((hexter_instance_t *)h[1], &saved[1], NULL);
+        if (memcmp(&saved[0], &saved[1], sizeof(hexter_snapshot_t))) {
+            fprintf(stderr, "bench: session: instance %d restored from its snapshot differs\n", i);
+            exit(1);
+        }
+        d->LADSPA_Plugin->cleanup(h[0]);
+        d->LADSPA_Plugin->cleanup(h[1]);
+        session_saved[i] = saved;
+    }
+}
+
+/*
+ * run_session
+ *
+ * return the time taken to instantiate and restore all 16 instances: with
+ * separate configure() calls (mode 0), 'snapshot' calls (1), or snapshots
+ * in memory (2)
+ */
+static double
+run_session(int mode)
+{
+    LADSPA_Handle h[SESSION_INSTANCES];
+    double start, end;
+    int i, k;
+
+    start = wall_time();
+    for (i = 0; i < SESSION_INSTANCES; i++) {
+        h[i] = session_instantiate();
+        if (mode == 2) {
+            char *err = hexter_instance_restore_snapshot((hexter_instance_t *)h[i],
+                                                         session_saved[i], NULL);
+            if (err) {
+                fprintf(stderr, "bench: session: restore returned: %s\n", err);
+                exit(1);
+            }
+        } else if (mode == 1) {
+            session_configure(h[i], "snapshot", session_snapshot[i]);
+        } else {
+            for (k = 0; session_keys[k]; k++)
+                session_configure(h[i], session_keys[k], session_values[i][k]);
+            d->select_program(h[i], 0, i * 5);
+        }
+    }
+    end = wall_time();
+
+    for (i = 0; i < SESSION_INSTANCES; i++)
+        d->LADSPA_Plugin->cleanup(h[i]);
+    return end - start;
+}
+
+static double
+run_case(bench_case_t *c, unsigned long program, hexter_stats_t *stats)
+{
+    int i;
+
+    handle = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, sample_rate);
+    if (!handle) {
+        fprintf(stderr, "bench: instantiate() failed!\n");
+        exit(1);
+    }
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_OUTPUT, output);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_TUNING, &tuning);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_VOLUME, &volume);
+    d->LADSPA_Plugin->activate(handle);
+    for (i = 0; c->configure[i]; i += 2) {
+        char *err = d->configure(handle, c->configure[i], c->configure[i + 1]);
+
+        if (err) {
+            fprintf(stderr, "bench: case '%s': configure '%s' returned: %s\n",
+                    c->name, c->configure[i], err);
+            exit(1);
+        }
+    }
+    d->select_program(handle, 0, program);
+
+    cpu_seconds = 0.0;
+    c->pattern();
+
+    hexter_instance_get_stats((hexter_instance_t *)handle, stats);
+    d->LADSPA_Plugin->cleanup(handle);
+    return cpu_seconds;
+}
+
+static bench_case_t *
+find_case(const char *name)
+{
+    bench_case_t *c;
+
+    for (c = cases; c->name; c++)
+        if (!strcmp(c->name, name))
+            return c;
+    return NULL;
+}
+
+static void
+usage(const char *program_name)
+{
+    bench_case_t *c;
+
+    fprintf(stderr, "usage: %s [-r <sample rate>] [-s <seconds>] [-n <repeats>]\n"
+                    "          [-b <bank file>] [-p <program>] [-u <startup target us>]\n"
+                    "          [<case> ...]\n"
+                    "cases: startup session", program_name);
+    for (c = cases; c->name; c++)
+        fprintf(stderr, " %s", c->name);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+    double seconds = 10.0, times[sizeof(cases) / sizeof(cases[0])];
+    int selected[sizeof(cases) / sizeof(cases[0])];
+    hexter_stats_t stats[sizeof(cases) / sizeof(cases[0])];
+    unsigned long program = 0;
+    double startup = 0.0, startup_target = 50.0, session[3] = { 0.0, 0.0, 0.0 };
+    int repeats = 5, do_startup, do_session, any_cases = 0, i, r, c;
+
+    while ((c = getopt(argc, argv, "r:s:n:b:p:u:")) != -1) {
+        switch (c) {
+          case 'r':
+            sample_rate = strtoul(optarg, NULL, 10);
+            break;
+          case 's':
+            seconds = atof(optarg);
+            break;
+          case 'n':
+            repeats = atoi(optarg);
+            break;
+          case 'b':
+            setenv("HEXTER_DEFAULT_BANK_PATH", optarg, 1);
+            setenv("HEXTER_DEFAULT_BANK_SYNC", "1", 1);
+            break;
+          case 'p':
+            program = strtoul(optarg, NULL, 10);
+            break;
+          case 'u':
+            startup_target = atof(optarg);
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (sample_rate < 8000 || seconds <= 0.0 || repeats < 1 || program > 127)
+        usage(argv[0]);
+    for (i = 0; cases[i].name; i++)
+        selected[i] = (optind == argc);
+    do_startup = do_session = (optind == argc);
+    for (i = optind; i < argc; i++) {
+        bench_case_t *bc;
+
+        if (!strcmp(argv[i], "startup")) {
+            do_startup = 1;
+            continue;
+        }
+        if (!strcmp(argv[i], "session")) {
+            do_session = 1;
+            continue;
+        }
+        bc = find_case(argv[i]);
+
+        if (!bc) {
+            fprintf(stderr, "bench: unknown case '%s'\n", argv[i]);
+            usage(argv[0]);
+        }
+        selected[bc - cases] = 1;
+        if (bc->base)  /* base cases come before their dependents in cases[] */
+            selected[find_case(bc->base) - cases] = 1;
+    }
+
+    unsetenv("HEXTER_RECORD_PATH");
+    unsetenv("HEXTER_VOLUME");
+
+    d = dssi_descriptor(0);
+    if (!d) {
+        fprintf(stderr, "bench: dssi_descriptor() failed!\n");
+        exit(1);
+    }
+    nuggets = (unsigned long)(seconds * (double)sample_rate) / HEXTER_NUGGET_SIZE;
+    seconds = (double)(nuggets * HEXTER_NUGGET_SIZE) / (double)sample_rate;
+    if (do_session)
+        make_sessions();
+
+    /* alternate between the cases on each repeat, so that a change in
+     * machine load affects them all alike */
+    for (r = 0; r < repeats; r++) {
+        if (do_startup) {
+            for (i = 0; i < 20; i++) {
+                double t = run_startup(program);
+
+                if ((r == 0 && i == 0) || t < startup)
+                    startup = t;
+            }
+        }
+        if (do_session) {
+            for (i = 0; i < 60; i++) {
+                double t = run_session(i % 3);
+
+                if ((r == 0 && i < 3) || t < session[i % 3])
+                    session[i % 3] = t;
+            }
+        }
+        for (i = 0; cases[i].name; i++) {
+            double t;
+
+            if (!selected[i])
+                continue;
+            t = run_case(&cases[i], program, &stats[i]);
+            if (r == 0 || t < times[i])
+                times[i] = t;
+        }
+    }
+
+    for (i = 0; cases[i].name; i++) {
+        if (selected[i]) {
+            printf("case\tcpu_s\trealtime\tsteals\tdeclicks\tlod\twavetable\tonset\tvs_base\n");
+            any_cases = 1;
+            break;
+        }
+    }
+    for (i = 0; cases[i].name; i++) {
+        bench_case_t *base;
+
+        if (!selected[i])
+            continue;
+        printf("%s\t%.4f\t%.1f\t%lu\t%lu\t%lu\t%lu\t%lu", cases[i].name,
+               times[i], times[i] > 0.0 ? seconds / times[i] : 0.0,
+               stats[i].steals, stats[i].declicks,
+               stats[i].lod_eco + stats[i].lod_carriers, stats[i].wavetable,
+               stats[i].onset_hits);
+        base = cases[i].base ? find_case(cases[i].base) : NULL;
+        if (base && times[base - cases] > 0.0)
+            printf("\t%+.1f%%\n", 100.0 * (times[i] / times[base - cases] - 1.0));
+        else
+            printf("\t-\n");
+    }
+
+    if (do_startup)
+        printf("%sstartup_us\ttarget_us\tresult\n%.1f\t%.0f\t%s\n",
+               any_cases ? "\n" : "", startup * 1000000.0, startup_target,
+               startup * 1000000.0 <= startup_target ? "ok" : "over");
+    if (do_session)
+        printf("%ssession_us\tsnapshot_us\trestore_us\tsnapshot_x\trestore_x\n"
+               "%.1f\t%.1f\t%.1f\t%.2f\t%.2f\n",
+               any_cases || do_startup ? "\n" : "", session[0] * 1000000.0,
+               session[1] * 1000000.0, session[2] * 1000000.0,
+               session[0] / session[1], session[0] / session[2]);
+
+    return 0;
+}
@@ -0,0 +1,323 @@
+/* hexter 7-in-6 codec benchmark
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Measures the throughput of encode_7in6() and decode_7in6(), the codec
+ * that carries patch sections, the edit buffer and performance data over
+ * configure(), against the character-at-a-time versions they replaced,
+ * which are kept here as a reference.  First both are checked to agree:
+ * on the encoding of random data of each size, and on accepting or
+ * rejecting that encoding after each of a set of corruptions.  Then, for
+ * each block size the plugin sends, each codec is run for about a second
+ * (-s), and reported as a tab-separated line:
+ *
+ *   bytes      block size
+ *   op         encode or decode
+ *   ref_MB/s   reference throughput, in megabytes of decoded data per second
+ *   new_MB/s   current throughput
+ *   speedup    new / ref
+ *
+ * usage: codec [-s <seconds>]
+ */
+
+#define _GNU_SOURCE 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "hexter_types.h"
+#include "dx7_voice_data.h"
+
+static const int sizes[] = {
+    DX7_PERFORMANCE_SIZE,
+    DX7_VOICE_SIZE_UNPACKED,           /* edit buffer */
+    32 * DX7_VOICE_SIZE_PACKED,        /* patch section */
+    0
+};
+
+static double
+now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0e9;
+}
+
+/*
+ * reference_encode
+ *
+ * encode_7in6() as it was, one character at a time, into a malloc'd string
+ */
+static char *
+reference_encode(const uint8_t *data, int length)
+{
+    char *buffer;
+    int in, reg, above, below, shift, out;
+    int outchars = (length * 7 + 5) / 6;
+    unsigned int sum = 0;
+
+    if (!(buffer = (char *)malloc(25 + outchars)))
+        return NULL;
+
+    out = snprintf(buffer, 12, "%d ", length);
+
+    in = reg = above = below = 0;
+    while (outchars) {
+        if (above == 6) {
+            buffer[out] = base64[reg >> 7];
+            reg &= 0x7f;
+            above = 0;
+            out++;
+            outchars--;
+        }
+        if (below == 0) {
+            if (in < length) {
+                reg |= data[in] & 0x7f;
+                sum += data[in];
+            }
+            below = 7;
+            in++;
+        }
+        shift = 6 - above;
+        if (below < shift) shift = below;
+        reg <<= shift;
+        above += shift;
+        below -= shift;
+    }
+
+    snprintf(buffer + out, 12, " %d", sum);
+
+    return buffer;
+}
+
+/*
+ * reference_decode
+ *
+ * decode_7in6() as it was, with a strchr() per character and a malloc'd
+ * temporary buffer (no longer leaked on an illegal character)
+ */
+static int
+reference_decode(const char *string, int expected_length, uint8_t *data)
+{
+    int in, stated_length, reg, above, below, shift, out;
+    char *p;
+    uint8_t *tmpdata;
+    int string_length = strlen(string);
+    unsigned int sum = 0, stated_sum;
+
+    if (string_length < 6)
+        return 0;
+
+    stated_length = strtol(string, &p, 10);
+    in = p - string;
+    if (in == 0 || string[in] != ' ')
+        return 0;
+    in++;
+    if (stated_length != expected_length)
+        return 0;
+
+    if (string_length - in < ((expected_length * 7 + 5) / 6))
+        return 0;
+
+    if (!(tmpdata = (uint8_t *)malloc(expected_length)))
+        return 0;
+
+    reg = above = below = out = 0;
+    while (1) {
+        if (above == 7) {
+            tmpdata[out] = reg >> 6;
+            sum += tmpdata[out];
+            reg &= 0x3f;
+            above = 0;
+            if (++out == expected_length)
+                break;
+        }
+        if (below == 0) {
+            if (!string[in] || !(p = strchr(base64, string[in]))) {
+                free(tmpdata);
+                return 0;
+            }
+            reg |= p - base64;
+            below = 6;
+            in++;
+        }
+        shift = 7 - above;
+        if (below < shift) shift = below;
+        reg <<= shift;
+        above += shift;
+        below -= shift;
+    }
+
+    if (string[in++] != ' ') {
+        free(tmpdata);
+        return 0;
+    }
+
+    stated_sum = strtol(string + in, &p, 10);
+    if (sum != stated_sum) {
+        free(tmpdata);
+        return 0;
+    }
+
+    memcpy(data, tmpdata, expected_length);
+    free(tmpdata);
+
+    return 1;
+}
+
+/*
+ * check
+ *
+ * compare the two codecs on random data of the given size, returning the
+ * number of disagreements
+ */
+static int
+check(int length)
+{
+    uint8_t data[32 * DX7_VOICE_SIZE_PACKED], ref_out[sizeof(data)],
+            new_out[sizeof(data)];
+    char encoded[ENCODE_7IN6_SIZE(sizeof(data))], *ref_encoded;
+    int errors = 0, trial, i, position, ref_ok, new_ok;
+
+    for (i = 0; i < length; i++)
+        data[i] = random() & 0x7f;
+
+    ref_encoded = reference_encode(data, length);
+    encode_7in6(data, length, encoded);
+    if (strcmp(ref_encoded, encoded)) {
+        fprintf(stderr, "codec: %d bytes: encodings differ\n", length);
+        errors++;
+    }
+
+    for (trial = 0; trial < 200; trial++) {
+        strcpy(encoded, ref_encoded);
+        position = random() % strlen(encoded);
+        switch (trial % 5) {
+          case 0:  break;                                       /* intact */
+          case 1:  encoded[position] = base64[random() & 0x3f]; break;
+          case 2:  encoded[position] = random() & 0xff; break;  /* maybe illegal */
+          case 3:  encoded[position] = 0; break;                /* truncated */
+          case 4:  encoded[position] = ' '; break;
+        }
+        memset(ref_out, 0x80, length);
+        memset(new_out, 0x80, length);
+        ref_ok = reference_decode(encoded, length, ref_out);
+        new_ok = decode_7in6(encoded, length, new_out);
+        if (ref_ok != new_ok || memcmp(ref_out, new_out, length)) {
+            fprintf(stderr, "codec: %d bytes: decoders differ on corruption %d at %d\n",
+                    length, trial % 5, position);
+            errors++;
+        }
+        if (trial % 5 == 0 && (!new_ok || memcmp(data, new_out, length))) {
+            fprintf(stderr, "codec: %d bytes: round trip failed\n", length);
+            errors++;
+        }
+    }
+
+    free(ref_encoded);
+    return errors;
+}
+
+/*
+ * rate
+ *
+ * run one codec on blocks of the given size for about 'seconds', and
+ * return its throughput in megabytes of decoded data per second
+ */
+static double
+rate(int length, int decode, int reference, double seconds)
+{
+    uint8_t data[32 * DX7_VOICE_SIZE_PACKED];
+    char encoded[ENCODE_7IN6_SIZE(sizeof(data))];
+    double start, elapsed;
+    unsigned long count = 0, batch = 1000000 / length + 1, i;
+    volatile int sink = 0;
+
+    for (i = 0; i < length; i++)
+        data[i] = random() & 0x7f;
+    encode_7in6(data, length, encoded);
+
+    start = now();
+    do {
+        for (i = 0; i < batch; i++) {
+            if (decode) {
+                if (reference)
+                    sink += reference_decode(encoded, length, data);
+                else
+                    sink += decode_7in6(encoded, length, data);
+            } else {
+                if (reference) {
+                    char *p = reference_encode(data, length);
+
+                    sink += p[0];
+                    free(p);
+                } else {
+                    sink += encode_7in6(data, length, encoded);
+                }
+            }
+        }
+        count += batch;
+        elapsed = now() - start;
+    } while (elapsed < seconds);
+
+    return (double)count * length / elapsed / 1.0e6;
+}
+
+int
+main(int argc, char **argv)
+{
+    double seconds = 1.0, ref_rate, new_rate;
+    int errors = 0, i, op, c;
+
+    while ((c = getopt(argc, argv, "s:")) != -1) {
+        switch (c) {
+          case 's':
+            seconds = atof(optarg);
+            break;
+          default:
+            fprintf(stderr, "usage: %s [-s <seconds>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    srandom(1);
+    for (i = 0; sizes[i]; i++)
+        errors += check(sizes[i]);
+    if (errors) {
+        fprintf(stderr, "codec: %d disagreements with the reference codec\n", errors);
+        return 1;
+    }
+
+    printf("bytes\top\tref_MB/s\tnew_MB/s\tspeedup\n");
+    for (i = 0; sizes[i]; i++) {
+        for (op = 0; op < 2; op++) {
+            ref_rate = rate(sizes[i], op, 1, seconds);
+            new_rate = rate(sizes[i], op, 0, seconds);
+            printf("%d\t%s\t%.1f\t%.1f\t%.2f\n", sizes[i],
+                   op ? "decode" : "encode", ref_rate, new_rate,
+                   new_rate / ref_rate);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,381 @@
+/* hexter engine library benchmark
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Drives the engine through the libhexter-engine API alone, with no
+ * DSSI, LADSPA or ALSA headers or plugin glue, as an embedding host
+ * would.  It plays 8-note chords, twice a second, for -s seconds (default
+ * 10), rendered in each of a range of block sizes.  Since the engine
+ * handles each event at its frame offset, every block size must render
+ * the same output; each is compared with the first, and reported as a
+ * tab-separated line:
+ *
+ *   block     block size, in frames
+ *   cpu_s     CPU seconds spent in hexter_engine_render()
+ *   realtime  rendered seconds per CPU second
+ *   max_diff  largest difference from the first block size's output
+ *
+ * It then plays a note every half second on each of the first 16, 4 or 1
+ * MIDI channels, each with a program of its own, in blocks of 64 frames,
+ * first with 16 engines, one per channel, and their outputs mixed, then
+ * with one multitimbral engine, then with the 16 engines sharing a global
+ * voice budget of BUDGET voices, and reports each under 'engines',
+ * 'playing' and 'budget'.  max_diff compares each mix with that of the 16
+ * engines alone.  The multitimbral mix differs where notes are given
+ * voices that have been used before differently, since oscillators that
+ * are not key-synced run on from a voice's last note; the budgeted one
+ * also has fewer voices.
+ *
+ * usage: engine [-r <sample rate>] [-s <seconds>] [-b <bank file>]
+ *               [-p <program>]
+ */
+
+#define _GNU_SOURCE 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+
+#include "hexter_engine.h"
+
+static const unsigned long block_sizes[] = { 64, 16, 100, 256, 1024, 4096, 0 };
+
+#define PARTS        16
+#define PART_BLOCK   64
+#define BUDGET       16
+
+static hexter_engine_event_t *events;
+static unsigned long event_count;
+
+static hexter_engine_event_t *part_events;
+static unsigned long part_event_count;
+
+static double
+cpu_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+/*
+ * make_events
+ *
+ * the chord pattern, at absolute frame positions
+ */
+static void
+make_events(unsigned long sample_rate, unsigned long frames)
+{
+    static const unsigned char chord[8] = { 36, 43, 48, 52, 55, 60, 64, 67 };
+    unsigned long step = sample_rate / 2, gate = step * 3 / 4, start;
+    int i, transpose;
+
+    events = (hexter_engine_event_t *)malloc((frames / step + 1) * 16 *
+                                             sizeof(hexter_engine_event_t));
+    event_count = 0;
+    for (start = 0; start < frames; start += step) {
+        transpose = (start / step) % 5;
+        for (i = 0; i < 8; i++) {
+            events[event_count].frame = start;
+            events[event_count].status = 0x90;
+            events[event_count].data1 = chord[i] + transpose;
+            events[event_count].data2 = 100;
+            event_count++;
+        }
+        if (start + gate >= frames)
+            break;
+        for (i = 0; i < 8; i++) {
+            events[event_count].frame = start + gate;
+            events[event_count].status = 0x80;
+            events[event_count].data1 = chord[i] + transpose;
+            events[event_count].data2 = 64;
+            event_count++;
+        }
+    }
+}
+
+static void
+make_part_event(unsigned long frame, int status, int data1, int data2)
+{
+    part_events[part_event_count].frame = frame;
+    part_events[part_event_count].status = status;
+    part_events[part_event_count].data1 = data1;
+    part_events[part_event_count].data2 = data2;
+    part_event_count++;
+}
+
+/*
+ * make_part_events
+ *
+ * the multi-channel pattern: a program change on each channel, for the
+ * multitimbral engine, then a note on each of the first 'playing'
+ * channels, every half second
+ */
+static void
+make_part_events(unsigned long sample_rate, unsigned long frames,
+                 unsigned long program, int playing)
+{
+    unsigned long step = sample_rate / 2, gate = step * 3 / 4, start;
+    int c;
+
+    part_events = (hexter_engine_event_t *)realloc(part_events,
+                                                   (PARTS + (frames / step + 1) * PARTS * 2) *
+                                                   sizeof(hexter_engine_event_t));
+    part_event_count = 0;
+    for (c = 0; c < PARTS; c++)
+        make_part_event(0, 0xc0 | c, (program + c) & 0x7f, 0);
+    for (start = 0; start < frames; start += step) {
+        for (c = 0; c < playing; c++)
+            make_part_event(start, 0x90 | c, 36 + c * 3 + (start / step) % 5, 100);
+        if (start + gate >= frames)
+            break;
+        for (c = 0; c < playing; c++)
+            make_part_event(start + gate, 0x80 | c, 36 + c * 3 + (start / step) % 5, 64);
+    }
+}
+
+/*
+ * configure
+ */
+static void
+configure(hexter_engine_t *engine, const char *key, const char *value)
+{
+    char *errmsg = hexter_engine_configure(engine, key, value);
+
+    if (errmsg) {
+        fprintf(stderr, "engine: configure '%s' returned: %s\n", key, errmsg);
+        exit(1);
+    }
+}
+
+/*
+ * new_engine
+ */
+static hexter_engine_t *
+new_engine(unsigned long sample_rate, const char *bank, const char *polyphony,
+           unsigned long program)
+{
+    hexter_engine_t *engine = hexter_engine_new(sample_rate);
+    char *errmsg;
+
+    if (!engine) {
+        fprintf(stderr, "engine: hexter_engine_new() failed!\n");
+        exit(1);
+    }
+    if (bank && !hexter_engine_load_bank(engine, bank, &errmsg)) {
+        fprintf(stderr, "engine: could not load '%s': %s\n", bank, errmsg);
+        exit(1);
+    }
+    configure(engine, "polyphony", polyphony);
+    hexter_engine_select_program(engine, 0, program);
+
+    return engine;
+}
+
+/*
+ * run
+ *
+ * render the pattern in blocks of 'block' frames into 'output', and
+ * return the CPU time taken
+ */
+static double
+run(unsigned long sample_rate, const char *bank, unsigned long program,
+    unsigned long block, float *output, unsigned long frames)
+{
+    hexter_engine_t *engine = new_engine(sample_rate, bank, "32", program);
+    hexter_engine_event_t *block_events;
+    unsigned long position, count, first = 0, i, e;
+    double seconds = 0.0, start;
+
+    block_events = (hexter_engine_event_t *)malloc(event_count * sizeof(hexter_engine_event_t));
+    for (position = 0; position < frames; position += block) {
+        count = (frames - position < block ? frames - position : block);
+        for (e = 0; first + e < event_count &&
+                    events[first + e].frame < position + count; e++) {
+            block_events[e] = events[first + e];
+            block_events[e].frame -= position;
+        }
+        first += e;
+
+        start = cpu_time();
+        hexter_engine_render(engine, output + position, count, block_events, e);
+        seconds += cpu_time() - start;
+    }
+    for (i = 0; i < frames; i++)
+        if (output[i] != 0.0f)
+            break;
+    if (i == frames) {
+        fprintf(stderr, "engine: no output from program %lu\n", program);
+        exit(1);
+    }
+
+    free(block_events);
+    hexter_engine_free(engine);
+    return seconds;
+}
+
+/*
+ * run_parts
+ *
+ * Render the multi-channel pattern into 'output', with either PARTS
+ * engines, one per channel, and their outputs mixed, or one multitimbral
+ * engine.  Each has voices enough that stealing is rare, unless the PARTS
+ * engines share a global voice budget of 'budget' voices.  Returns the CPU
+ * time taken, mixing included.
+ */
+static double
+run_parts(unsigned long sample_rate, const char *bank, unsigned long program,
+          int multitimbral, int budget, float *output, unsigned long frames)
+{
+    hexter_engine_t *engine[PARTS];
+    hexter_engine_event_t *block_events;
+    float buffer[PART_BLOCK];
+    unsigned long position, count, first = 0, last, i, e;
+    double seconds = 0.0, start;
+    int engines = (multitimbral ? 1 : PARTS), c;
+    char value[8];
+
+    snprintf(value, sizeof(value), "%d", budget);
+    for (c = 0; c < engines; c++) {
+        engine[c] = new_engine(sample_rate, bank, "64", (program + c) & 0x7f);
+        if (multitimbral)
+            configure(engine[c], "multitimbral", "on");
+        if (budget)
+            configure(engine[c], "global_polyphony", value);
+    }
+
+    block_events = (hexter_engine_event_t *)malloc(part_event_count * sizeof(hexter_engine_event_t));
+    for (position = 0; position < frames; position += PART_BLOCK) {
+        count = (frames - position < PART_BLOCK ? frames - position : PART_BLOCK);
+        for (last = first; last < part_event_count &&
+                           part_events[last].frame < position + count; last++);
+
+        start = cpu_time();
+        if (multitimbral) {
+            for (e = 0; first + e < last; e++) {
+                block_events[e] = part_events[first + e];
+                block_events[e].frame -= position;
+            }
+            hexter_engine_render(engine[0], output + position, count, block_events, e);
+        } else {
+            memset(output + position, 0, count * sizeof(float));
+            for (c = 0; c < engines; c++) {
+                for (e = 0, i = first; i < last; i++) {
+                    if ((part_events[i].status & 0x0f) == c) {
+                        block_events[e] = part_events[i];
+                        block_events[e].frame -= position;
+                        e++;
+                    }
+                }
+                hexter_engine_render(engine[c], buffer, count, block_events, e);
+                for (i = 0; i < count; i++)
+                    output[position + i] += buffer[i];
+            }
+        }
+        seconds += cpu_time() - start;
+        first = last;
+    }
+
+    free(block_events);
+    for (c = 0; c < engines; c++)
+        hexter_engine_free(engine[c]);
+    return seconds;
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned long sample_rate = 44100, program = 0, frames, i;
+    double seconds = 10.0, cpu_seconds, max_diff;
+    const char *bank = NULL;
+    float *reference, *output;
+    int b, c, playing;
+
+    while ((c = getopt(argc, argv, "r:s:b:p:")) != -1) {
+        switch (c) {
+          case 'r':
+            sample_rate = strtoul(optarg, NULL, 10);
+            break;
+          case 's':
+            seconds = atof(optarg);
+            break;
+          case 'b':
+            bank = optarg;
+            break;
+          case 'p':
+            program = strtoul(optarg, NULL, 10);
+            break;
+          default:
+            fprintf(stderr, "usage: %s [-r <sample rate>] [-s <seconds>] [-b <bank file>]\n"
+                            "          [-p <program>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (sample_rate < 8000 || seconds <= 0.0 || program > 127) {
+        fprintf(stderr, "engine: invalid option value\n");
+        return 1;
+    }
+
+    frames = (unsigned long)(seconds * (double)sample_rate);
+    make_events(sample_rate, frames);
+    reference = (float *)malloc(frames * sizeof(float));
+    output = (float *)malloc(frames * sizeof(float));
+
+    printf("block\tcpu_s\trealtime\tmax_diff\n");
+    for (b = 0; block_sizes[b]; b++) {
+        cpu_seconds = run(sample_rate, bank, program, block_sizes[b],
+                          b ? output : reference, frames);
+        max_diff = 0.0;
+        for (i = 0; b && i < frames; i++)
+            if (fabs(output[i] - reference[i]) > max_diff)
+                max_diff = fabs(output[i] - reference[i]);
+        printf("%lu\t%.4f\t%.1f\t%g\n", block_sizes[b], cpu_seconds,
+               cpu_seconds > 0.0 ? (double)frames / sample_rate / cpu_seconds : 0.0,
+               max_diff);
+    }
+
+    printf("engines\tplaying\tbudget\tcpu_s\trealtime\tmax_diff\n");
+    for (playing = PARTS; playing > 0; playing /= 4) {
+        make_part_events(sample_rate, frames, program, playing);
+        /* 16 engines, 1 multitimbral engine, 16 engines on a budget */
+        for (b = 0; b < 3; b++) {
+            cpu_seconds = run_parts(sample_rate, bank, program, b == 1,
+                                    b == 2 ? BUDGET : 0,
+                                    b ? output : reference, frames);
+            max_diff = 0.0;
+            for (i = 0; b && i < frames; i++)
+                if (fabs(output[i] - reference[i]) > max_diff)
+                    max_diff = fabs(output[i] - reference[i]);
+            printf("%d\t%d\t%d\t%.4f\t%.1f\t%g\n", b == 1 ? 1 : PARTS, playing,
+                   b == 2 ? BUDGET : 0, cpu_seconds,
+                   cpu_seconds > 0.0 ? (double)frames / sample_rate / cpu_seconds : 0.0,
+                   max_diff);
+        }
+    }
+
+    free(reference);
+    free(output);
+    free(events);
+    free(part_events);
+    return 0;
+}
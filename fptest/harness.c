@@ -50,8 +50,6 @@ static float port[3] = { 0.0f, 440.0f, -12.0f };
 static int samples[2], note[2], delay[2];
 
 static snd_seq_event_t event;
-static snd_seq_event_t *events[1] = { &event };
-static unsigned long nevents[2] = { 0, 1 };
 
 static struct rusage before, after;
 static double usage[2];
@@ -102,11 +100,7 @@ run_plugin(int i, int count)
             delay[i] += SAMPLE_RATE / 8;
         }
 
-        if (start_note) {
-            descriptor[i]->run_multiple_synths(1, &handle[i], HEXTER_NUGGET_SIZE, events, &nevents[1]);
-        } else {
-            descriptor[i]->run_multiple_synths(1, &handle[i], HEXTER_NUGGET_SIZE, events, &nevents[0]);
-        }
+        descriptor[i]->run_synth(handle[i], HEXTER_NUGGET_SIZE, &event, start_note);
         samples[i] += HEXTER_NUGGET_SIZE;
     }
 }
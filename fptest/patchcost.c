@@ -0,0 +1,290 @@
+/* hexter per-patch CPU cost profiler
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Renders every patch of a bank file through the engine with a standard
+ * note pattern, and prints a tab-separated table, one line per patch:
+ *
+ *   slot        patch number, 0 - 127
+ *   name        patch name
+ *   alg         algorithm, 1 - 32
+ *   cpu/voice   CPU time per second of one sounding voice, as a percentage
+ *               of one core
+ *   avgpoly     average number of sounding voices while playing a staccato
+ *               phrase of 8 notes per second, which grows with release tails
+ *   load        cpu/voice times avgpoly: the phrase's cost, percent of a core
+ *   prunable    percentage of operator-nuggets whose envelope output was
+ *               effectively zero, i.e. which operator pruning could skip
+ *   release_ms  mean time from note-off to voice death, or '>N' if some
+ *               voices were still sounding after the tail limit
+ *   flag        '*' when load exceeds the threshold given with -t
+ *
+ * so the output can be fed straight to sort(1), e.g.:
+ *
+ *   patchcost ../extra/dx7_roms.dx7 | sort -t'	' -k6 -g -r
+ *
+ * usage: patchcost [-r <sample rate>] [-t <load threshold %>] <bank file>
+ */
+
+#define _GNU_SOURCE 1
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <ladspa.h>
+#include <dssi.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "dx7_voice.h"
+#include "dx7_voice_data.h"
+
+#define HOLD_SECONDS       0.5   /* single-note hold time */
+#define TAIL_SECONDS       4.0   /* give up waiting for a voice to die after this */
+#define PHRASE_NOTES       16
+#define PHRASE_RATE        8     /* notes per second */
+#define PHRASE_GATE        0.1   /* staccato note length, in seconds */
+
+static const unsigned char test_keys[] = { 36, 60, 84 };
+static const unsigned char test_velocities[] = { 64, 127 };
+
+static const DSSI_Descriptor *d;
+static LADSPA_Handle handle;
+static hexter_instance_t *instance;
+static unsigned long sample_rate = 44100;
+static float output[HEXTER_NUGGET_SIZE];
+static float tuning = 440.0f, volume = 0.0f;
+
+/* per-patch statistics */
+static double cpu_seconds, voice_seconds;
+static unsigned long op_nuggets, prunable_op_nuggets;
+
+static double
+cpu_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+/* The same test as dx7_voice_check_for_dead(), applied to every operator. */
+static int
+op_is_prunable(dx7_op_t *op)
+{
+    if (op->eg.mode == DX7_EG_FINISHED)
+        return 1;
+    if ((op->eg.mode == DX7_EG_CONSTANT ||
+         op->eg.mode == DX7_EG_SUSTAINING ||
+         (op->eg.mode == DX7_EG_RUNNING && op->eg.phase == 3)) &&
+        FP_TO_INT(op->eg.value) == 0)
+        return 1;
+    return 0;
+}
+
+/* Render one nugget, with an optional event at its start, and gather
+ * statistics.  Returns the number of voices sounding afterwards. */
+static int
+run_nugget(snd_seq_event_t *event)
+{
+    double start;
+    int i, j;
+
+    start = cpu_time();
+    d->run_synth(handle, HEXTER_NUGGET_SIZE, event, event ? 1 : 0);
+    cpu_seconds += cpu_time() - start;
+
+    voice_seconds += (double)instance->current_voices * HEXTER_NUGGET_SIZE /
+                         (double)sample_rate;
+    for (i = 0; i < HEXTER_MAX_POLYPHONY; i++) {
+        dx7_voice_t *voice = instance->voice[i];
+
+        if (!voice || !_PLAYING(voice))
+            continue;
+        for (j = 0; j < MAX_DX7_OPERATORS; j++) {
+            op_nuggets++;
+            if (op_is_prunable(&voice->op[j]))
+                prunable_op_nuggets++;
+        }
+    }
+    return instance->current_voices;
+}
+
+static void
+note_event(snd_seq_event_t *event, int on, unsigned char key,
+           unsigned char velocity)
+{
+    memset(event, 0, sizeof(snd_seq_event_t));
+    event->type = on ? SND_SEQ_EVENT_NOTEON : SND_SEQ_EVENT_NOTEOFF;
+    event->data.note.note = key;
+    event->data.note.velocity = velocity;
+}
+
+int
+main(int argc, char **argv)
+{
+    dx7_patch_t bank[128];
+    char *errmsg = NULL;
+    double threshold = 5.0;
+    unsigned long hold_nuggets, tail_nuggets, phrase_nuggets, gate_nuggets,
+                  step_nuggets;
+    int count, slot, c;
+
+    while ((c = getopt(argc, argv, "r:t:")) != -1) {
+        switch (c) {
+          case 'r':
+            sample_rate = strtoul(optarg, NULL, 10);
+            break;
+          case 't':
+            threshold = atof(optarg);
+            break;
+          default:
+            fprintf(stderr, "usage: %s [-r <sample rate>] [-t <load threshold %%>] <bank file>\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (optind != argc - 1 || sample_rate < 8000) {
+        fprintf(stderr, "usage: %s [-r <sample rate>] [-t <load threshold %%>] <bank file>\n", argv[0]);
+        exit(1);
+    }
+
+    for (slot = 0; slot < 128; slot++)
+        memcpy(&bank[slot], &dx7_voice_init_voice, sizeof(dx7_patch_t));
+    count = dx7_patchbank_load(argv[optind], bank, 128, &errmsg);
+    if (count == 0) {
+        fprintf(stderr, "patchcost: could not load '%s': %s\n", argv[optind],
+                errmsg ? errmsg : "no patches found");
+        exit(1);
+    }
+
+    unsetenv("HEXTER_DEFAULT_BANK_PATH");
+    unsetenv("HEXTER_RECORD_PATH");
+    unsetenv("HEXTER_VOLUME");
+
+    d = dssi_descriptor(0);
+    handle = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, sample_rate);
+    if (!handle) {
+        fprintf(stderr, "patchcost: instantiate() failed!\n");
+        exit(1);
+    }
+    instance = (hexter_instance_t *)handle;
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_OUTPUT, output);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_TUNING, &tuning);
+    d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_VOLUME, &volume);
+    d->LADSPA_Plugin->activate(handle);
+    free(d->configure(handle, "polyphony", "64"));
+    if (!hexter_instance_set_patches(instance, (dx7_patch_t *)bank)) {
+        fprintf(stderr, "patchcost: out of memory!\n");
+        exit(1);
+    }
+
+    hold_nuggets   = (unsigned long)(HOLD_SECONDS * sample_rate) / HEXTER_NUGGET_SIZE;
+    tail_nuggets   = (unsigned long)(TAIL_SECONDS * sample_rate) / HEXTER_NUGGET_SIZE;
+    gate_nuggets   = (unsigned long)(PHRASE_GATE * sample_rate) / HEXTER_NUGGET_SIZE;
+    step_nuggets   = sample_rate / PHRASE_RATE / HEXTER_NUGGET_SIZE;
+    phrase_nuggets = PHRASE_NOTES * step_nuggets;
+
+    printf("slot\tname\talg\tcpu/voice\tavgpoly\tload\tprunable\trelease_ms\tflag\n");
+
+    for (slot = 0; slot < count; slot++) {
+        snd_seq_event_t on, off;
+        double release_seconds = 0.0, phrase_voice_seconds, load;
+        unsigned long n, releases = 0;
+        int k, v, unfinished = 0;
+        char name[11];
+
+        cpu_seconds = voice_seconds = 0.0;
+        op_nuggets = prunable_op_nuggets = 0;
+
+        d->LADSPA_Plugin->activate(handle);  /* silence and reset LFO */
+        d->select_program(handle, 0, slot);
+
+        /* single notes: hold, release, and time the tail */
+        for (k = 0; k < sizeof(test_keys); k++) {
+            for (v = 0; v < sizeof(test_velocities); v++) {
+                note_event(&on, 1, test_keys[k], test_velocities[v]);
+                note_event(&off, 0, test_keys[k], 64);
+                run_nugget(&on);
+                for (n = 1; n < hold_nuggets; n++)
+                    run_nugget(NULL);
+                if (!run_nugget(&off))
+                    continue;  /* died during the hold */
+                for (n = 1; n < tail_nuggets; n++)
+                    if (!run_nugget(NULL))
+                        break;
+                if (n == tail_nuggets) {
+                    unfinished = 1;
+                    d->LADSPA_Plugin->activate(handle);
+                } else {
+                    release_seconds += (double)n * HEXTER_NUGGET_SIZE / (double)sample_rate;
+                    releases++;
+                }
+            }
+        }
+
+        /* staccato phrase, for average polyphony */
+        phrase_voice_seconds = voice_seconds;
+        for (n = 0; n < phrase_nuggets; n++) {
+            int note = n / step_nuggets;
+            unsigned char key = 48 + (note * 7) % 25;
+
+            if (n % step_nuggets == 0) {
+                note_event(&on, 1, key, 100);
+                run_nugget(&on);
+            } else if (n % step_nuggets == gate_nuggets) {
+                note_event(&off, 0, key, 64);
+                run_nugget(&off);
+            } else
+                run_nugget(NULL);
+        }
+        phrase_voice_seconds = (voice_seconds - phrase_voice_seconds) /
+                                   ((double)phrase_nuggets * HEXTER_NUGGET_SIZE /
+                                    (double)sample_rate);
+
+        dx7_voice_copy_name(name, &bank[slot]);
+        for (k = 0; k < 10; k++)
+            if (name[k] == '\t') name[k] = ' ';
+
+        printf("%d\t%s\t%d", slot, name, (bank[slot].data[110] & 0x1f) + 1);
+        if (voice_seconds > 0.0) {
+            double per_voice = 100.0 * cpu_seconds / voice_seconds;
+
+            load = per_voice * phrase_voice_seconds;
+            printf("\t%.3f\t%.2f\t%.3f\t%.1f", per_voice, phrase_voice_seconds,
+                   load, 100.0 * (double)prunable_op_nuggets / (double)op_nuggets);
+        } else {
+            load = 0.0;
+            printf("\t-\t0.00\t0.000\t-");
+        }
+        if (unfinished)
+            printf("\t>%.0f", TAIL_SECONDS * 1000.0);
+        else if (releases)
+            printf("\t%.0f", 1000.0 * release_seconds / (double)releases);
+        else
+            printf("\t0");
+        printf("\t%s\n", load > threshold ? "*" : "");
+    }
+
+    d->LADSPA_Plugin->cleanup(handle);
+    return 0;
+}
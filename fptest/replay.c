@@ -0,0 +1,342 @@
+/* hexter session replay tool
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Feeds a session log written by a plugin instance running with
+ * HEXTER_RECORD_PATH set back through the engine, single-threaded, in
+ * recorded order.  Reports the CPU time spent in run_synth() and checks
+ * each run's output against the hash taken while recording, so a session
+ * can be profiled, or bisected across builds for changes in output.
+ *
+ * usage: replay [-o <raw float output file>] [-q] <session.hxr>
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include <ladspa.h>
+#include <dssi.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "hexter_record.h"
+
+typedef struct {
+    hexter_record_t record;
+    char           *payload;
+} replay_record_t;
+
+static replay_record_t *records = NULL;
+static size_t           record_count = 0;
+
+static double
+cpu_time(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+    return (double)usage.ru_utime.tv_sec + (double)usage.ru_utime.tv_usec / 1000000.0 +
+           (double)usage.ru_stime.tv_sec + (double)usage.ru_stime.tv_usec / 1000000.0;
+}
+
+static int
+compare_sequence(const void *a, const void *b)
+{
+    uint64_t sa = ((const replay_record_t *)a)->record.sequence,
+             sb = ((const replay_record_t *)b)->record.sequence;
+
+    return (sa < sb ? -1 : sa > sb ? 1 : 0);
+}
+
+static void
+load_session(const char *filename)
+{
+    FILE *fp;
+    hexter_record_header_t header;
+    size_t allocated = 0;
+
+    if ((fp = fopen(filename, "rb")) == NULL) {
+        fprintf(stderr, "replay: could not open '%s'\n", filename);
+        exit(1);
+    }
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, HEXTER_RECORD_MAGIC, 8)) {
+        fprintf(stderr, "replay: '%s' is not a hexter session log\n", filename);
+        exit(1);
+    }
+    if (header.version != HEXTER_RECORD_VERSION ||
+        header.byte_order != HEXTER_RECORD_BYTE_ORDER ||
+        header.record_size != sizeof(hexter_record_t)) {
+        fprintf(stderr, "replay: '%s' was recorded by an incompatible build\n", filename);
+        exit(1);
+    }
+    printf("session recorded by hexter %.32s\n", header.hexter_version);
+
+    for (;;) {
+        replay_record_t *r;
+
+        if (record_count == allocated) {
+            allocated = allocated ? allocated * 2 : 4096;
+            records = (replay_record_t *)realloc(records, allocated * sizeof(replay_record_t));
+            if (!records) {
+                fprintf(stderr, "replay: out of memory\n");
+                exit(1);
+            }
+        }
+        r = &records[record_count];
+        if (fread(&r->record, sizeof(hexter_record_t), 1, fp) != 1)
+            break;
+        r->payload = NULL;
+        if (r->record.length) {
+            r->payload = (char *)malloc(r->record.length);
+            if (!r->payload ||
+                fread(r->payload, 1, r->record.length, fp) != r->record.length) {
+                fprintf(stderr, "replay: truncated record at sequence %llu, stopping there\n",
+                        (unsigned long long)r->record.sequence);
+                free(r->payload);
+                break;
+            }
+        }
+        record_count++;
+    }
+    fclose(fp);
+
+    /* the recorder's writer interleaves audio and control thread records */
+    qsort(records, record_count, sizeof(replay_record_t), compare_sequence);
+}
+
+int
+main(int argc, char **argv)
+{
+    const DSSI_Descriptor *d;
+    hexter_instance_t *instance = NULL;
+    LADSPA_Handle handle = NULL;
+    FILE *out = NULL;
+    int quiet = 0, c;
+    float tuning = 440.0f, volume = 0.0f;
+    LADSPA_Data *output = NULL;
+    unsigned long output_size = 0, sample_rate = 0;
+    snd_seq_event_t *events = NULL;
+    unsigned long events_size = 0;
+    unsigned long long runs = 0, frames = 0, mismatches = 0, lost = 0;
+    uint64_t first_mismatch = 0;
+    double run_time = 0.0;
+    uint32_t checksum = 2166136261U;
+    size_t i;
+
+    while ((c = getopt(argc, argv, "o:q")) != -1) {
+        switch (c) {
+          case 'o':
+            if ((out = fopen(optarg, "wb")) == NULL) {
+                fprintf(stderr, "replay: could not open '%s' for writing\n", optarg);
+                exit(1);
+            }
+            break;
+          case 'q':
+            quiet = 1;
+            break;
+          default:
+            fprintf(stderr, "usage: %s [-o <raw float output file>] [-q] <session.hxr>\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-o <raw float output file>] [-q] <session.hxr>\n", argv[0]);
+        exit(1);
+    }
+
+    /* the recorded session supplies the patches and volume, and the replay
+     * itself must not be recorded */
+    unsetenv("HEXTER_RECORD_PATH");
+    unsetenv("HEXTER_DEFAULT_BANK_PATH");
+    unsetenv("HEXTER_VOLUME");
+
+    load_session(argv[optind]);
+
+    d = dssi_descriptor(0);
+    if (!d) {
+        fprintf(stderr, "replay: dssi_descriptor() failed!\n");
+        exit(1);
+    }
+
+    for (i = 0; i < record_count; i++) {
+        hexter_record_t *r = &records[i].record;
+
+        if (!handle && r->type != HEXTER_RECORD_INSTANTIATE) {
+            fprintf(stderr, "replay: session log does not begin with instantiation\n");
+            exit(1);
+        }
+
+        switch (r->type) {
+
+          case HEXTER_RECORD_INSTANTIATE:
+            if (handle) {
+                fprintf(stderr, "replay: session log contains more than one instance\n");
+                exit(1);
+            }
+            sample_rate = r->u.instantiate.sample_rate;
+            handle = d->LADSPA_Plugin->instantiate(d->LADSPA_Plugin, sample_rate);
+            if (!handle) {
+                fprintf(stderr, "replay: instantiate() failed!\n");
+                exit(1);
+            }
+            instance = (hexter_instance_t *)handle;
+            d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_TUNING, &tuning);
+            d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_VOLUME, &volume);
+            break;
+
+          case HEXTER_RECORD_PATCHES:
+            /* redo the tail of instantiation with the recorded bank */
+            if (!hexter_instance_set_patches(instance,
+                                             (dx7_patch_t *)records[i].payload)) {
+                fprintf(stderr, "replay: out of memory!\n");
+                exit(1);
+            }
+            hexter_instance_select_program(instance, 0, 0);
+            hexter_instance_init_controls(instance);
+            break;
+
+          case HEXTER_RECORD_ACTIVATE:
+            d->LADSPA_Plugin->activate(handle);
+            break;
+
+          case HEXTER_RECORD_DEACTIVATE:
+            d->LADSPA_Plugin->deactivate(handle);
+            break;
+
+          case HEXTER_RECORD_CONFIGURE:
+            {
+                char *key = records[i].payload,
+                     *value = key + strlen(key) + 1,
+                     *err = d->configure(handle, key, value);
+
+                if (err) {
+                    if (!quiet)
+                        printf("configure '%s' returned: %s\n", key, err);
+                    free(err);
+                }
+            }
+            break;
+
+          case HEXTER_RECORD_SELECT_PROGRAM:
+            /* reproduce a failed trylock by holding the lock ourselves */
+            if (r->u.program.flags & HEXTER_RECORD_FLAG_PATCHES_BUSY)
+                pthread_mutex_lock(&instance->patches_mutex);
+            d->select_program(handle, r->u.program.bank, r->u.program.program);
+            if (r->u.program.flags & HEXTER_RECORD_FLAG_PATCHES_BUSY)
+                pthread_mutex_unlock(&instance->patches_mutex);
+            break;
+
+          case HEXTER_RECORD_RUN:
+            {
+                unsigned long n = r->u.run.frames,
+                              e = r->u.run.event_count, j;
+                uint32_t hash;
+                double start;
+
+                if (n > output_size) {
+                    output_size = n;
+                    output = (LADSPA_Data *)realloc(output, n * sizeof(LADSPA_Data));
+                }
+                if (e > events_size) {
+                    events_size = e;
+                    events = (snd_seq_event_t *)realloc(events, e * sizeof(snd_seq_event_t));
+                }
+                if (!output || (e && !events) || i + e >= record_count) {
+                    fprintf(stderr, "replay: out of memory or truncated run at sequence %llu\n",
+                            (unsigned long long)r->sequence);
+                    exit(1);
+                }
+                for (j = 0; j < e; j++)
+                    hexter_record_to_event(&records[i + 1 + j].record, &events[j]);
+                d->LADSPA_Plugin->connect_port(handle, HEXTER_PORT_OUTPUT, output);
+                tuning = r->u.run.tuning;
+                volume = r->u.run.volume;
+
+                if (r->u.run.flags & HEXTER_RECORD_FLAG_VOICELIST_BUSY)
+                    pthread_mutex_lock(&instance->voicelist_mutex);
+                if (r->u.run.flags & HEXTER_RECORD_FLAG_PATCHES_BUSY)
+                    pthread_mutex_lock(&instance->patches_mutex);
+                start = cpu_time();
+                d->run_synth(handle, n, events, e);
+                run_time += cpu_time() - start;
+                if (r->u.run.flags & HEXTER_RECORD_FLAG_PATCHES_BUSY)
+                    pthread_mutex_unlock(&instance->patches_mutex);
+                if (r->u.run.flags & HEXTER_RECORD_FLAG_VOICELIST_BUSY)
+                    pthread_mutex_unlock(&instance->voicelist_mutex);
+
+                hash = hexter_record_hash(output, n);
+                if (hash != r->u.run.output_hash) {
+                    if (!mismatches)
+                        first_mismatch = r->sequence;
+                    mismatches++;
+                }
+                checksum = (checksum ^ hash) * 16777619U;
+                if (out)
+                    fwrite(output, sizeof(LADSPA_Data), n, out);
+                runs++;
+                frames += n;
+                i += e;  /* skip the events consumed above */
+            }
+            break;
+
+          case HEXTER_RECORD_EVENT:
+            fprintf(stderr, "replay: stray event record at sequence %llu\n",
+                    (unsigned long long)r->sequence);
+            break;
+
+          case HEXTER_RECORD_LOST:
+            lost += r->u.lost.count;
+            break;
+
+          default:
+            if (!quiet)
+                printf("skipping unknown record type %u\n", r->type);
+            break;
+        }
+    }
+
+    if (handle)
+        d->LADSPA_Plugin->cleanup(handle);
+    if (out)
+        fclose(out);
+
+    printf("replayed %llu runs, %llu frames (%.2f seconds at %lu Hz)\n",
+           runs, frames, sample_rate ? (double)frames / (double)sample_rate : 0.0,
+           sample_rate);
+    printf("run_synth CPU time: %f seconds", run_time);
+    if (run_time > 0.0 && sample_rate)
+        printf(", %.1fx realtime", (double)frames / (double)sample_rate / run_time);
+    printf("\noutput checksum: %08x\n", checksum);
+    if (lost)
+        printf("warning: %llu records were lost while recording, replay may diverge\n", lost);
+    if (mismatches) {
+        printf("output differs from the recorded session in %llu of %llu runs, first at sequence %llu\n",
+               mismatches, runs, (unsigned long long)first_mismatch);
+        return 1;
+    }
+    printf("output matches the recorded session\n");
+    return 0;
+}
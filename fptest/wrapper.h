@@ -43,19 +43,28 @@
 #define dx7_voice_set_data                       FP_TAG(dx7_voice_set_data)
 #define dx7_voice_set_phase                      FP_TAG(dx7_voice_set_phase)
 #define dx7_voice_setup_note                     FP_TAG(dx7_voice_setup_note)
+#define dx7_voice_update_level                   FP_TAG(dx7_voice_update_level)
+#define dx7_voice_update_lod                     FP_TAG(dx7_voice_update_lod)
 #define dx7_voice_update_mod_depths              FP_TAG(dx7_voice_update_mod_depths)
 
 /* in dx7_voice_data.c: */
 #define base64                                   FP_TAG(base64)
 #define decode_7in6                              FP_TAG(decode_7in6)
+#define decode_patch_delta                       FP_TAG(decode_patch_delta)
 #define dssp_error_message                       FP_TAG(dssp_error_message)
 #define dx7_bulk_dump_checksum                   FP_TAG(dx7_bulk_dump_checksum)
 #define dx7_init_performance                     FP_TAG(dx7_init_performance)
 #define dx7_patch_pack                           FP_TAG(dx7_patch_pack)
 #define dx7_patch_unpack                         FP_TAG(dx7_patch_unpack)
 #define dx7_patchbank_load                       FP_TAG(dx7_patchbank_load)
+#define dx7_patchbank_parser_finish              FP_TAG(dx7_patchbank_parser_finish)
+#define dx7_patchbank_parser_init                FP_TAG(dx7_patchbank_parser_init)
+#define dx7_patchbank_parser_pull                FP_TAG(dx7_patchbank_parser_pull)
+#define dx7_patchbank_parser_push                FP_TAG(dx7_patchbank_parser_push)
 #define dx7_voice_copy_name                      FP_TAG(dx7_voice_copy_name)
 #define dx7_voice_init_voice                     FP_TAG(dx7_voice_init_voice)
+#define encode_7in6                              FP_TAG(encode_7in6)
+#define encode_patch_delta                       FP_TAG(encode_patch_delta)
 #define hexter_data_patches_init                 FP_TAG(hexter_data_patches_init)
 #define hexter_data_performance_init             FP_TAG(hexter_data_performance_init)
 
@@ -72,7 +81,7 @@
 #define dx7_voice_eg_rate_decay_percent          FP_TAG(dx7_voice_eg_rate_decay_percent)
 #define dx7_voice_eg_rate_rise_duration          FP_TAG(dx7_voice_eg_rate_rise_duration)
 #define dx7_voice_eg_rate_rise_percent           FP_TAG(dx7_voice_eg_rate_rise_percent)
-#define dx7_voice_init_tables                    FP_TAG(dx7_voice_init_tables)
+#define dx7_voice_feedback_op                    FP_TAG(dx7_voice_feedback_op)
 #define dx7_voice_lfo_frequency                  FP_TAG(dx7_voice_lfo_frequency)
 #define dx7_voice_mss_to_ol_adjustment           FP_TAG(dx7_voice_mss_to_ol_adjustment)
 #define dx7_voice_pitch_level_to_shift           FP_TAG(dx7_voice_pitch_level_to_shift)
@@ -82,8 +91,6 @@
 
 /* in hexter.c: */
 #define dssi_descriptor                          FP_TAG(dssi_descriptor)
-#define dssp_voicelist_mutex_lock                FP_TAG(dssp_voicelist_mutex_lock)
-#define dssp_voicelist_mutex_unlock              FP_TAG(dssp_voicelist_mutex_unlock)
 #define fini                                     FP_TAG(fini)
 #define hexter_configure                         FP_TAG(hexter_configure)
 #define hexter_deactivate                        FP_TAG(hexter_deactivate)
@@ -93,28 +100,100 @@
 #define init                                     FP_TAG(init)
 #define ladspa_descriptor                        FP_TAG(ladspa_descriptor)
 
+/* in hexter_bank.c: */
+#define hexter_bank_builtin                      FP_TAG(hexter_bank_builtin)
+#define hexter_bank_find_section                 FP_TAG(hexter_bank_find_section)
+#define hexter_bank_get                          FP_TAG(hexter_bank_get)
+#define hexter_bank_has_section                  FP_TAG(hexter_bank_has_section)
+#define hexter_bank_key                          FP_TAG(hexter_bank_key)
+#define hexter_bank_patches                      FP_TAG(hexter_bank_patches)
+#define hexter_bank_release                      FP_TAG(hexter_bank_release)
+#define hexter_bank_set_patches                  FP_TAG(hexter_bank_set_patches)
+#define hexter_bank_set_section                  FP_TAG(hexter_bank_set_section)
+
+/* in hexter_budget.c: */
+#define hexter_budget_charge                     FP_TAG(hexter_budget_charge)
+#define hexter_budget_collect                    FP_TAG(hexter_budget_collect)
+#define hexter_budget_count                      FP_TAG(hexter_budget_count)
+#define hexter_budget_find_weaker                FP_TAG(hexter_budget_find_weaker)
+#define hexter_budget_full                       FP_TAG(hexter_budget_full)
+#define hexter_budget_join                       FP_TAG(hexter_budget_join)
+#define hexter_budget_leave                      FP_TAG(hexter_budget_leave)
+#define hexter_budget_publish                    FP_TAG(hexter_budget_publish)
+#define hexter_budget_set_limit                  FP_TAG(hexter_budget_set_limit)
+#define hexter_budget_stamp                      FP_TAG(hexter_budget_stamp)
+
+/* in hexter_library.c: */
+#define hexter_library_builder_add               FP_TAG(hexter_library_builder_add)
+#define hexter_library_builder_add_source        FP_TAG(hexter_library_builder_add_source)
+#define hexter_library_builder_count             FP_TAG(hexter_library_builder_count)
+#define hexter_library_builder_free              FP_TAG(hexter_library_builder_free)
+#define hexter_library_builder_new               FP_TAG(hexter_library_builder_new)
+#define hexter_library_builder_write             FP_TAG(hexter_library_builder_write)
+#define hexter_library_close                     FP_TAG(hexter_library_close)
+#define hexter_library_find_hash                 FP_TAG(hexter_library_find_hash)
+#define hexter_library_find_name                 FP_TAG(hexter_library_find_name)
+#define hexter_library_hash                      FP_TAG(hexter_library_hash)
+#define hexter_library_open                      FP_TAG(hexter_library_open)
+
+/* in hexter_loader.c: */
+#define hexter_loader_start                      FP_TAG(hexter_loader_start)
+#define hexter_loader_stop                       FP_TAG(hexter_loader_stop)
+
 /* in hexter_synth.c: */
+#define dssp_voicelist_mutex_lock                FP_TAG(dssp_voicelist_mutex_lock)
+#define dssp_voicelist_mutex_trylock             FP_TAG(dssp_voicelist_mutex_trylock)
+#define dssp_voicelist_mutex_unlock              FP_TAG(dssp_voicelist_mutex_unlock)
 #define dx7_voice_off                            FP_TAG(dx7_voice_off)
 #define dx7_voice_start_voice                    FP_TAG(dx7_voice_start_voice)
+#define hexter_freeze_free                       FP_TAG(hexter_freeze_free)
+#define hexter_freeze_new                        FP_TAG(hexter_freeze_new)
+#define hexter_instance_allocate_voices          FP_TAG(hexter_instance_allocate_voices)
 #define hexter_instance_all_notes_off            FP_TAG(hexter_instance_all_notes_off)
 #define hexter_instance_all_voices_off           FP_TAG(hexter_instance_all_voices_off)
 #define hexter_instance_channel_pressure         FP_TAG(hexter_instance_channel_pressure)
+#define hexter_instance_configure                FP_TAG(hexter_instance_configure)
 #define hexter_instance_control_change           FP_TAG(hexter_instance_control_change)
 #define hexter_instance_damp_voices              FP_TAG(hexter_instance_damp_voices)
+#define hexter_instance_free                     FP_TAG(hexter_instance_free)
+#define hexter_instance_get_stats                FP_TAG(hexter_instance_get_stats)
+#define hexter_instance_handle_declick           FP_TAG(hexter_instance_handle_declick)
+#define hexter_instance_handle_quality           FP_TAG(hexter_instance_handle_quality)
+#define hexter_instance_handle_lod               FP_TAG(hexter_instance_handle_lod)
+#define hexter_instance_handle_internal_rate     FP_TAG(hexter_instance_handle_internal_rate)
+#define hexter_instance_handle_onset_cache       FP_TAG(hexter_instance_handle_onset_cache)
+#define hexter_instance_handle_wavetable         FP_TAG(hexter_instance_handle_wavetable)
 #define hexter_instance_handle_edit_buffer       FP_TAG(hexter_instance_handle_edit_buffer)
+#define hexter_instance_handle_global_polyphony  FP_TAG(hexter_instance_handle_global_polyphony)
+#define hexter_instance_handle_governor          FP_TAG(hexter_instance_handle_governor)
+#define hexter_instance_handle_library           FP_TAG(hexter_instance_handle_library)
 #define hexter_instance_handle_monophonic        FP_TAG(hexter_instance_handle_monophonic)
+#define hexter_instance_handle_multitimbral      FP_TAG(hexter_instance_handle_multitimbral)
 // #define hexter_instance_handle_nrpn              FP_TAG(hexter_instance_handle_nrpn)
+#define hexter_instance_handle_patch_delta       FP_TAG(hexter_instance_handle_patch_delta)
 #define hexter_instance_handle_patches           FP_TAG(hexter_instance_handle_patches)
+#define hexter_instance_handle_pending_program_change FP_TAG(hexter_instance_handle_pending_program_change)
 #define hexter_instance_handle_performance       FP_TAG(hexter_instance_handle_performance)
 #define hexter_instance_handle_polyphony         FP_TAG(hexter_instance_handle_polyphony)
+#define hexter_instance_handle_snapshot          FP_TAG(hexter_instance_handle_snapshot)
 #define hexter_instance_init_controls            FP_TAG(hexter_instance_init_controls)
 #define hexter_instance_key_pressure             FP_TAG(hexter_instance_key_pressure)
+#define hexter_instance_new                      FP_TAG(hexter_instance_new)
 #define hexter_instance_note_off                 FP_TAG(hexter_instance_note_off)
 #define hexter_instance_note_on                  FP_TAG(hexter_instance_note_on)
+#define hexter_instance_patch_name               FP_TAG(hexter_instance_patch_name)
 #define hexter_instance_pitch_bend               FP_TAG(hexter_instance_pitch_bend)
+#define hexter_instance_render_voices            FP_TAG(hexter_instance_render_voices)
+#define hexter_instance_reset_parts              FP_TAG(hexter_instance_reset_parts)
+#define hexter_instance_restore_snapshot         FP_TAG(hexter_instance_restore_snapshot)
+#define hexter_instance_save_snapshot            FP_TAG(hexter_instance_save_snapshot)
 #define hexter_instance_select_program           FP_TAG(hexter_instance_select_program)
+#define hexter_instance_set_patches              FP_TAG(hexter_instance_set_patches)
 #define hexter_instance_set_performance_data     FP_TAG(hexter_instance_set_performance_data)
-#define hexter_instance_set_program_descriptor   FP_TAG(hexter_instance_set_program_descriptor)
+#define hexter_instance_set_sample_rate          FP_TAG(hexter_instance_set_sample_rate)
+#define hexter_instance_try_select_program       FP_TAG(hexter_instance_try_select_program)
+#define hexter_instance_update_load              FP_TAG(hexter_instance_update_load)
+#define hexter_instance_update_parts             FP_TAG(hexter_instance_update_parts)
 // #define hexter_instance_update_fc                FP_TAG(hexter_instance_update_fc)
 // #define hexter_instance_update_op_param          FP_TAG(hexter_instance_update_op_param)
 #define hexter_synth                             FP_TAG(hexter_synth)
@@ -48,7 +48,9 @@ dx7_voice_new(void)
 {
     dx7_voice_t *voice;
 
-    voice = (dx7_voice_t *)malloc(sizeof(dx7_voice_t));
+    /* zeroed, so that the free-running operator phases of patches without
+     * oscillator key sync start out the same in every run */
+    voice = (dx7_voice_t *)calloc(1, sizeof(dx7_voice_t));
     if (voice) {
         voice->status = DX7_VOICE_OFF;
     }
@@ -839,6 +841,9 @@ dx7_voice_recalculate_freq_and_inc(hexter_instance_t *instance,
     double freq = dx7_voice_recalculate_frequency(instance, voice);
     int i;
 
+    voice->pitch_ramp_duration = 0;
+    voice->wavetable.state = DX7_WAVETABLE_NONE;  /* the pitch has changed */
+    voice->wavetable.steady = 0;
     for (i = 0; i < 6; i++) {
         voice->op[i].frequency = freq;
         dx7_op_recalculate_increment(instance, &voice->op[i]);
@@ -883,6 +888,112 @@ dx7_voice_recalculate_volume(hexter_instance_t *instance, dx7_voice_t *voice)
     }
 }
 
+/*
+ * dx7_op_eg_peak
+ *
+ * return the highest level an envelope will reach before the key is
+ * released: its current value, or, while it is still running through its
+ * first three phases, the highest level still ahead of it.  A DX7 attack
+ * may rise over more than one phase.
+ */
+static dx7_sample_t
+dx7_op_eg_peak(dx7_op_eg_t *eg)
+{
+    dx7_sample_t peak = eg->value;
+    int i;
+
+    if (eg->mode == DX7_EG_RUNNING)
+        for (i = eg->phase; i < 3; i++)
+            if (INT_TO_FP(eg->level[i]) > peak)
+                peak = INT_TO_FP(eg->level[i]);
+    return peak;
+}
+
+/*
+ * dx7_voice_update_level
+ *
+ * update the voice's rough output level estimate, used in choosing which
+ * voice to steal: the sum of its carriers' modulation indices times its
+ * output volume.  Carriers still rising count at the peak of their
+ * envelopes, so a newly started note is not taken for a quiet one.
+ */
+void
+dx7_voice_update_level(dx7_voice_t *voice)
+{
+    int i, b;
+    float level = 0.0f;
+
+    for (i = 0, b = 1; i < MAX_DX7_OPERATORS; i++, b <<= 1) {
+
+        if (!(dx7_voice_carriers[voice->algorithm] & b))
+            continue;
+
+        level += FP_TO_FLOAT(dx7_voice_eg_ol_to_mod_index[FP_TO_INT(dx7_op_eg_peak(&voice->op[i].eg))]);
+    }
+    voice->level = level * voice->volume_value;
+}
+
+/*
+ * dx7_voice_modulation_negligible
+ *
+ * return true if the voice's modulators, and any feedback, are so quiet
+ * that its carriers alone sound the same.  Envelopes still rising count
+ * at their peak.
+ */
+static int
+dx7_voice_modulation_negligible(dx7_voice_t *voice)
+{
+    int i, b;
+    dx7_sample_t eg_value;
+
+    for (i = 0, b = 1; i < MAX_DX7_OPERATORS; i++, b <<= 1) {
+
+        if (dx7_voice_carriers[voice->algorithm] & b)
+            continue;
+
+        eg_value = dx7_op_eg_peak(&voice->op[i].eg);
+        if (FP_TO_FLOAT(dx7_voice_eg_ol_to_mod_index[FP_TO_INT(eg_value)]) >= DX7_LOD_NEGLIGIBLE)
+            return 0;
+    }
+
+    /* feedback on a modulator only modulates that modulator, but a
+     * carrier's own feedback has to die away too */
+    i = dx7_voice_feedback_op[voice->algorithm];
+    if (!(dx7_voice_carriers[voice->algorithm] & (1 << i)))
+        return 1;
+    eg_value = dx7_op_eg_peak(&voice->op[i].eg);
+    return FP_TO_FLOAT(eg_value) * FP_TO_FLOAT(voice->feedback_multiplier) < DX7_LOD_NEGLIGIBLE;
+}
+
+/*
+ * dx7_voice_update_lod
+ *
+ * choose the voice's level of detail from its output level estimate and
+ * the 'lod' thresholds of the instance whose voices it is, with
+ * hysteresis: a voice regains detail once its level, raised by a volume
+ * controller, say, is DX7_LOD_HYSTERESIS above the threshold.  A voice
+ * whose modulators come back to life leaves carriers-only at once.
+ */
+void
+dx7_voice_update_lod(hexter_instance_t *instance, dx7_voice_t *voice)
+{
+    hexter_instance_t *pool = instance->pool;
+    float carriers_level = pool->lod_carriers_level,
+          eco_level = pool->lod_eco_level;
+
+    if (voice->lod == DX7_LOD_CARRIERS)
+        carriers_level *= DX7_LOD_HYSTERESIS;
+    if (voice->lod != DX7_LOD_FULL)
+        eco_level *= DX7_LOD_HYSTERESIS;
+
+    if (voice->level < carriers_level && dx7_voice_modulation_negligible(voice))
+        voice->lod = DX7_LOD_CARRIERS;
+    else if (voice->level < eco_level)
+        voice->lod = DX7_LOD_ECO;
+    else
+        voice->lod = DX7_LOD_FULL;
+}
+
 /* ===== LFO functions ===== */
 
 /* dx7_lfo_set_speed
@@ -962,7 +1073,8 @@ dx7_lfo_set_speed(hexter_instance_t *instance)
         break;
       case 5:  /* sample/hold */
         instance->lfo_phase = 0;
-        instance->lfo_value = FP_RAND();
+        instance->lfo_value = FP_RAND(instance);
+        instance->lfo_target = instance->lfo_value;  /* pitch follows the held value */
         if (period >= (instance->ramp_duration * 4)) {
             instance->lfo_duration0 = period - instance->ramp_duration;
             instance->lfo_duration1 = instance->ramp_duration;
@@ -994,6 +1106,7 @@ dx7_lfo_reset(hexter_instance_t *instance)
     instance->lfo_wave = 1;
     instance->lfo_delay = 255;  /* force setup at first note on */
     instance->lfo_value_for_pitch = 0.0;
+    instance->lfo_random = 1;
     dx7_lfo_set_speed(instance);
 }
 
@@ -1156,7 +1269,7 @@ dx7_lfo_update(hexter_instance_t *instance, unsigned long sample_count)
                 } else {
                     instance->lfo_phase = 1;
                     instance->lfo_duration = instance->lfo_duration1;
-                    instance->lfo_target = FP_RAND();
+                    instance->lfo_target = FP_RAND(instance);
                     instance->lfo_increment = (instance->lfo_target - instance->lfo_value) /
                                                   (dx7_sample_t)instance->lfo_duration;
                 }
@@ -1308,6 +1421,21 @@ dx7_voice_calculate_runtime_parameters(hexter_instance_t *instance, dx7_voice_t*
     voice->mods_serial = instance->mods_serial - 1;  /* force mod depths update */
     dx7_portamento_prepare(instance, voice);
     freq = dx7_voice_recalculate_frequency(instance, voice);
+    voice->pitch_ramp_duration = 0;                  /* no glide from a stolen voice's pitch */
+    voice->wavetable.state = DX7_WAVETABLE_NONE;     /* nor its wavetable */
+    voice->wavetable.steady = 0;
+
+    /* a note that starts from the same state each time, with its
+     * oscillators (and the LFO, if its amplitude follows it) in sync, may
+     * play its onset from the cache */
+    voice->onset.lfo = 0;
+    for (i = 0; i < MAX_DX7_OPERATORS; i++)
+        if (voice->op[i].amp_mod_sens)
+            voice->onset.lfo = 1;
+    voice->onset.state = (instance->pool->onset_cache && voice->osc_key_sync &&
+                          (!voice->onset.lfo || voice->lfo_key_sync) ?
+                              DX7_ONSET_NEW : DX7_ONSET_NONE);
+    voice->onset.position = 0;
 
     voice->volume_value = -1.0f;                     /* force initial setup */
     dx7_voice_recalculate_volume(instance, voice);
@@ -1322,6 +1450,9 @@ dx7_voice_calculate_runtime_parameters(hexter_instance_t *instance, dx7_voice_t*
                                 limit_note(voice->key + voice->transpose - 24),
                                 voice->velocity);
     }
+    dx7_voice_update_level(voice);
+    voice->lod = DX7_LOD_FULL;  /* no hysteresis from the last note */
+    dx7_voice_update_lod(instance, voice);
 }
 
 /*
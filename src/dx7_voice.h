@@ -26,8 +26,6 @@
 #ifndef _DX7_VOICE_H
 #define _DX7_VOICE_H
 
-#include <ladspa.h>
-
 #include "hexter_types.h"
 
 struct _dx7_patch_t
@@ -55,7 +53,7 @@ struct _dx7_patch_t
 #define FP_MULTIPLY(a, b)     ((int32_t)(((int64_t)(a) * (int64_t)(b)) >> FP_SHIFT))
 #define FP_DIVIDE_CEIL(n, d)  (((n) + (d) - 1) / (d))
 #define FP_ABS(x)             (abs(x))
-#define FP_RAND()             (rand() & FP_MASK)
+#define FP_RAND(instance)     ((int32_t)(DX7_LFO_RANDOM(instance) >> (32 - FP_SHIFT)))
 
 #else /* HEXTER_USE_FLOATING_POINT */
 
@@ -69,14 +67,86 @@ struct _dx7_patch_t
 #define FP_MULTIPLY(x, y)     ((x) * (y))
 #define FP_DIVIDE_CEIL(n, d)  (lrintf((n) / (d) + 0.5f));
 #define FP_ABS(x)             (fabsf(x))
-#define FP_RAND()             ((float)rand() / (float)RAND_MAX)
+#define FP_RAND(instance)     ((float)(DX7_LFO_RANDOM(instance) >> 8) * (1.0f / 16777216.0f))
 
 #endif /* ! HEXTER_USE_FLOATING_POINT */
 
+/* The sample-and-hold LFO's random numbers come from a generator in each
+ * instance, reseeded by dx7_lfo_reset(), rather than from rand(), whose
+ * state every instance, on whatever thread, would share. */
+#define DX7_LFO_RANDOM(instance) \
+    ((instance)->lfo_random = (instance)->lfo_random * 1664525u + 1013904223u)
+
 #define SINE_SHIFT       12
 #define SINE_SIZE        (1<<SINE_SHIFT)
 #define SINE_MASK        (SINE_SIZE-1)
 
+/* Render quality, per instance ('configure quality').  Eco takes the
+ * nearest sine table entry, and updates envelopes, amplitude modulation
+ * and modulation indices only every DX7_ECO_STEP samples; standard is the
+ * original kernel; high interpolates the sine table in the fixed-point
+ * build too, and glides operator pitches between control updates rather
+ * than stepping them.  A glide rises for the first DX7_GLIDE_RISE samples
+ * of the nugget, past the new pitch, and falls back to it over the rest,
+ * so that each operator's phase at the end of the nugget is exactly where
+ * the stepped pitch puts it: high quality refines standard's pitch
+ * trajectory rather than lagging it. */
+#define DX7_QUALITY_ECO       0
+#define DX7_QUALITY_STANDARD  1
+#define DX7_QUALITY_HIGH      2
+
+#define DX7_QUALITY_CARRIERS  (-1) /* level of detail only: eco, with the carriers alone */
+
+#define DX7_ECO_STEP          8  /* must be a power of two */
+
+#define DX7_GLIDE_RISE        (HEXTER_NUGGET_SIZE / 2)
+#define DX7_GLIDE_FALL        (HEXTER_NUGGET_SIZE - 1 - DX7_GLIDE_RISE)
+
+/* A voice's level of detail ('configure lod'): voices whose output level
+ * estimate falls below the instance's thresholds render at eco quality,
+ * or, if their modulators and feedback have also died away to next to
+ * nothing, with their carriers alone.  A voice only regains detail once
+ * its level has risen DX7_LOD_HYSTERESIS above the threshold it fell
+ * below, so one hovering at a threshold does not switch back and forth. */
+#define DX7_LOD_FULL          0
+#define DX7_LOD_ECO           1
+#define DX7_LOD_CARRIERS      2
+
+#define DX7_LOD_HYSTERESIS    1.4125f  /* 3dB */
+#define DX7_LOD_NEGLIGIBLE    0.002f   /* modulation, in cycles of phase, that leaves no audible sidebands */
+
+/* Steady-state wavetables ('configure wavetable on'): a held voice with
+ * its envelopes sustaining, no LFO modulation, and all operators at whole
+ * (or half) frequency ratios without fine frequency or detune, puts out a
+ * strictly periodic waveform.  Once a voice has been steady for
+ * DX7_WAVETABLE_SETTLE nuggets, one period of it is captured, a little
+ * each nugget, into a table of a power of two size, at least
+ * DX7_WAVETABLE_OVERSAMPLE times the period in samples, which is then
+ * played back instead of the operators until anything changes.  Since the
+ * table steps through the period more finely than the operators do, the
+ * one-sample feedback loop comes out differently there, so voices with
+ * strong feedback are left to the operators. */
+#define DX7_WAVETABLE_MIN_SIZE      256
+#define DX7_WAVETABLE_MAX_SIZE      2048
+#define DX7_WAVETABLE_OVERSAMPLE    4
+#define DX7_WAVETABLE_SETTLE        4
+#define DX7_WAVETABLE_WARMUP        64   /* entries rendered first, to settle feedback */
+#define DX7_WAVETABLE_CAPTURE_STEP  128  /* entries captured per nugget */
+#define DX7_WAVETABLE_FEEDBACK_MAX  56   /* highest feedback operator EG level */
+
+/* Note-onset cache (see hexter_onset.h): a voice set up with its
+ * oscillators keyed in sync, and its LFO too if its amplitude follows it,
+ * looks its first burst up in the cache, then plays the entry it finds or
+ * records a new one. */
+#define DX7_ONSET_NONE       0
+#define DX7_ONSET_NEW        1   /* set up, not yet rendered */
+#define DX7_ONSET_PLAYING    2
+#define DX7_ONSET_RECORDING  3
+
+#define DX7_WAVETABLE_NONE          0
+#define DX7_WAVETABLE_CAPTURING     1
+#define DX7_WAVETABLE_PLAYING       2
+
 enum dx7_eg_mode {
     DX7_EG_FINISHED,
     DX7_EG_RUNNING,
@@ -140,6 +210,9 @@ struct _dx7_op_t   /* operator */
     double        frequency;
     dx7_sample_t  phase;
     dx7_sample_t  phase_increment;
+    dx7_sample_t  phase_increment_delta;   /* high quality pitch glide: per-sample change, */
+    dx7_sample_t  phase_increment_target;  /*   where it ends, */
+    dx7_sample_t  phase_target;            /*   and the phase it ends on */
 
     dx7_op_eg_t eg;
 
@@ -158,6 +231,32 @@ struct _dx7_op_t   /* operator */
     uint8_t     detune;
 };
 
+struct _dx7_wavetable_t   /* steady-state wavetable */
+{
+    int           state;        /* DX7_WAVETABLE_* */
+    int           steady;       /* nuggets the voice has been steady for */
+    int           quality;      /* DX7_QUALITY_* captured at */
+    int32_t       size;         /* entries per period, a power of two */
+    int           shift;        /* 32 - log2(size) */
+    int32_t       captured;     /* entries captured, counting from DX7_WAVETABLE_WARMUP before the end */
+    dx7_sample_t  phase[MAX_DX7_OPERATORS];  /* operator phases at the first entry, */
+    dx7_sample_t  step[MAX_DX7_OPERATORS];   /*   and their increments per entry */
+    dx7_sample_t  feedback;     /* as of the last entry captured */
+    uint32_t      position;     /* in the period, 2^32 per period */
+    uint32_t      increment;    /*   and per sample */
+    float         table[DX7_WAVETABLE_MAX_SIZE + 1];  /* one period, then the first entry again */
+};
+
+struct _dx7_onset_t   /* a voice's place in the note-onset cache */
+{
+    int           state;        /* DX7_ONSET_* */
+    int           lfo;          /* true if its amplitude follows the LFO */
+    hexter_onset_entry_t *entry;
+    unsigned int  generation;   /* of the entry when taken */
+    int           record;       /* next burst to play */
+    unsigned long position;     /* samples rendered since the note started */
+};
+
 enum dx7_lfo_status
 {
     DX7_LFO_DELAY,
@@ -181,6 +280,7 @@ struct _dx7_voice_t
     hexter_instance_t *instance;
 
     unsigned int     note_id;
+    uint32_t         budget_stamp;  /* place among all note-ons, for the global voice budget */
 
     unsigned char    status;
     unsigned char    key;
@@ -191,6 +291,7 @@ struct _dx7_voice_t
     dx7_op_t         op[MAX_DX7_OPERATORS];
 
     double           last_pitch;
+    int32_t          pitch_ramp_duration;  /* samples left in a high quality pitch glide */
     dx7_pitch_eg_t   pitch_eg;
     dx7_portamento_t portamento;
     float            last_port_tuning;
@@ -238,25 +339,37 @@ struct _dx7_voice_t
     int32_t          volume_duration;
     float            volume_increment;
     float            volume_target;
+    float            level;       /* rough output level estimate, updated each nugget, for voice stealing */
+    int              lod;         /* DX7_LOD_*, chosen from level each nugget */
+
+    dx7_onset_t      onset;       /* not part of the state the onset cache keys on */
+    dx7_wavetable_t  wavetable;   /* last, so the voice state before it can be saved alone */
 };
 
+/* the voice state the note-onset cache hashes and restores: all of it
+ * from the operators through the level of detail */
+#define DX7_VOICE_STATE_OFFSET  offsetof(dx7_voice_t, op)
+#define DX7_VOICE_STATE_SIZE    (offsetof(dx7_voice_t, onset) - DX7_VOICE_STATE_OFFSET)
+
 #define _PLAYING(voice)    ((voice)->status != DX7_VOICE_OFF)
 #define _ON(voice)         ((voice)->status == DX7_VOICE_ON)
 #define _SUSTAINED(voice)  ((voice)->status == DX7_VOICE_SUSTAINED)
 #define _RELEASED(voice)   ((voice)->status == DX7_VOICE_RELEASED)
 #define _AVAILABLE(voice)  ((voice)->status == DX7_VOICE_OFF)
 
-extern dx7_sample_t  dx7_voice_sin_table[SINE_SIZE + 1];
+/* dx7_voice_tables.c */
+extern const dx7_sample_t  dx7_voice_sin_table[SINE_SIZE + 1];
 
-extern uint8_t       dx7_voice_carriers[32];
-extern float         dx7_voice_carrier_count[32];
+extern const uint8_t       dx7_voice_carriers[32];
+extern const float         dx7_voice_carrier_count[32];
+extern const uint8_t       dx7_voice_feedback_op[32];
 
-extern dx7_sample_t *dx7_voice_eg_ol_to_mod_index;
-extern float         dx7_voice_velocity_ol_adjustment[128];
-extern float         dx7_voice_lfo_frequency[128];
-extern float         dx7_voice_pms_to_semitones[8];
-extern float         dx7_voice_amd_to_ol_adjustment[100];
-extern float         dx7_voice_mss_to_ol_adjustment[16];
+extern const dx7_sample_t *dx7_voice_eg_ol_to_mod_index;
+extern const float         dx7_voice_velocity_ol_adjustment[128];
+extern const float         dx7_voice_lfo_frequency[128];
+extern const float         dx7_voice_pms_to_semitones[8];
+extern const float         dx7_voice_amd_to_ol_adjustment[100];
+extern const float         dx7_voice_mss_to_ol_adjustment[16];
 
 /* dx7_voice.c */
 dx7_voice_t *dx7_voice_new(void);
@@ -293,6 +406,8 @@ void    dx7_voice_recalculate_freq_and_inc(hexter_instance_t *instance,
                                            dx7_voice_t *voice);
 void    dx7_voice_recalculate_volume(hexter_instance_t *instance,
                                      dx7_voice_t *voice);
+void    dx7_voice_update_level(dx7_voice_t *voice);
+void    dx7_voice_update_lod(hexter_instance_t *instance, dx7_voice_t *voice);
 void    dx7_lfo_reset(hexter_instance_t *instance);
 void    dx7_lfo_set(hexter_instance_t *instance, dx7_voice_t *voice);
 void    dx7_lfo_update(hexter_instance_t *instance,
@@ -306,10 +421,7 @@ void    dx7_voice_set_data(hexter_instance_t *instance, dx7_voice_t *voice);
 
 /* dx7_voice_render.c */
 void    dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
-                         LADSPA_Data *out, unsigned long sample_count,
+                         float *out, unsigned long sample_count,
                          int do_control_update);
 
-/* dx7_voice_tables.c */
-void    dx7_voice_init_tables(void);
-
 #endif /* _DX7_VOICE_H */
@@ -28,7 +28,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <stdarg.h>
+#include <errno.h>
 
 #include "hexter_types.h"
 #include "dx7_voice.h"
@@ -224,24 +226,157 @@ double dx7_voice_pitch_level_to_shift[128] = {
 
 };
 
-char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* value of each base64[] character, or 0xff for any other character
+ * (including the terminating null) */
+static const uint8_t base64_value[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/*
+ * encode_7in6
+ *
+ * Encode a block of 7-bit data, in base64-ish style, into 'buffer', which
+ * must hold at least ENCODE_7IN6_SIZE(length) characters, and return the
+ * length of the resulting string.  The format is the data length in
+ * decimal, a space, the data packed six bits to the character, most
+ * significant first, a space, and the sum of the data in decimal.  Each
+ * six bytes (42 bits) pack exactly into seven characters, so the data is
+ * handled a group at a time, with any final partial group padded with
+ * zero bits.
+ */
+int
+encode_7in6(const uint8_t *data, int length, char *buffer)
+{
+    char *out;
+    unsigned int sum = 0;
+    uint64_t reg;
+    int i, n;
+
+    out = buffer + sprintf(buffer, "%d ", length);
+
+    for (; length >= 6; data += 6, length -= 6, out += 7) {
+        reg = ((uint64_t)(data[0] & 0x7f) << 35) |
+              ((uint64_t)(data[1] & 0x7f) << 28) |
+              ((uint64_t)(data[2] & 0x7f) << 21) |
+              ((uint64_t)(data[3] & 0x7f) << 14) |
+              ((uint64_t)(data[4] & 0x7f) <<  7) |
+               (uint64_t)(data[5] & 0x7f);
+        sum += data[0] + data[1] + data[2] + data[3] + data[4] + data[5];
+        out[0] = base64[(reg >> 36) & 0x3f];
+        out[1] = base64[(reg >> 30) & 0x3f];
+        out[2] = base64[(reg >> 24) & 0x3f];
+        out[3] = base64[(reg >> 18) & 0x3f];
+        out[4] = base64[(reg >> 12) & 0x3f];
+        out[5] = base64[(reg >>  6) & 0x3f];
+        out[6] = base64[reg & 0x3f];
+    }
+    if (length) {
+        reg = 0;
+        for (i = 0; i < length; i++) {
+            reg |= (uint64_t)(data[i] & 0x7f) << (35 - 7 * i);
+            sum += data[i];
+        }
+        n = (length * 7 + 5) / 6;
+        for (i = 0; i < n; i++)
+            out[i] = base64[(reg >> (36 - 6 * i)) & 0x3f];
+        out += n;
+    }
+
+    return out - buffer + sprintf(out, " %u", sum);
+}
+
+/*
+ * decode_7in6_data
+ *
+ * Decode 'length' bytes from the (at least (length * 7 + 5) / 6) characters
+ * at 'string', storing them at 'data' unless it is NULL, and return their
+ * sum, or -1 if any character is illegal.
+ */
+static long
+decode_7in6_data(const char *string, int length, uint8_t *data)
+{
+    const uint8_t *in = (const uint8_t *)string;
+    unsigned long sum = 0;
+    uint64_t reg;
+    uint8_t bad;
+    int i, n;
+
+    for (; length >= 6; in += 7, length -= 6) {
+        bad = base64_value[in[0]] | base64_value[in[1]] | base64_value[in[2]] |
+              base64_value[in[3]] | base64_value[in[4]] | base64_value[in[5]] |
+              base64_value[in[6]];
+        if (bad & 0x80)
+            return -1;
+        reg = ((uint64_t)base64_value[in[0]] << 36) |
+              ((uint64_t)base64_value[in[1]] << 30) |
+              ((uint64_t)base64_value[in[2]] << 24) |
+              ((uint64_t)base64_value[in[3]] << 18) |
+              ((uint64_t)base64_value[in[4]] << 12) |
+              ((uint64_t)base64_value[in[5]] <<  6) |
+               (uint64_t)base64_value[in[6]];
+        sum += ((reg >> 35) & 0x7f) + ((reg >> 28) & 0x7f) + ((reg >> 21) & 0x7f) +
+               ((reg >> 14) & 0x7f) + ((reg >>  7) & 0x7f) + (reg & 0x7f);
+        if (data) {
+            data[0] = (reg >> 35) & 0x7f;
+            data[1] = (reg >> 28) & 0x7f;
+            data[2] = (reg >> 21) & 0x7f;
+            data[3] = (reg >> 14) & 0x7f;
+            data[4] = (reg >>  7) & 0x7f;
+            data[5] = reg & 0x7f;
+            data += 6;
+        }
+    }
+    if (length) {
+        reg = 0;
+        n = (length * 7 + 5) / 6;
+        for (i = 0; i < n; i++) {
+            if (base64_value[in[i]] & 0x80)
+                return -1;
+            reg |= (uint64_t)base64_value[in[i]] << (36 - 6 * i);
+        }
+        for (i = 0; i < length; i++) {
+            sum += (reg >> (35 - 7 * i)) & 0x7f;
+            if (data)
+                data[i] = (reg >> (35 - 7 * i)) & 0x7f;
+        }
+    }
+
+    return (long)sum;
+}
 
 /*
  * decode_7in6
  *
- * decode a block of base64-ish 7-bit encoded data
+ * Decode a block of base64-ish 7-bit encoded data, as written by
+ * encode_7in6(), into 'data', returning 1 on success.  If the string is
+ * malformed or fails its checksum, 0 is returned and 'data' is left
+ * untouched: the string is checked in a first pass that stores nothing,
+ * which costs far less than allocating somewhere to decode it to.
  */
 int
 decode_7in6(const char *string, int expected_length, uint8_t *data)
 {
-    int in, stated_length, reg, above, below, shift, out;
-    char *p;
-    uint8_t *tmpdata;
+    int in, stated_length, encoded_length;
     int string_length = strlen(string);
-    unsigned int sum = 0, stated_sum;
-
-    if (string_length < 6)
-        return 0;  /* too short */
+    char *p;
+    long sum;
 
     stated_length = strtol(string, &p, 10);
     in = p - string;
@@ -251,52 +386,92 @@ decode_7in6(const char *string, int expected_length, uint8_t *data)
     if (stated_length != expected_length)
         return 0;
 
-    if (string_length - in < ((expected_length * 7 + 5) / 6))
+    encoded_length = (expected_length * 7 + 5) / 6;
+    if (string_length - in < encoded_length)
         return 0;  /* encoded data too short */
 
-    if (!(tmpdata = (uint8_t *)malloc(expected_length)))
-        return 0;  /* out of memory */
-
-    reg = above = below = out = 0;
-    while (1) {
-        if (above == 7) {
-            tmpdata[out] = reg >> 6;
-            sum += tmpdata[out];
-            reg &= 0x3f;
-            above = 0;
-            if (++out == expected_length)
-                break;
-        }
-        if (below == 0) {
-            if (!(p = strchr(base64, string[in]))) {
-                return 0;  /* illegal character */
-            }
-            reg |= p - base64;
-            below = 6;
-            in++;
-        }
-        shift = 7 - above;
-        if (below < shift) shift = below;
-        reg <<= shift;
-        above += shift;
-        below -= shift;
-    }
+    sum = decode_7in6_data(string + in, expected_length, NULL);
+    if (sum < 0)
+        return 0;  /* illegal character */
 
-    if (string[in++] != ' ') {  /* encoded data wrong length */
-        free(tmpdata);
+    if (string[in + encoded_length] != ' ')
+        return 0;  /* encoded data wrong length */
+
+    if ((unsigned int)sum != (unsigned int)strtol(string + in + encoded_length + 1, &p, 10))
         return 0;
+
+    decode_7in6_data(string + in, expected_length, data);
+
+    return 1;
+}
+
+/*
+ * encode_patch_delta
+ *
+ * write a patch delta holding 'count' (at most PATCH_DELTA_MAX) of the
+ * 128 'patches', those numbered in 'numbers', into 'buffer', which must
+ * hold PATCH_DELTA_SIZE characters, and return the length of the string
+ */
+int
+encode_patch_delta(unsigned long version, int count, const uint8_t *numbers,
+                   dx7_patch_t *patches, char *buffer)
+{
+    uint8_t data[PATCH_DELTA_MAX * DX7_VOICE_SIZE_PACKED];
+    char *out = buffer;
+    int i;
+
+    out += sprintf(out, "%lu", version);
+    if (!count)
+        return out - buffer;
+    for (i = 0; i < count; i++) {
+        out += sprintf(out, "%c%d", (i ? ',' : ' '), numbers[i]);
+        memcpy(data + i * DX7_VOICE_SIZE_PACKED, &patches[numbers[i]],
+               DX7_VOICE_SIZE_PACKED);
     }
+    *out++ = ' ';
+    return out - buffer + encode_7in6(data, count * DX7_VOICE_SIZE_PACKED, out);
+}
 
-    stated_sum = strtol(string + in, &p, 10);
-    if (sum != stated_sum) {
-        free(tmpdata);
+/*
+ * decode_patch_delta
+ *
+ * Parse a patch delta, setting '*version', storing the patch numbers in
+ * 'numbers' and the patches in 'patches', each of which must have room for
+ * PATCH_DELTA_MAX.  Returns the number of patches, or -1 if the delta is
+ * malformed.
+ */
+int
+decode_patch_delta(const char *string, unsigned long *version,
+                   uint8_t *numbers, dx7_patch_t *patches)
+{
+    const char *p = string;
+    char *end;
+    long number;
+    int count = 0;
+
+    *version = strtoul(p, &end, 10);
+    if (end == p)
+        return -1;
+    p = end;
+    if (!*p)
         return 0;
-    }
+    if (*p != ' ')
+        return -1;
 
-    memcpy(data, tmpdata, expected_length);
-    free(tmpdata);
+    do {
+        p++;
+        number = strtol(p, &end, 10);
+        if (end == p || number < 0 || number > 127 || count == PATCH_DELTA_MAX)
+            return -1;
+        numbers[count++] = number;
+        p = end;
+    } while (*p == ',');
+    if (*p != ' ')
+        return -1;
 
-    return 1;
+    if (!decode_7in6(p + 1, count * DX7_VOICE_SIZE_PACKED, (uint8_t *)patches))
+        return -1;
+    return count;
 }
 
 /*
@@ -453,3 +628,491 @@ hexter_data_performance_init(uint8_t *performance)
 {
     memcpy(performance, &dx7_init_performance, DX7_PERFORMANCE_SIZE);
 }
+
+/*
+ * dx7_bulk_dump_checksum
+ */
+int
+dx7_bulk_dump_checksum(uint8_t *data, int length)
+{
+    int sum = 0;
+    int i;
+
+    for (i = 0; i < length; sum -= data[i++]);
+    return sum & 0x7F;
+}
+
+/* ==== streaming patch bank parser ==== */
+
+#define DX7_PATCHBANK_UNDECIDED   0
+#define DX7_PATCHBANK_SYSEX       1
+#define DX7_PATCHBANK_RECORDS     2
+
+#define DX7_SYSEX_IDLE            0
+#define DX7_SYSEX_LENGTH          1   /* skipping a MIDI file event length */
+#define DX7_SYSEX_DATA            2
+
+#define DX7_PATCHBANK_READ_SIZE   65536
+
+static int
+filename_has_extension(const char *filename, const char *extension)
+{
+    size_t length;
+
+    if (!filename)
+        return 0;
+    length = strlen(filename);
+    return (length >= 4 && !strcasecmp(filename + length - 4, extension));
+}
+
+static void
+dx7_patchbank_set_records(dx7_patchbank_parser_t *parser, unsigned long start,
+                          unsigned long stride, unsigned long size,
+                          unsigned long count)
+{
+    parser->layout = DX7_PATCHBANK_RECORDS;
+    parser->record_start = start;
+    parser->record_stride = stride;
+    parser->record_size = size;
+    parser->record_count = count;
+}
+
+/*
+ * dx7_patchbank_parser_init
+ *
+ * filename and file_length are only used to recognize layouts which
+ * can't be told by their contents; they may be NULL and -1.
+ */
+void
+dx7_patchbank_parser_init(dx7_patchbank_parser_t *parser, const char *filename,
+                          long file_length)
+{
+    memset(parser, 0, offsetof(dx7_patchbank_parser_t, record));
+    parser->sysex_state = DX7_SYSEX_IDLE;
+    parser->sysex_length = 0;
+    parser->pending_first = 0;
+    parser->pending_count = 0;
+    parser->file_length = file_length;
+
+    if ((filename_has_extension(filename, ".tx7") ||
+         filename_has_extension(filename, ".snd")) && file_length == 8192) {
+
+        /* Dr.T and Steinberg TX7: a bank followed by performance data */
+        dx7_patchbank_set_records(parser, 0, 128, 128, 32);
+
+    } else if (filename_has_extension(filename, ".bnk") && file_length == 8192) {
+
+        /* Transform XSyn: 256-byte records */
+        dx7_patchbank_set_records(parser, 0, 256, 128, 32);
+
+    } else if (filename_has_extension(filename, ".snd") && file_length == 5216) {
+
+        /* Steinberg Synthworks DX7 SND */
+        dx7_patchbank_set_records(parser, 0, 128, 128, 32);
+
+    } else if (filename_has_extension(filename, ".dx2") && file_length == 326454) {
+
+        /* Yamaha DX200 editor: 381-byte records in a different order */
+        dx7_patchbank_set_records(parser, 34, 381, 381, 128);
+    }
+}
+
+/*
+ * dx7_patchbank_choose_layout
+ */
+static void
+dx7_patchbank_choose_layout(dx7_patchbank_parser_t *parser)
+{
+    uint8_t *head = parser->head;
+    size_t i;
+
+    if (parser->layout != DX7_PATCHBANK_UNDECIDED)
+        return;
+
+    /* Voyetra SIDEMAN DX/TX, Voyetra Patchmaster DX7/TX7 */
+    if ((parser->file_length == 9816 || parser->file_length == 5663) &&
+        parser->head_length >= 4 &&
+        head[0] == 0xdf && head[1] == 0x05 && head[2] == 0x01 && head[3] == 0x00) {
+        dx7_patchbank_set_records(parser, 0x60f, 128, 128, 32);
+        return;
+    }
+
+    /* standard MIDI file */
+    if (parser->head_length >= 4 && !memcmp(head, "MThd", 4)) {
+        parser->layout = DX7_PATCHBANK_SYSEX;
+        parser->midi_file = 1;
+        return;
+    }
+
+    /* Raw DX7/TX7 data is all 7-bit, so a status byte means sys-ex. */
+    for (i = 0; i < parser->head_length; i++) {
+        if (head[i] & 0x80) {
+            parser->layout = DX7_PATCHBANK_SYSEX;
+            return;
+        }
+    }
+    /* assume raw DX7/TX7 data if no SysEx header was found. */
+    /* assume the user knows what he is doing ;-) */
+    dx7_patchbank_set_records(parser, 0, 128, 128, ~0UL);
+}
+
+/*
+ * dx2_record_convert
+ *
+ * convert a Yamaha DX200 editor voice record to a packed DX7 patch
+ */
+static void
+dx2_record_convert(const uint8_t *record, uint8_t *patch)
+{
+    int op, i;
+    uint8_t v;
+
+    for (op = 0; op < 6; op++) {
+        const uint8_t *r = record + 35 * op;
+        uint8_t *p = patch + 17 * (5 - op);
+
+        for (i = 0; i < 8; i++)
+            p[i] = r[76 + i];
+        p[8] = r[84] - 21;
+        p[9] = r[87];
+        p[10] = r[88];
+        p[11] = r[85] + r[86] * 4;
+        p[12] = r[89] + r[75] * 8;
+        v = r[71];
+        if (v > 3)
+            v = 3;
+        p[13] = v / 2 + r[91] * 4;
+        p[14] = r[90];
+        p[15] = r[72] + r[73] * 2;
+        p[16] = r[74];
+    }
+    for (i = 0; i < 4; i++)
+        patch[102 + i] = record[26 + i];
+    for (i = 0; i < 4; i++)
+        patch[106 + i] = record[32 + i];
+    patch[110] = record[17];
+    patch[111] = record[18] + record[38] * 8;
+    for (i = 0; i < 4; i++)
+        patch[112 + i] = record[20 + i];
+    patch[116] = record[24] + record[19] * 2 + record[25] * 16;
+    patch[117] = record[37] - 36;
+    for (i = 0; i < 10; i++)
+        patch[118 + i] = record[i];
+}
+
+/*
+ * dx7_patchbank_parse_records
+ *
+ * parse fixed-size records, returning after each one completed
+ */
+static size_t
+dx7_patchbank_parse_records(dx7_patchbank_parser_t *parser,
+                            const uint8_t *data, size_t length)
+{
+    size_t done = 0, n;
+    unsigned long position;
+
+    while (done < length) {
+        if (parser->records_done >= parser->record_count) {
+            parser->complete = 1;
+            return length;
+        }
+        if (parser->offset < parser->record_start) {  /* skip header */
+            n = parser->record_start - parser->offset;
+            if (n > length - done)
+                n = length - done;
+        } else {
+            position = (parser->offset - parser->record_start) % parser->record_stride;
+            if (position < parser->record_size) {
+                n = parser->record_size - position;
+                if (n > length - done)
+                    n = length - done;
+                memcpy(parser->record + position, data + done, n);
+                if (position + n == parser->record_size) {
+                    if (parser->record_size == DX7_PATCHBANK_RECORD_SIZE)
+                        dx2_record_convert(parser->record, parser->pending);
+                    else
+                        memcpy(parser->pending, parser->record, DX7_VOICE_SIZE_PACKED);
+                    parser->pending_first = 0;
+                    parser->pending_count = 1;
+                    parser->records_done++;
+                    parser->offset += n;
+                    return done + n;
+                }
+            } else {  /* skip the rest of the record */
+                n = parser->record_stride - position;
+                if (n > length - done)
+                    n = length - done;
+            }
+        }
+        parser->offset += n;
+        done += n;
+    }
+    return done;
+}
+
+/*
+ * dx7_patchbank_sysex_end
+ *
+ * check a complete sys-ex message for DX7 voice data, returning non-zero
+ * if it had some
+ */
+static int
+dx7_patchbank_sysex_end(dx7_patchbank_parser_t *parser)
+{
+    uint8_t *sysex = parser->sysex;
+
+    if (parser->sysex_length == DX7_DUMP_SIZE_VOICE_BULK &&
+        sysex[1] == 0x43 &&
+        sysex[2] <= 0x0f &&
+        sysex[3] == 0x09 &&
+        sysex[5] == 0x00) {  /* DX7 32 voice dump */
+
+        memcpy(parser->pending, sysex + 6, 32 * DX7_VOICE_SIZE_PACKED);
+        parser->pending_first = 0;
+        parser->pending_count = 32;
+        return 1;
+
+    } else if (parser->sysex_length == DX7_DUMP_SIZE_VOICE_SINGLE &&
+               sysex[1] == 0x43 &&
+               sysex[2] <= 0x0f &&
+               sysex[4] == 0x01 &&
+               sysex[5] == 0x1b) {  /* DX7 single voice (edit buffer) dump */
+
+        dx7_patch_pack(sysex + 6, (dx7_patch_t *)parser->pending, 0);
+        parser->pending_first = 0;
+        parser->pending_count = 1;
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * dx7_patchbank_parse_sysex
+ *
+ * scan for sys-ex messages, returning after each one that held patches
+ */
+static size_t
+dx7_patchbank_parse_sysex(dx7_patchbank_parser_t *parser,
+                          const uint8_t *data, size_t length)
+{
+    size_t done = 0;
+    const uint8_t *p;
+
+    while (done < length) {
+        switch (parser->sysex_state) {
+
+          case DX7_SYSEX_IDLE:
+            p = (const uint8_t *)memchr(data + done, 0xf0, length - done);
+            if (!p)
+                return length;
+            done = p - data + 1;
+            parser->sysex[0] = 0xf0;
+            parser->sysex_length = 1;
+            parser->sysex_state = (parser->midi_file ? DX7_SYSEX_LENGTH : DX7_SYSEX_DATA);
+            break;
+
+          case DX7_SYSEX_LENGTH:
+            if (!(data[done++] & 0x80))
+                parser->sysex_state = DX7_SYSEX_DATA;
+            break;
+
+          case DX7_SYSEX_DATA:
+            while (done < length && !(data[done] & 0x80) &&
+                   parser->sysex_length < DX7_DUMP_SIZE_VOICE_BULK - 1)
+                parser->sysex[parser->sysex_length++] = data[done++];
+            if (done == length)
+                return done;
+            parser->sysex_state = DX7_SYSEX_IDLE;
+            if (data[done] == 0xf7) {
+                done++;
+                parser->sysex[parser->sysex_length++] = 0xf7;
+                if (dx7_patchbank_sysex_end(parser))
+                    return done;
+            }
+            /* otherwise the message is too long for DX7 voice data, or
+             * was cut short by another status byte, which may begin the
+             * next message */
+            break;
+        }
+    }
+    return done;
+}
+
+static size_t
+dx7_patchbank_parse(dx7_patchbank_parser_t *parser, const uint8_t *data,
+                    size_t length)
+{
+    if (parser->layout == DX7_PATCHBANK_RECORDS)
+        return dx7_patchbank_parse_records(parser, data, length);
+    else
+        return dx7_patchbank_parse_sysex(parser, data, length);
+}
+
+/*
+ * dx7_patchbank_replay_head
+ *
+ * parse the bytes held while the layout was chosen, returning non-zero
+ * once they are all parsed
+ */
+static int
+dx7_patchbank_replay_head(dx7_patchbank_parser_t *parser)
+{
+    if (parser->layout == DX7_PATCHBANK_UNDECIDED)
+        return 0;
+    while (parser->head_replayed < parser->head_length) {
+        if (parser->pending_count)
+            return 0;
+        parser->head_replayed +=
+            dx7_patchbank_parse(parser, parser->head + parser->head_replayed,
+                                parser->head_length - parser->head_replayed);
+    }
+    return 1;
+}
+
+/*
+ * dx7_patchbank_parser_push
+ *
+ * Parse up to length bytes, returning how many were used.  This stops
+ * short when patches are waiting to be pulled, so pull them all before
+ * pushing the rest.
+ */
+size_t
+dx7_patchbank_parser_push(dx7_patchbank_parser_t *parser, const uint8_t *data,
+                          size_t length)
+{
+    size_t done = 0;
+
+    if (parser->complete)
+        return length;
+
+    if (parser->head_length < DX7_PATCHBANK_HEAD_SIZE) {
+        done = DX7_PATCHBANK_HEAD_SIZE - parser->head_length;
+        if (done > length)
+            done = length;
+        memcpy(parser->head + parser->head_length, data, done);
+        parser->head_length += done;
+        if (parser->head_length < DX7_PATCHBANK_HEAD_SIZE)
+            return done;
+        dx7_patchbank_choose_layout(parser);
+    }
+    if (!dx7_patchbank_replay_head(parser))
+        return done;
+
+    while (done < length && !parser->pending_count && !parser->complete)
+        done += dx7_patchbank_parse(parser, data + done, length - done);
+
+    return (parser->complete ? length : done);
+}
+
+/*
+ * dx7_patchbank_parser_finish
+ *
+ * signal the end of the data; any patches it completed can then be pulled
+ */
+void
+dx7_patchbank_parser_finish(dx7_patchbank_parser_t *parser)
+{
+    dx7_patchbank_choose_layout(parser);
+}
+
+/*
+ * dx7_patchbank_parser_pull
+ *
+ * copy the next complete patch to *patch and return 1, or return 0 if
+ * more data must be pushed first
+ */
+int
+dx7_patchbank_parser_pull(dx7_patchbank_parser_t *parser, dx7_patch_t *patch)
+{
+    if (!parser->pending_count)
+        dx7_patchbank_replay_head(parser);
+    if (!parser->pending_count)
+        return 0;
+
+    memcpy(patch, parser->pending + parser->pending_first * DX7_VOICE_SIZE_PACKED,
+           DX7_VOICE_SIZE_PACKED);
+    parser->pending_first++;
+    parser->pending_count--;
+    return 1;
+}
+
+/*
+ * dx7_patchbank_load
+ */
+int
+dx7_patchbank_load(const char *filename, dx7_patch_t *firstpatch,
+                   int maxpatches, char **errmsg)
+{
+    FILE *fp;
+    long filelength;
+    dx7_patchbank_parser_t *parser;
+    uint8_t *buffer;
+    size_t length, done;
+    int count = 0;
+
+    /* this needs to 1) open and parse the file, 2a) if it's good, copy up
+     * to maxpatches patches beginning at firstpath, and not touch errmsg,
+     * 2b) if it's not good, set errmsg to a malloc'd error message that
+     * the caller must free. */
+
+    if ((fp = fopen(filename, "rb")) == NULL) {
+        if (errmsg) *errmsg = dssp_error_message("could not open file '%s' for reading: %s", filename, strerror(errno));
+        return 0;
+    }
+
+    /* the length is only needed to recognize some layouts, so it need not
+     * be seekable */
+    if (fseek(fp, 0, SEEK_END) ||
+        (filelength = ftell(fp)) == -1 ||
+        fseek(fp, 0, SEEK_SET)) {
+        filelength = -1;
+        clearerr(fp);
+    }
+    if (filelength == 0) {
+        if (errmsg) *errmsg = strdup("patch file has zero length");
+        fclose(fp);
+        return 0;
+    } else if (filelength > 0 && filelength < 128) {
+        if (errmsg) *errmsg = strdup ("patch file is too small");
+        fclose (fp);
+        return 0;
+    }
+
+    parser = (dx7_patchbank_parser_t *)malloc(sizeof(dx7_patchbank_parser_t));
+    buffer = (uint8_t *)malloc(DX7_PATCHBANK_READ_SIZE);
+    if (!parser || !buffer) {
+        if (errmsg) *errmsg = strdup("couldn't allocate memory for patch file parser");
+        free(parser);
+        free(buffer);
+        fclose(fp);
+        return 0;
+    }
+    dx7_patchbank_parser_init(parser, filename, filelength);
+
+    while (count < maxpatches && !parser->complete &&
+           (length = fread(buffer, 1, DX7_PATCHBANK_READ_SIZE, fp)) > 0) {
+        for (done = 0; done < length && count < maxpatches; ) {
+            done += dx7_patchbank_parser_push(parser, buffer + done, length - done);
+            while (count < maxpatches &&
+                   dx7_patchbank_parser_pull(parser, &firstpatch[count]))
+                count++;
+        }
+    }
+    if (ferror(fp)) {
+        if (errmsg) *errmsg = dssp_error_message("error reading patch file: %s", strerror(errno));
+        count = 0;
+    } else {
+        dx7_patchbank_parser_finish(parser);
+        while (count < maxpatches &&
+               dx7_patchbank_parser_pull(parser, &firstpatch[count]))
+            count++;
+        if (count == 0 && errmsg)
+            *errmsg = strdup("no patches found in patch file");
+    }
+
+    free(buffer);
+    free(parser);
+    fclose(fp);
+    return count;
+}
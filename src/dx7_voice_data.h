@@ -21,8 +21,73 @@
 #ifndef _DX7_VOICE_DATA_H
 #define _DX7_VOICE_DATA_H
 
+#include <stddef.h>
+
 #include "hexter_types.h"
 
+/* Streaming patch bank parser.  Bytes of a patch bank file are pushed in
+ * with dx7_patchbank_parser_push(), in pieces of any size, and the patches
+ * found are pulled out with dx7_patchbank_parser_pull() as they complete,
+ * so a file of any size is parsed in one pass through a fixed-size parser.
+ * Recognized are DX7 32-voice bulk and single-voice sys-ex dumps, whether
+ * bare, concatenated, or inside a standard MIDI file, raw 4096-byte banks,
+ * and the TX7, BNK, SND, DX2 and Voyetra layouts (which are detected by
+ * file name and length, when these are given). */
+
+#define DX7_PATCHBANK_HEAD_SIZE    128   /* bytes examined to choose a layout */
+#define DX7_PATCHBANK_RECORD_SIZE  381   /* largest fixed-size record, a DX2 voice */
+
+/* characters needed to encode_7in6() 'length' bytes: the two decimal
+ * numbers and their spaces, the packed data, and the terminating null */
+#define ENCODE_7IN6_SIZE(length)  (25 + ((length) * 7 + 5) / 6)
+
+/* A patch delta, sent with the 'patch_delta' configure key, carries just
+ * some of the 128 patches: a version number, a space, the comma-separated
+ * numbers of the patches, a space, and the patches encode_7in6()'d in that
+ * order.  With no patches, it is the version number alone.  A UI keeps its
+ * delta cumulative -- all the patches changed since each one's section was
+ * last sent in full with 'patchesN' -- so that the last delta and the
+ * 'patchesN' values a host keeps for session restore together give the
+ * current patches, in whichever order the host sends them back, and sends a section in full instead once more than
+ * PATCH_DELTA_SECTION_MAX of its patches have changed. */
+#define PATCH_DELTA_SECTION_MAX   8
+#define PATCH_DELTA_MAX           (4 * PATCH_DELTA_SECTION_MAX)
+#define PATCH_DELTA_SIZE          (12 + 4 * PATCH_DELTA_MAX + \
+                                   ENCODE_7IN6_SIZE(PATCH_DELTA_MAX * DX7_VOICE_SIZE_PACKED))
+
+typedef struct _dx7_patchbank_parser_t dx7_patchbank_parser_t;
+
+struct _dx7_patchbank_parser_t
+{
+    int             layout;
+    int             midi_file;         /* sys-ex events carry a length */
+    int             complete;          /* no more patches can follow */
+    long            file_length;       /* or -1 if unknown */
+
+    uint8_t         head[DX7_PATCHBANK_HEAD_SIZE];
+    size_t          head_length;
+    size_t          head_replayed;     /* head bytes parsed since the layout was chosen */
+
+    /* fixed-size record layouts */
+    uint64_t        offset;
+    unsigned long   record_start;
+    unsigned long   record_stride;
+    unsigned long   record_size;
+    unsigned long   record_count;
+    unsigned long   records_done;
+    uint8_t         record[DX7_PATCHBANK_RECORD_SIZE];
+
+    /* sys-ex layouts */
+    int             sysex_state;
+    int             sysex_length;
+    uint8_t         sysex[DX7_DUMP_SIZE_VOICE_BULK];
+
+    /* patches waiting to be pulled */
+    int             pending_first;
+    int             pending_count;
+    uint8_t         pending[32 * DX7_VOICE_SIZE_PACKED];
+};
+
 /* dx7_voice_data.c */
 extern dx7_patch_t dx7_voice_init_voice;
 extern uint8_t     dx7_init_performance[DX7_PERFORMANCE_SIZE];
@@ -31,10 +96,16 @@ extern float       dx7_voice_eg_rate_decay_duration[128];
 extern float       dx7_voice_eg_rate_rise_percent[128];
 extern float       dx7_voice_eg_rate_decay_percent[128];
 extern double      dx7_voice_pitch_level_to_shift[128];
-extern char        base64[];
+extern const char  base64[];
 
 char *dssp_error_message(const char *fmt, ...);
+int  encode_7in6(const uint8_t *data, int length, char *buffer);
 int  decode_7in6(const char *string, int expected_length, uint8_t *data);
+int  encode_patch_delta(unsigned long version, int count,
+                        const uint8_t *numbers, dx7_patch_t *patches,
+                        char *buffer);
+int  decode_patch_delta(const char *string, unsigned long *version,
+                        uint8_t *numbers, dx7_patch_t *patches);
 void dx7_voice_copy_name(char *name, dx7_patch_t *patch);
 void dx7_patch_unpack(dx7_patch_t *packed_patch, uint8_t number,
                       uint8_t *unpacked_patch);
@@ -42,5 +113,15 @@ void dx7_patch_pack(uint8_t *unpacked_patch, dx7_patch_t *packed_patch,
                     uint8_t number);
 void hexter_data_patches_init(dx7_patch_t *patches);
 void hexter_data_performance_init(uint8_t *performance);
+int  dx7_bulk_dump_checksum(uint8_t *data, int length);
+int  dx7_patchbank_load(const char *filename, dx7_patch_t *firstpatch,
+                        int maxpatches, char **errmsg);
+void dx7_patchbank_parser_init(dx7_patchbank_parser_t *parser,
+                               const char *filename, long file_length);
+size_t dx7_patchbank_parser_push(dx7_patchbank_parser_t *parser,
+                                 const uint8_t *data, size_t length);
+void dx7_patchbank_parser_finish(dx7_patchbank_parser_t *parser);
+int  dx7_patchbank_parser_pull(dx7_patchbank_parser_t *parser,
+                               dx7_patch_t *patch);
 
 #endif /* _DX7_VOICE_DATA_H */
@@ -30,24 +30,27 @@
 #define _DEFAULT_SOURCE 1
 #define _ISOC99_SOURCE  1
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 
 #include "hexter_types.h"
 #include "hexter.h"
 #include "hexter_synth.h"
 #include "dx7_voice.h"
+#include "hexter_onset.h"
 
+/* use eg_value to look up the modulation index, with interpolation */
 static inline dx7_sample_t
-dx7_op_calculate_operator(dx7_sample_t eg_value, dx7_sample_t phase)
+dx7_op_mod_index(dx7_sample_t eg_value)
 {
     int32_t index;
-    dx7_sample_t mod_index, out;
+    dx7_sample_t mod_index;
 #ifdef HEXTER_USE_FLOATING_POINT
     float frac;
 #endif /* HEXTER_USE_FLOATING_POINT */
 
-    /* use eg_value to look up the modulation index, with interpolation */
 #ifndef HEXTER_USE_FLOATING_POINT
     index = FP_TO_INT(eg_value);
     mod_index = dx7_voice_eg_ol_to_mod_index[index];
@@ -60,15 +63,42 @@ dx7_op_calculate_operator(dx7_sample_t eg_value, dx7_sample_t phase)
     mod_index += (dx7_voice_eg_ol_to_mod_index[index + 1] - mod_index) * frac;
 #endif /* HEXTER_USE_FLOATING_POINT */
 
-    /* use phase to look up the oscillator output, with interpolation */
+    return mod_index;
+}
+
+/* use phase to look up the oscillator output: eco quality takes the
+ * nearest table entry, the others interpolate */
+static inline dx7_sample_t
+dx7_op_sine(const int quality, dx7_sample_t phase)
+{
+    int32_t index;
+    dx7_sample_t out;
+#ifdef HEXTER_USE_FLOATING_POINT
+    float frac;
+#endif /* HEXTER_USE_FLOATING_POINT */
+
 #ifndef HEXTER_USE_FLOATING_POINT
+    if (quality <= DX7_QUALITY_ECO) {
+        index = (((uint32_t)phase + (FP_TO_SINE_SIZE >> 1)) >> FP_TO_SINE_SHIFT) & SINE_MASK;
+        return dx7_voice_sin_table[index];
+    }
     index = ((uint32_t)phase >> FP_TO_SINE_SHIFT) & SINE_MASK;
     out = dx7_voice_sin_table[index];
-    out += (((int64_t)(dx7_voice_sin_table[index + 1] - out) *
-             (int64_t)(phase & FP_TO_SINE_MASK)) >>
-            (FP_SHIFT + FP_TO_SINE_SHIFT));
+    if (quality == DX7_QUALITY_HIGH)
+        out += (((int64_t)(dx7_voice_sin_table[index + 1] - out) *
+                 (int64_t)(phase & FP_TO_SINE_MASK)) >> FP_TO_SINE_SHIFT);
+    else
+        /* The extra FP_SHIFT here shifts out all of the interpolation, so
+         * standard quality in fact rounds the phase down to the table.  That
+         * is how the fixed-point build has always sounded, so it stays; high
+         * quality interpolates. */
+        out += (((int64_t)(dx7_voice_sin_table[index + 1] - out) *
+                 (int64_t)(phase & FP_TO_SINE_MASK)) >>
+                (FP_SHIFT + FP_TO_SINE_SHIFT));
 #else /* HEXTER_USE_FLOATING_POINT */
     phase *= (float)SINE_SIZE;
+    if (quality <= DX7_QUALITY_ECO)
+        return dx7_voice_sin_table[lrintf(phase) & SINE_MASK];
     index = lrintf(phase - 0.5f);
     frac = phase - (float)index;
     index &= SINE_MASK;
@@ -76,50 +106,25 @@ dx7_op_calculate_operator(dx7_sample_t eg_value, dx7_sample_t phase)
     out += (dx7_voice_sin_table[index + 1] - out) * frac;
 #endif /* HEXTER_USE_FLOATING_POINT */
 
+    return out;
+}
+
+static inline dx7_sample_t
+dx7_op_calculate_operator(const int quality, dx7_sample_t mod_index, dx7_sample_t phase)
+{
     /* return the product of modulation index and oscillator output */
-    return FP_MULTIPLY(mod_index, out);
+    return FP_MULTIPLY(mod_index, dx7_op_sine(quality, phase));
 }
 
 static inline dx7_sample_t
-dx7_op_calculate_operator_saving_feedback(dx7_voice_t *voice, dx7_sample_t eg_value,
+dx7_op_calculate_operator_saving_feedback(const int quality, dx7_voice_t *voice,
+                                          dx7_sample_t eg_value, dx7_sample_t mod_index,
                                           dx7_sample_t phase)
 {
-    int32_t index;
-    dx7_sample_t mod_index, out;
-#ifndef HEXTER_USE_FLOATING_POINT
-    int64_t out64;
-#else /* HEXTER_USE_FLOATING_POINT */
-    float frac;
-#endif /* HEXTER_USE_FLOATING_POINT */
-
-    /* use eg_value to look up the modulation index, with interpolation */
-#ifndef HEXTER_USE_FLOATING_POINT
-    index = FP_TO_INT(eg_value);
-    mod_index = dx7_voice_eg_ol_to_mod_index[index];
-    mod_index += FP_MULTIPLY(dx7_voice_eg_ol_to_mod_index[index + 1] - mod_index,
-                             eg_value & FP_MASK);
-#else /* HEXTER_USE_FLOATING_POINT */
-    index = lrintf(eg_value - 0.5f);
-    frac = eg_value - (float)index;
-    mod_index = dx7_voice_eg_ol_to_mod_index[index];
-    mod_index += (dx7_voice_eg_ol_to_mod_index[index + 1] - mod_index) * frac;
-#endif /* HEXTER_USE_FLOATING_POINT */
-
-    /* use phase to look up the oscillator output, with interpolation */
 #ifndef HEXTER_USE_FLOATING_POINT
-    index = ((uint32_t)phase >> FP_TO_SINE_SHIFT) & SINE_MASK;
-    out = dx7_voice_sin_table[index];
-    out64 = out +
-            (((int64_t)(dx7_voice_sin_table[index + 1] - out) *
-              (int64_t)(phase & FP_TO_SINE_MASK)) >>
-             (FP_SHIFT + FP_TO_SINE_SHIFT));
+    int64_t out64 = dx7_op_sine(quality, phase);
 #else /* HEXTER_USE_FLOATING_POINT */
-    phase *= (float)SINE_SIZE;
-    index = lrintf(phase - 0.5f);
-    frac = phase - (float)index;
-    index &= SINE_MASK;
-    out = dx7_voice_sin_table[index];
-    out += (dx7_voice_sin_table[index + 1] - out) * frac;
+    dx7_sample_t out = dx7_op_sine(quality, phase);
 #endif /* HEXTER_USE_FLOATING_POINT */
 
     /* save that output, scaled by our eg level, feedback amount, and a
@@ -164,6 +169,37 @@ dx7_op_eg_process(hexter_instance_t *instance, dx7_op_eg_t *eg)
     }
 }
 
+/* eco quality: advance an envelope by 'steps' samples at once */
+static inline void
+dx7_op_eg_process_steps(hexter_instance_t *instance, dx7_op_eg_t *eg, int32_t steps)
+{
+    while (eg->duration > 0 && eg->duration <= steps) {
+
+        eg->value += eg->increment * eg->duration;
+        steps -= eg->duration;
+
+        if (eg->mode != DX7_EG_RUNNING) {
+            eg->duration = -1;
+            break;
+        }
+
+        if (eg->in_precomp) {
+
+            eg->in_precomp = 0;
+            eg->duration = eg->postcomp_duration;
+            eg->increment = eg->postcomp_increment;
+
+        } else {
+
+            dx7_op_eg_set_next_phase(instance, eg);
+        }
+    }
+
+    eg->value += eg->increment * steps;
+    if (eg->duration > 0)
+        eg->duration -= steps;
+}
+
 static inline void
 dx7_op_eg_adjust(dx7_op_eg_t *eg)
 {
@@ -273,25 +309,69 @@ double_equality(double a, double b)
 }
 
 /*
- * dx7_voice_render
+ * dx7_voice_render_algorithm
  *
- * generate the actual sound data for this voice
+ * the sample loop of dx7_voice_render(), at one quality; it is always
+ * inlined, with a constant 'quality', so that each quality gets a loop of
+ * its own with the quality tests folded away
  */
-void
-dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
-                 LADSPA_Data *out, unsigned long sample_count,
-                 int do_control_update)
+/*
+ * dx7_voice_glide
+ *
+ * advance a high quality pitch glide by a sample: past its peak, turn it
+ * towards the new pitch, and at its end, land each operator on the phase
+ * the stepped pitch would have reached
+ */
+static inline void
+dx7_voice_glide(dx7_voice_t *voice)
+{
+    int k;
+
+    if (--voice->pitch_ramp_duration) {
+        if (voice->pitch_ramp_duration == DX7_GLIDE_FALL) {
+            for (k = 0; k < MAX_DX7_OPERATORS; k++)
+                voice->op[k].phase_increment_delta =
+                    (voice->op[k].phase_increment_target -
+                     voice->op[k].phase_increment) / DX7_GLIDE_FALL;
+        }
+        for (k = 0; k < MAX_DX7_OPERATORS; k++)
+            voice->op[k].phase_increment += voice->op[k].phase_increment_delta;
+    } else {
+        for (k = 0; k < MAX_DX7_OPERATORS; k++) {
+            voice->op[k].phase_increment = voice->op[k].phase_increment_target;
+            voice->op[k].phase = voice->op[k].phase_target;
+        }
+    }
+}
+
+static inline void __attribute__((always_inline))
+dx7_voice_render_algorithm(hexter_instance_t *instance, dx7_voice_t *voice,
+                           float *out, unsigned long sample_count,
+                           const int quality)
 {
     unsigned long       sample;
-    static dx7_sample_t ampmod[4] = { 0 };
+    dx7_sample_t        ampmod[4] = { 0 };  /* not static: engines may render on several threads */
+    dx7_sample_t        eg_value[MAX_DX7_OPERATORS],   /* eco quality: held for */
+                        mod_index[MAX_DX7_OPERATORS];  /*   DX7_ECO_STEP samples */
     dx7_sample_t        i;
     dx7_sample_t        output;
+    int                 k;
 
-    if (!float_equality(voice->last_port_volume, *instance->volume) ||
-        voice->last_cc_volume != instance->cc_volume)
-        dx7_voice_recalculate_volume(instance, voice);
+#ifndef HEXTER_USE_FLOATING_POINT
+#define AMPMOD2_CONSTANT  (7726076 >> (24 - FP_SHIFT))  /* 0.460510 */
+#define AMPMOD1_CONSTANT  (3993950 >> (24 - FP_SHIFT))  /* 0.238058 */
+#else /* HEXTER_USE_FLOATING_POINT */
+#define AMPMOD2_CONSTANT  (0.460510f)
+#define AMPMOD1_CONSTANT  (0.238058f)
+#endif /* HEXTER_USE_FLOATING_POINT */
+
+    /* an operator's envelope level less amplitude modulation, and the
+     * modulation index that gives */
+#define EG_VALUE(_i)   (quality <= DX7_QUALITY_ECO ? eg_value[_i] : \
+                        voice->op[_i].eg.value - ampmod[voice->op[_i].amp_mod_sens])
+#define MOD_INDEX(_i)  (quality <= DX7_QUALITY_ECO ? mod_index[_i] : dx7_op_mod_index(EG_VALUE(_i)))
 
-    switch (voice->algorithm) {
+    switch (quality == DX7_QUALITY_CARRIERS ? -1 : voice->algorithm) {
 
       case 0: /* algorithm 1 */
 
@@ -299,37 +379,42 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
 
         for (sample = 0; sample < sample_count; sample++) {
 
-            /* calculate amplitude modulation amounts */
-            i = FP_MULTIPLY(voice->amp_mod_lfo_amd_value, voice->lfo_delay_value);
-            i = voice->amp_mod_env_value +
-                    FP_MULTIPLY(i + voice->amp_mod_lfo_mods_value, instance->lfo_buffer[sample]);
-
-#ifndef HEXTER_USE_FLOATING_POINT
-#define AMPMOD2_CONSTANT  (7726076 >> (24 - FP_SHIFT))  /* 0.460510 */
-#define AMPMOD1_CONSTANT  (3993950 >> (24 - FP_SHIFT))  /* 0.238058 */
-#else /* HEXTER_USE_FLOATING_POINT */
-#define AMPMOD2_CONSTANT  (0.460510f)
-#define AMPMOD1_CONSTANT  (0.238058f)
-#endif /* HEXTER_USE_FLOATING_POINT */
-            ampmod[3] = i;
-            ampmod[2] = FP_MULTIPLY(i, AMPMOD2_CONSTANT);
-            ampmod[1] = FP_MULTIPLY(i, AMPMOD1_CONSTANT);
+            /* calculate amplitude modulation amounts, which at eco quality,
+             * with the modulation indices, are only updated every
+             * DX7_ECO_STEP samples */
+            if (quality > DX7_QUALITY_ECO || !(sample & (DX7_ECO_STEP - 1))) {
+                i = FP_MULTIPLY(voice->amp_mod_lfo_amd_value, voice->lfo_delay_value);
+                i = voice->amp_mod_env_value +
+                        FP_MULTIPLY(i + voice->amp_mod_lfo_mods_value, instance->lfo_buffer[sample]);
+
+                ampmod[3] = i;
+                ampmod[2] = FP_MULTIPLY(i, AMPMOD2_CONSTANT);
+                ampmod[1] = FP_MULTIPLY(i, AMPMOD1_CONSTANT);
+
+                if (quality <= DX7_QUALITY_ECO) {
+                    for (k = 0; k < MAX_DX7_OPERATORS; k++) {
+                        eg_value[k] = voice->op[k].eg.value - ampmod[voice->op[k].amp_mod_sens];
+                        mod_index[k] = dx7_op_mod_index(eg_value[k]);
+                    }
+                }
+            }
 
             output = (
-                      dx7_op_calculate_operator(voice->op[OP_3].eg.value - ampmod[voice->op[OP_3].amp_mod_sens],
+                      dx7_op_calculate_operator(quality, MOD_INDEX(OP_3),
                                                 voice->op[OP_3].phase +
-                                                dx7_op_calculate_operator(voice->op[OP_4].eg.value - ampmod[voice->op[OP_4].amp_mod_sens],
+                                                dx7_op_calculate_operator(quality, MOD_INDEX(OP_4),
                                                                           voice->op[OP_4].phase +
-                                                                          dx7_op_calculate_operator(voice->op[OP_5].eg.value - ampmod[voice->op[OP_5].amp_mod_sens],
+                                                                          dx7_op_calculate_operator(quality, MOD_INDEX(OP_5),
                                                                                                     voice->op[OP_5].phase +
                                                                                                     /* -FIX- need to determine if amp mod is included in feedback, or after */
-                                                                                                    dx7_op_calculate_operator_saving_feedback(voice,
-                                                                                                                                              voice->op[OP_6].eg.value - ampmod[voice->op[OP_6].amp_mod_sens],
+                                                                                                    dx7_op_calculate_operator_saving_feedback(quality, voice,
+                                                                                                                                              EG_VALUE(OP_6),
+                                                                                                                                              MOD_INDEX(OP_6),
                                                                                                                                               voice->op[OP_6].phase +
                                                                                                                                               voice->feedback)))) +
-                      dx7_op_calculate_operator(voice->op[OP_1].eg.value - ampmod[voice->op[OP_1].amp_mod_sens],
+                      dx7_op_calculate_operator(quality, MOD_INDEX(OP_1),
                                                 voice->op[OP_1].phase +
-                                                dx7_op_calculate_operator(voice->op[OP_2].eg.value - ampmod[voice->op[OP_2].amp_mod_sens],
+                                                dx7_op_calculate_operator(quality, MOD_INDEX(OP_2),
                                                                           voice->op[OP_2].phase))
                      );
             /* voice->volume_value contains a scaling factor for the number of carriers */
@@ -345,12 +430,21 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
             voice->op[OP_2].phase += voice->op[OP_2].phase_increment;
             voice->op[OP_1].phase += voice->op[OP_1].phase_increment;
 
-            dx7_op_eg_process(instance, &voice->op[OP_6].eg);
-            dx7_op_eg_process(instance, &voice->op[OP_5].eg);
-            dx7_op_eg_process(instance, &voice->op[OP_4].eg);
-            dx7_op_eg_process(instance, &voice->op[OP_3].eg);
-            dx7_op_eg_process(instance, &voice->op[OP_2].eg);
-            dx7_op_eg_process(instance, &voice->op[OP_1].eg);
+            /* at high quality, glide to the pitch of the last control update */
+            if (quality == DX7_QUALITY_HIGH && voice->pitch_ramp_duration)
+                dx7_voice_glide(voice);
+
+            if (quality > DX7_QUALITY_ECO) {
+                dx7_op_eg_process(instance, &voice->op[OP_6].eg);
+                dx7_op_eg_process(instance, &voice->op[OP_5].eg);
+                dx7_op_eg_process(instance, &voice->op[OP_4].eg);
+                dx7_op_eg_process(instance, &voice->op[OP_3].eg);
+                dx7_op_eg_process(instance, &voice->op[OP_2].eg);
+                dx7_op_eg_process(instance, &voice->op[OP_1].eg);
+            } else if ((sample & (DX7_ECO_STEP - 1)) == DX7_ECO_STEP - 1) {
+                for (k = 0; k < MAX_DX7_OPERATORS; k++)
+                    dx7_op_eg_process_steps(instance, &voice->op[k].eg, DX7_ECO_STEP);
+            }
 
             if (voice->amp_mod_env_duration) {
                 voice->amp_mod_env_value += voice->amp_mod_env_increment;
@@ -381,18 +475,26 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
         break;
 
       /* Now we'll use some macros to make it easier to read */
-#define op(_i, _p)     dx7_op_calculate_operator(voice->op[_i].eg.value - ampmod[voice->op[_i].amp_mod_sens], voice->op[_i].phase + _p)
-#define op_sfb(_i, _p) dx7_op_calculate_operator_saving_feedback(voice, voice->op[_i].eg.value - ampmod[voice->op[_i].amp_mod_sens], voice->op[_i].phase + _p)
+#define op(_i, _p)     dx7_op_calculate_operator(quality, MOD_INDEX(_i), voice->op[_i].phase + _p)
+#define op_sfb(_i, _p) dx7_op_calculate_operator_saving_feedback(quality, voice, EG_VALUE(_i), MOD_INDEX(_i), voice->op[_i].phase + _p)
 
 #define RENDER \
         for (sample = 0; sample < sample_count; sample++) { \
             /* calculate amplitude modulation amounts */ \
-            i = FP_MULTIPLY(voice->amp_mod_lfo_amd_value, voice->lfo_delay_value); \
-            i = voice->amp_mod_env_value + \
-                    FP_MULTIPLY(i + voice->amp_mod_lfo_mods_value, instance->lfo_buffer[sample]); \
-            ampmod[3] = i; \
-            ampmod[2] = FP_MULTIPLY(i, AMPMOD2_CONSTANT); \
-            ampmod[1] = FP_MULTIPLY(i, AMPMOD1_CONSTANT); \
+            if (quality > DX7_QUALITY_ECO || !(sample & (DX7_ECO_STEP - 1))) { \
+                i = FP_MULTIPLY(voice->amp_mod_lfo_amd_value, voice->lfo_delay_value); \
+                i = voice->amp_mod_env_value + \
+                        FP_MULTIPLY(i + voice->amp_mod_lfo_mods_value, instance->lfo_buffer[sample]); \
+                ampmod[3] = i; \
+                ampmod[2] = FP_MULTIPLY(i, AMPMOD2_CONSTANT); \
+                ampmod[1] = FP_MULTIPLY(i, AMPMOD1_CONSTANT); \
+                if (quality <= DX7_QUALITY_ECO) { \
+                    for (k = 0; k < MAX_DX7_OPERATORS; k++) { \
+                        eg_value[k] = voice->op[k].eg.value - ampmod[voice->op[k].amp_mod_sens]; \
+                        mod_index[k] = dx7_op_mod_index(eg_value[k]); \
+                    } \
+                } \
+            } \
             ALGORITHM; \
             /* voice->volume_value contains a scaling factor for the number of carriers */ \
             /* mix voice output into output buffer */ \
@@ -404,12 +506,19 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
             voice->op[OP_3].phase += voice->op[OP_3].phase_increment; \
             voice->op[OP_2].phase += voice->op[OP_2].phase_increment; \
             voice->op[OP_1].phase += voice->op[OP_1].phase_increment; \
-            dx7_op_eg_process(instance, &voice->op[OP_6].eg); \
-            dx7_op_eg_process(instance, &voice->op[OP_5].eg); \
-            dx7_op_eg_process(instance, &voice->op[OP_4].eg); \
-            dx7_op_eg_process(instance, &voice->op[OP_3].eg); \
-            dx7_op_eg_process(instance, &voice->op[OP_2].eg); \
-            dx7_op_eg_process(instance, &voice->op[OP_1].eg); \
+            if (quality == DX7_QUALITY_HIGH && voice->pitch_ramp_duration) \
+                dx7_voice_glide(voice); \
+            if (quality > DX7_QUALITY_ECO) { \
+                dx7_op_eg_process(instance, &voice->op[OP_6].eg); \
+                dx7_op_eg_process(instance, &voice->op[OP_5].eg); \
+                dx7_op_eg_process(instance, &voice->op[OP_4].eg); \
+                dx7_op_eg_process(instance, &voice->op[OP_3].eg); \
+                dx7_op_eg_process(instance, &voice->op[OP_2].eg); \
+                dx7_op_eg_process(instance, &voice->op[OP_1].eg); \
+            } else if ((sample & (DX7_ECO_STEP - 1)) == DX7_ECO_STEP - 1) { \
+                for (k = 0; k < MAX_DX7_OPERATORS; k++) \
+                    dx7_op_eg_process_steps(instance, &voice->op[k].eg, DX7_ECO_STEP); \
+            } \
             if (voice->amp_mod_env_duration) { \
                 voice->amp_mod_env_value += voice->amp_mod_env_increment; \
                 voice->amp_mod_env_duration--; \
@@ -870,6 +979,19 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
         break;
 #undef ALGORITHM
 
+      case -1: /* level of detail: the carriers alone, unmodulated */
+
+#define ALGORITHM { \
+            output = 0;                                  \
+            for (k = 0; k < MAX_DX7_OPERATORS; k++)      \
+                if (dx7_voice_carriers[voice->algorithm] & (1 << k)) \
+                    output += op(k, 0);                  \
+        }
+
+        RENDER;
+        break;
+#undef ALGORITHM
+
       case 31: /* algorithm 32 */
       default: /* just in case */
 
@@ -890,15 +1012,495 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
 
 #undef op
 #undef op_sfb
+#undef RENDER
+    }
+#undef EG_VALUE
+#undef MOD_INDEX
+
+    /* at eco quality, catch the envelopes up with any samples since their
+     * last step */
+    if (quality <= DX7_QUALITY_ECO && (sample_count & (DX7_ECO_STEP - 1))) {
+        for (k = 0; k < MAX_DX7_OPERATORS; k++)
+            dx7_op_eg_process_steps(instance, &voice->op[k].eg,
+                                    sample_count & (DX7_ECO_STEP - 1));
+    }
+}
+
+/*
+ * dx7_voice_render_operators
+ *
+ * run the voice's operators for 'sample_count' samples at 'quality',
+ * adding their output to 'out'
+ */
+static void
+dx7_voice_render_operators(hexter_instance_t *instance, dx7_voice_t *voice,
+                           float *out, unsigned long sample_count, int quality)
+{
+    switch (quality) {
+      case DX7_QUALITY_CARRIERS:
+        dx7_voice_render_algorithm(instance, voice, out, sample_count, DX7_QUALITY_CARRIERS);
+        break;
+      case DX7_QUALITY_ECO:
+        dx7_voice_render_algorithm(instance, voice, out, sample_count, DX7_QUALITY_ECO);
+        break;
+      case DX7_QUALITY_HIGH:
+        dx7_voice_render_algorithm(instance, voice, out, sample_count, DX7_QUALITY_HIGH);
+        break;
+      default:
+        dx7_voice_render_algorithm(instance, voice, out, sample_count, DX7_QUALITY_STANDARD);
+        break;
+    }
+}
+
+/* ===== steady-state wavetables ===== */
+
+/*
+ * dx7_voice_is_steady
+ *
+ * return true if the voice's output is strictly periodic: held, with its
+ * envelopes sustaining, no pitch or amplitude modulation changing, and
+ * all operators at whole or half frequency ratios -- and without so much
+ * feedback that a wavetable would misrepresent it
+ */
+static inline int
+dx7_voice_is_steady(dx7_voice_t *voice)
+{
+    int i, amp_mod_sens = 0;
+
+    if (!_ON(voice) ||
+        voice->pitch_eg.mode == DX7_EG_RUNNING || voice->portamento.segment ||
+        voice->pitch_ramp_duration ||
+        voice->pitch_mod_depth_pmd != 0.0 || voice->pitch_mod_depth_mods != 0.0 ||
+        voice->amp_mod_env_duration || voice->amp_mod_lfo_mods_duration ||
+        voice->amp_mod_lfo_amd_duration)
+        return 0;
+
+    for (i = 0; i < MAX_DX7_OPERATORS; i++) {
+        dx7_op_t *op = &voice->op[i];
+
+        if ((op->eg.mode != DX7_EG_SUSTAINING && op->eg.mode != DX7_EG_CONSTANT) ||
+            op->osc_mode || op->fine || op->detune != 7)
+            return 0;
+        amp_mod_sens |= op->amp_mod_sens;
+    }
+
+    if (voice->feedback_multiplier &&
+        voice->op[dx7_voice_feedback_op[voice->algorithm]].eg.value >
+            INT_TO_FP(DX7_WAVETABLE_FEEDBACK_MAX))
+        return 0;
+
+    /* LFO amplitude modulation matters only to sensitive operators */
+    return !amp_mod_sens || (voice->amp_mod_lfo_amd_value == INT_TO_FP(0) &&
+                             voice->amp_mod_lfo_mods_value == INT_TO_FP(0));
+}
+
+/*
+ * dx7_voice_wavetable_capture
+ *
+ * capture up to 'count' more entries of the voice's wavetable, by running
+ * its operators with their phases and increments set for the table, then
+ * putting the voice's own state back
+ */
+static void
+dx7_voice_wavetable_capture(hexter_instance_t *instance, dx7_voice_t *voice,
+                            int32_t count)
+{
+    dx7_wavetable_t *wt = &voice->wavetable;
+    unsigned char saved[offsetof(dx7_voice_t, wavetable)];
+    int32_t entry, n;
+    int k;
+
+    memcpy(saved, voice, sizeof(saved));
+    voice->feedback = wt->feedback;
+    voice->volume_value = 1.0f;
+    voice->volume_duration = 0;
+
+    while (count > 0 && wt->captured < wt->size + DX7_WAVETABLE_WARMUP) {
+
+        /* the warm-up entries at the end of the period are captured again
+         * last, with the feedback settled */
+        entry = (wt->captured + wt->size - DX7_WAVETABLE_WARMUP) & (wt->size - 1);
+        n = wt->size - entry;
+        if (n > HEXTER_NUGGET_SIZE)  /* the most the LFO buffer covers */
+            n = HEXTER_NUGGET_SIZE;
+        if (n > count)
+            n = count;
+        if (n > wt->size + DX7_WAVETABLE_WARMUP - wt->captured)
+            n = wt->size + DX7_WAVETABLE_WARMUP - wt->captured;
+
+        for (k = 0; k < MAX_DX7_OPERATORS; k++) {
+#ifndef HEXTER_USE_FLOATING_POINT
+            voice->op[k].phase = (int32_t)((uint32_t)wt->phase[k] +
+                                           (uint32_t)wt->step[k] * (uint32_t)entry);
+#else /* HEXTER_USE_FLOATING_POINT */
+            voice->op[k].phase = wt->phase[k] + wt->step[k] * (float)entry;
+#endif /* HEXTER_USE_FLOATING_POINT */
+            voice->op[k].phase_increment = wt->step[k];
+        }
+        memset(wt->table + entry, 0, sizeof(float) * n);
+        dx7_voice_render_operators(instance, voice, wt->table + entry, n, wt->quality);
+
+        wt->captured += n;
+        count -= n;
+    }
+
+    wt->feedback = voice->feedback;
+    memcpy(voice, saved, sizeof(saved));
+
+    if (wt->captured == wt->size + DX7_WAVETABLE_WARMUP) {
+        wt->table[wt->size] = wt->table[0];
+        wt->state = DX7_WAVETABLE_PLAYING;
+    }
+}
+
+/*
+ * dx7_voice_wavetable_start
+ *
+ * size the wavetable for a steady voice, and start capturing it, from
+ * the operators' current phases; a voice too low for the largest table
+ * goes on running its operators
+ */
+static void
+dx7_voice_wavetable_start(hexter_instance_t *instance, dx7_voice_t *voice,
+                          int quality)
+{
+    dx7_wavetable_t *wt = &voice->wavetable;
+    int half = 0, bits, k, ratio;
+    double base, period;
+
+    /* with any operator at ratio 0.5, the period is two of the note's */
+    for (k = 0; k < MAX_DX7_OPERATORS; k++)
+        if (!voice->op[k].coarse)
+            half = 1;
+    base = voice->op[0].frequency / (half ? 2.0 : 1.0);
+    period = (double)instance->sample_rate / base;
+
+    for (bits = 0; (1 << bits) < DX7_WAVETABLE_MIN_SIZE ||
+                   (double)(1 << bits) < period * DX7_WAVETABLE_OVERSAMPLE; bits++)
+        ;
+    if ((1 << bits) > DX7_WAVETABLE_MAX_SIZE) {
+        wt->steady = 0;  /* try again if the pitch changes */
+        return;
+    }
+
+    wt->size = 1 << bits;
+    wt->shift = 32 - bits;
+    for (k = 0; k < MAX_DX7_OPERATORS; k++) {
+        ratio = voice->op[k].coarse ? voice->op[k].coarse * (half ? 2 : 1) : 1;
+        wt->phase[k] = voice->op[k].phase;
+#ifndef HEXTER_USE_FLOATING_POINT
+        wt->step[k] = ratio * (FP_SIZE >> bits);
+#else /* HEXTER_USE_FLOATING_POINT */
+        wt->step[k] = (float)ratio / (float)wt->size;
+#endif /* HEXTER_USE_FLOATING_POINT */
+    }
+    wt->feedback = voice->feedback;
+    wt->position = 0;
+    wt->increment = (uint32_t)llrint(base / (double)instance->sample_rate * 4294967296.0);
+    wt->quality = quality;
+    wt->captured = 0;
+    wt->state = DX7_WAVETABLE_CAPTURING;
+
+    dx7_voice_wavetable_capture(instance, voice, DX7_WAVETABLE_CAPTURE_STEP);
+}
+
+/*
+ * dx7_voice_wavetable_update
+ *
+ * once per nugget: start or continue capturing the wavetable of a voice
+ * that has been steady long enough, or drop that of one that is no
+ * longer steady
+ */
+static void
+dx7_voice_wavetable_update(hexter_instance_t *instance, dx7_voice_t *voice,
+                           int quality)
+{
+    dx7_wavetable_t *wt = &voice->wavetable;
+
+    if (!dx7_voice_is_steady(voice) ||
+        (wt->state != DX7_WAVETABLE_NONE && wt->quality != quality)) {
+        wt->state = DX7_WAVETABLE_NONE;
+        wt->steady = 0;
+        return;
+    }
+
+    switch (wt->state) {
+      case DX7_WAVETABLE_NONE:
+        if (++wt->steady >= DX7_WAVETABLE_SETTLE)
+            dx7_voice_wavetable_start(instance, voice, quality);
+        break;
+      case DX7_WAVETABLE_CAPTURING:
+        dx7_voice_wavetable_capture(instance, voice, DX7_WAVETABLE_CAPTURE_STEP);
+        break;
+      default:
+        instance->pool->stats.wavetable++;
+        break;
+    }
+}
+
+/*
+ * dx7_voice_wavetable_advance
+ *
+ * move the state the operators would have moved on by 'sample_count'
+ * samples, as the wavetable plays in their place, so they can take over
+ * again seamlessly
+ */
+static void
+dx7_voice_wavetable_advance(hexter_instance_t *instance, dx7_voice_t *voice,
+                            unsigned long sample_count)
+{
+    int32_t n;
+    int k;
+
+    for (k = 0; k < MAX_DX7_OPERATORS; k++)
+#ifndef HEXTER_USE_FLOATING_POINT
+        voice->op[k].phase = (int32_t)((uint32_t)voice->op[k].phase +
+                                       (uint32_t)voice->op[k].phase_increment *
+                                           (uint32_t)sample_count);
+#else /* HEXTER_USE_FLOATING_POINT */
+        voice->op[k].phase += voice->op[k].phase_increment * (float)sample_count;
+#endif /* HEXTER_USE_FLOATING_POINT */
+
+    while (sample_count && voice->lfo_delay_duration) {
+        n = voice->lfo_delay_duration;
+        if ((unsigned long)n > sample_count)
+            n = sample_count;
+        voice->lfo_delay_value += voice->lfo_delay_increment * n;
+        voice->lfo_delay_duration -= n;
+        sample_count -= n;
+        if (voice->lfo_delay_duration == 0) {
+            int seg = ++voice->lfo_delay_segment;
+            voice->lfo_delay_duration  = instance->lfo_delay_duration[seg];
+            voice->lfo_delay_value     = instance->lfo_delay_value[seg];
+            voice->lfo_delay_increment = instance->lfo_delay_increment[seg];
+        }
+    }
+}
+
+/*
+ * dx7_voice_render_wavetable
+ *
+ * play 'sample_count' samples of the voice's wavetable into 'out'
+ */
+static void
+dx7_voice_render_wavetable(hexter_instance_t *instance, dx7_voice_t *voice,
+                           float *out, unsigned long sample_count)
+{
+    dx7_wavetable_t *wt = &voice->wavetable;
+    const float *table = wt->table;
+    uint32_t position = wt->position,
+             mask = (UINT32_C(1) << wt->shift) - 1;
+    float scale = 1.0f / (float)(UINT32_C(1) << wt->shift),
+          frac, value;
+    unsigned long sample;
+    uint32_t index;
+
+    for (sample = 0; sample < sample_count; sample++) {
+        index = position >> wt->shift;
+        frac = (float)(position & mask) * scale;
+        value = table[index] + (table[index + 1] - table[index]) * frac;
+        out[sample] += value * voice->volume_value;
+        position += wt->increment;
+        if (voice->volume_duration) {
+            voice->volume_value += voice->volume_increment;
+            voice->volume_duration--;
+        }
+    }
+    wt->position = position;
+
+    dx7_voice_wavetable_advance(instance, voice, sample_count);
+}
+
+/* ===== note-onset cache ===== */
+
+/*
+ * dx7_voice_onset_hash
+ *
+ * return the hash of everything a burst of 'sample_count' samples of the
+ * voice's operators depends on: its state (less the serial number of the
+ * controller values it last took, which changes with controllers that do
+ * not affect it), the instance's LFO delay tables, the LFO output if the
+ * voice's amplitude follows it, and the quality
+ */
+static uint64_t
+dx7_voice_onset_hash(hexter_instance_t *instance, dx7_voice_t *voice,
+                     unsigned long sample_count, int quality)
+{
+    int mods_serial = voice->mods_serial;
+    uint64_t hash;
+
+    voice->mods_serial = 0;
+    hash = hexter_onset_hash((uint64_t)sample_count * 8 + (quality + 1),
+                             (unsigned char *)voice + DX7_VOICE_STATE_OFFSET,
+                             DX7_VOICE_STATE_SIZE);
+    voice->mods_serial = mods_serial;
+
+    hash = hexter_onset_hash(hash, instance->lfo_delay_value, sizeof(instance->lfo_delay_value));
+    hash = hexter_onset_hash(hash, instance->lfo_delay_duration, sizeof(instance->lfo_delay_duration));
+    hash = hexter_onset_hash(hash, instance->lfo_delay_increment, sizeof(instance->lfo_delay_increment));
+    if (voice->onset.lfo)
+        hash = hexter_onset_hash(hash, instance->lfo_buffer, sizeof(dx7_sample_t) * sample_count);
+    return hash;
+}
+
+/*
+ * dx7_voice_render_onset
+ *
+ * render 'sample_count' samples of a voice in its onset: played from its
+ * cache entry if the burst starts from the state recorded, or else by its
+ * operators, recording them if it has an entry to record into
+ */
+static void
+dx7_voice_render_onset(hexter_instance_t *instance, dx7_voice_t *voice,
+                       float *out, unsigned long sample_count, int quality)
+{
+    hexter_onset_cache_t *cache = instance->pool->onset_cache;
+    dx7_onset_t *onset = &voice->onset;
+    unsigned char *state = (unsigned char *)voice + DX7_VOICE_STATE_OFFSET;
+    hexter_onset_entry_t *entry;
+    hexter_onset_record_t *record;
+    unsigned long i;
+    uint64_t hash;
+    float *samples;
+    int mods_serial;
+
+    if (onset->position + sample_count > cache->length) {
+        /* the onset is over */
+        if (onset->state == DX7_ONSET_RECORDING &&
+            onset->entry->generation == onset->generation)
+            onset->entry->complete = 1;
+        onset->state = DX7_ONSET_NONE;
+        dx7_voice_render_operators(instance, voice, out, sample_count, quality);
+        return;
+    }
+
+    hash = dx7_voice_onset_hash(instance, voice, sample_count, quality);
+
+    if (onset->state == DX7_ONSET_NEW) {
+        if ((entry = hexter_onset_find(cache, hash)))
+            onset->state = DX7_ONSET_PLAYING;
+        else if ((entry = hexter_onset_record(cache)))
+            onset->state = DX7_ONSET_RECORDING;
+        else
+            onset->state = DX7_ONSET_NONE;  /* every entry is being recorded */
+        onset->entry = entry;
+        onset->generation = entry ? entry->generation : 0;
+        onset->record = 0;
+    }
+    entry = onset->entry;
+    if (onset->state != DX7_ONSET_NONE && entry->generation != onset->generation)
+        onset->state = DX7_ONSET_NONE;  /* recorded anew for another note */
+
+    samples = (onset->state != DX7_ONSET_NONE ? entry->samples + onset->position : NULL);
+
+    switch (onset->state) {
+
+      case DX7_ONSET_PLAYING:
+        while (onset->record < entry->records &&
+               entry->record[onset->record].start < onset->position)
+            onset->record++;
+        record = (onset->record < entry->records ? &entry->record[onset->record] : NULL);
+        if (record && record->start == onset->position && record->hash == hash) {
+            for (i = 0; i < sample_count; i++)
+                out[i] += samples[i];
+            mods_serial = voice->mods_serial;
+            memcpy(state, hexter_onset_state(cache, entry, onset->record), DX7_VOICE_STATE_SIZE);
+            voice->mods_serial = mods_serial;
+            onset->record++;
+            entry->stamp = cache->clock;
+            instance->pool->stats.onset_hits++;
+        } else {
+            /* a burst split differently, or a state changed by a
+             * controller, a note-off, etc.: the operators take over, and
+             * may catch up with the entry again at a later burst */
+            dx7_voice_render_operators(instance, voice, out, sample_count, quality);
+        }
+        break;
+
+      case DX7_ONSET_RECORDING:
+        if (entry->records == cache->max_records) {
+            entry->complete = 1;
+            onset->state = DX7_ONSET_NONE;
+            dx7_voice_render_operators(instance, voice, out, sample_count, quality);
+            break;
+        }
+        memset(samples, 0, sizeof(float) * sample_count);
+        dx7_voice_render_operators(instance, voice, samples, sample_count, quality);
+        for (i = 0; i < sample_count; i++)
+            out[i] += samples[i];
+        record = &entry->record[entry->records];
+        record->start = onset->position;
+        record->count = sample_count;
+        record->hash = hash;
+        memcpy(hexter_onset_state(cache, entry, entry->records), state, DX7_VOICE_STATE_SIZE);
+        entry->records++;
+        entry->stamp = cache->clock;
+        break;
+
+      default:
+        dx7_voice_render_operators(instance, voice, out, sample_count, quality);
+        break;
+    }
+
+    onset->position += sample_count;
+}
+
+/*
+ * dx7_voice_render
+ *
+ * generate the actual sound data for this voice
+ */
+void
+dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
+                 float *out, unsigned long sample_count,
+                 int do_control_update)
+{
+    int quality = instance->pool->quality;
+
+    /* quiet voices render with less detail */
+    if (voice->lod == DX7_LOD_CARRIERS)
+        quality = DX7_QUALITY_CARRIERS;
+    else if (voice->lod == DX7_LOD_ECO)
+        quality = DX7_QUALITY_ECO;
+
+    if (!float_equality(voice->last_port_volume, *instance->volume) ||
+        voice->last_cc_volume != instance->cc_volume)
+        dx7_voice_recalculate_volume(instance, voice);
+
+    /* a steady voice plays its wavetable, until anything changes: a note
+     * off, a controller, or the quality */
+    if (voice->wavetable.state != DX7_WAVETABLE_NONE &&
+        (!instance->pool->wavetable || voice->wavetable.quality != quality ||
+         !dx7_voice_is_steady(voice))) {
+        voice->wavetable.state = DX7_WAVETABLE_NONE;
+        voice->wavetable.steady = 0;
+    }
+
+    if (voice->wavetable.state == DX7_WAVETABLE_PLAYING) {
+        dx7_voice_render_wavetable(instance, voice, out, sample_count);
+    } else {
+        if (voice->onset.state != DX7_ONSET_NONE)
+            dx7_voice_render_onset(instance, voice, out, sample_count, quality);
+        else
+            dx7_voice_render_operators(instance, voice, out, sample_count, quality);
+        if (voice->wavetable.state == DX7_WAVETABLE_CAPTURING)
+            voice->wavetable.position += voice->wavetable.increment * (uint32_t)sample_count;
     }
 
     if (do_control_update) {
         double new_pitch;
+        int i;
 
         /* do those things which should be done only once per control-
          * calculation interval ("nugget"), such as voice check-for-dead,
          * pitch envelope calculations, etc. */
 
+        /* count the nugget just rendered, if at reduced detail */
+        if (voice->lod == DX7_LOD_ECO)
+            instance->pool->stats.lod_eco++;
+        else if (voice->lod == DX7_LOD_CARRIERS)
+            instance->pool->stats.lod_carriers++;
+
         /* check if we've decayed to nothing, turn off voice if so */
         if (dx7_voice_check_for_dead(voice))
             return; /* we're dead now, so return */
@@ -913,6 +1515,13 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
         voice->op[OP_1].phase -= floorf(voice->op[OP_1].phase);
 #endif /* HEXTER_USE_FLOATING_POINT */
 
+        /* finish any glide cut short, e.g. by a change of quality */
+        if (voice->pitch_ramp_duration) {
+            for (i = 0; i < MAX_DX7_OPERATORS; i++)
+                voice->op[i].phase_increment = voice->op[i].phase_increment_target;
+            voice->pitch_ramp_duration = 0;
+        }
+
         /* update pitch envelope and portamento */
         dx7_pitch_eg_process(instance, &voice->pitch_eg);
         dx7_portamento_process(instance, &voice->portamento);
@@ -926,7 +1535,37 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
         if (!double_equality(voice->last_pitch, new_pitch) ||
             !float_equality(voice->last_port_tuning, *instance->tuning)) {
 
-            dx7_voice_recalculate_freq_and_inc(instance, voice);
+            if (quality == DX7_QUALITY_HIGH) {
+                /* glide to the new pitch over the next nugget, rising by
+                 * the amount that, with the fall back to the new pitch,
+                 * advances the phase as far as the new pitch alone */
+                dx7_sample_t increment[MAX_DX7_OPERATORS];
+
+                for (i = 0; i < MAX_DX7_OPERATORS; i++)
+                    increment[i] = voice->op[i].phase_increment;
+                dx7_voice_recalculate_freq_and_inc(instance, voice);
+                for (i = 0; i < MAX_DX7_OPERATORS; i++) {
+                    dx7_op_t *op = &voice->op[i];
+
+                    op->phase_increment_target = op->phase_increment;
+#ifndef HEXTER_USE_FLOATING_POINT
+                    op->phase_target = (int32_t)((uint32_t)op->phase +
+                                                 (uint32_t)op->phase_increment * HEXTER_NUGGET_SIZE);
+                    op->phase_increment_delta =
+                        (int32_t)((int64_t)(op->phase_increment - increment[i]) *
+                                  (2 * HEXTER_NUGGET_SIZE - DX7_GLIDE_FALL - 1) /
+                                  (DX7_GLIDE_RISE * (DX7_GLIDE_RISE + DX7_GLIDE_FALL)));
+#else /* HEXTER_USE_FLOATING_POINT */
+                    op->phase_target = op->phase + op->phase_increment * HEXTER_NUGGET_SIZE;
+                    op->phase_increment_delta = (op->phase_increment - increment[i]) *
+                                                (float)(2 * HEXTER_NUGGET_SIZE - DX7_GLIDE_FALL - 1) /
+                                                (float)(DX7_GLIDE_RISE * (DX7_GLIDE_RISE + DX7_GLIDE_FALL));
+#endif /* HEXTER_USE_FLOATING_POINT */
+                    op->phase_increment = increment[i];
+                }
+                voice->pitch_ramp_duration = HEXTER_NUGGET_SIZE;
+            } else
+                dx7_voice_recalculate_freq_and_inc(instance, voice);
         }
 
         /* op envelope rounding correction */
@@ -946,5 +1585,13 @@ dx7_voice_render(hexter_instance_t *instance, dx7_voice_t *voice,
             voice->amp_mod_lfo_amd_value = voice->amp_mod_lfo_amd_target;
         if (!voice->volume_duration)
             voice->volume_value = voice->volume_target;
+
+        /* output level estimate, for voice stealing and level of detail */
+        dx7_voice_update_level(voice);
+        dx7_voice_update_lod(instance, voice);
+
+        /* steady-state wavetable */
+        if (instance->pool->wavetable)
+            dx7_voice_wavetable_update(instance, voice, quality);
     }
 }
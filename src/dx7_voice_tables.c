@@ -33,55 +33,27 @@
 #include <config.h>
 #endif
 
-#define _DEFAULT_SOURCE 1
-#define _ISOC99_SOURCE  1
-
-#include <math.h>
-
 #include "hexter_types.h"
 #include "dx7_voice.h"
 
-static int dx7_voice_tables_initialized = 0;
-
-dx7_sample_t    dx7_voice_sin_table[SINE_SIZE + 1];
-
-extern dx7_sample_t dx7_voice_eg_ol_to_mod_index_table[257]; /* forward */
-
-dx7_sample_t  *dx7_voice_eg_ol_to_mod_index = &dx7_voice_eg_ol_to_mod_index_table[128];
-
-void dx7_voice_init_tables(void) {
-
-    int i;
-    double f;
-
-    if (!dx7_voice_tables_initialized) {
-
-        for (i = 0; i <= SINE_SIZE; i++) {
-
-            /* observation of my TX7's output with oscillator sync on suggests
-             * it uses cosine */
-            f = cos((double)(i) / SINE_SIZE * (2 * M_PI));  /* index / index max * radian cycle */
-            dx7_voice_sin_table[i] = DOUBLE_TO_FP(f);
-        }
-
 #ifndef HEXTER_USE_FLOATING_POINT
 #if FP_SHIFT != 24
-        /* Any fixed-point tables below are in s7.24 format.  Shift
-         * them to match FP_SHIFT. */
-        for (i = 0; i <= 256; i++) {
-            dx7_voice_eg_ol_to_mod_index_table[i] >>= (24 - FP_SHIFT);
-        }
+#error "the fixed-point tables below are in s7.24 format, regenerate them to match FP_SHIFT"
 #endif
 #endif /* ! HEXTER_USE_FLOATING_POINT */
 
-        dx7_voice_tables_initialized = 1;
-    }
-}
+/* All of these tables are const data, computed ahead of time, so that
+ * loading the plugin costs no start-up computation, and the tables' pages
+ * are shared between all processes using the plugin. */
+
+extern const dx7_sample_t dx7_voice_eg_ol_to_mod_index_table[257]; /* forward */
+
+const dx7_sample_t *dx7_voice_eg_ol_to_mod_index = &dx7_voice_eg_ol_to_mod_index_table[128];
 
 /* This table lists which operators of an algorithm are carriers.  Bit 0 (LSB)
  * is set if operator 1 is a carrier, and so on through bit 5 for operator 6.
  */
-uint8_t dx7_voice_carriers[32] = {
+const uint8_t dx7_voice_carriers[32] = {
     0x05, /* algorithm 1, operators 1 and 3 */
     0x05,
     0x09, /* algorithm 3, operators 1 and 4 */
@@ -116,7 +88,15 @@ uint8_t dx7_voice_carriers[32] = {
     0x2f, /* algorithm 32, all operators */
 };
 
-float dx7_voice_carrier_count[32] = {
+/* This table lists the operator of each algorithm that feeds back into
+ * itself, counting from 0 for operator 1.
+ */
+const uint8_t dx7_voice_feedback_op[32] = {
+    5, 1, 5, 3, 5, 4, 5, 3, 1, 2, 5, 1, 5, 5, 1, 5,
+    1, 2, 5, 2, 2, 5, 5, 5, 5, 5, 2, 4, 5, 4, 5, 5
+};
+
+const float dx7_voice_carrier_count[32] = {
     2.0f, 2.0f, 2.0f, 2.0f, 3.0f, 3.0f, 2.0f, 2.0f,
     2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 1.0f,
     1.0f, 1.0f, 3.0f, 3.0f, 4.0f, 4.0f, 4.0f, 5.0f,
@@ -164,7 +144,7 @@ float dx7_voice_carrier_count[32] = {
  *    #endif
  *    }
  */
-dx7_sample_t dx7_voice_eg_ol_to_mod_index_table[257] = {
+const dx7_sample_t dx7_voice_eg_ol_to_mod_index_table[257] = {
 #ifndef HEXTER_USE_FLOATING_POINT
     /* phase modulation index, expressed in s7.24 fixed point */
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -250,7 +230,7 @@ dx7_sample_t dx7_voice_eg_ol_to_mod_index_table[257] = {
 /* This table lists the output level adjustment needed for a certain
  * velocity, expressed in output level units per unit of velocity
  * sensitivity. It is based on measurements I took from my TX7. */
-float dx7_voice_velocity_ol_adjustment[128] = {
+const float dx7_voice_velocity_ol_adjustment[128] = {
 
     -99.0,    -10.295511, -9.709229, -9.372207,
     -9.121093, -8.629703, -8.441805, -8.205647,
@@ -289,7 +269,7 @@ float dx7_voice_velocity_ol_adjustment[128] = {
 
 /* This table converts LFO speed to frequency in Hz. It is based on
  * interpolation of Jamie Bullock's measurements. */
-float dx7_voice_lfo_frequency[128] = {
+const float dx7_voice_lfo_frequency[128] = {
      0.062506,  0.124815,  0.311474,  0.435381,  0.619784,
      0.744396,  0.930495,  1.116390,  1.284220,  1.496880,
      1.567830,  1.738994,  1.910158,  2.081322,  2.252486,
@@ -328,7 +308,7 @@ float dx7_voice_lfo_frequency[128] = {
  * least for my own personal build, I'd change that PMS=7 value to a
  * full octave, since that's one thing that's always bugged me about
  * my TX7.  Thoughts? ] */
-float dx7_voice_pms_to_semitones[8] = {
+const float dx7_voice_pms_to_semitones[8] = {
     0.0, 0.450584, 0.900392, 1.474744,
     2.587385, 4.232292, 6.982097, /* 11.722111 */ 12.0
 };
@@ -339,7 +319,7 @@ float dx7_voice_pms_to_semitones[8] = {
  * using this code:
  *   perl -e 'for ($i = 0; $i <= 99; $i++) { printf " %f,\n", exp($i * 0.0428993 - 0.285189); }' >x.c
  * and is probably rather rough in its accuracy. -FIX- */
-float dx7_voice_amd_to_ol_adjustment[100] = {
+const float dx7_voice_amd_to_ol_adjustment[100] = {
     0.0, 0.784829, 0.819230, 0.855139, 0.892622, 0.931748,
     0.972589, 1.015221, 1.059721, 1.106171, 1.154658, 1.205270,
     1.258100, 1.313246, 1.370809, 1.430896, 1.493616, 1.559085,
@@ -364,8 +344,1565 @@ float dx7_voice_amd_to_ol_adjustment[100] = {
  * controller sensitivity') into output level reduction at full modulation
  * with amplitude modulation sensitivity 3.  It's basically just the above
  * table scaled for 0 to 15 instead of 0 to 99. */
-float dx7_voice_mss_to_ol_adjustment[16] = {
+const float dx7_voice_mss_to_ol_adjustment[16] = {
     0.0, 0.997948, 1.324562, 1.758071, 2.333461, 3.097167, 4.110823,
     5.456233, 7.241976, 9.612164, 12.758080, 16.933606, 22.475719,
     29.831681, 39.595137, 52.75
 };
+
+/* dx7_voice_sin_table is one cycle of a cosine wave (observation of my TX7's
+ * output with oscillator sync on suggests it uses cosine), plus a guard point
+ * for interpolation.  It was generated with:
+ *
+ *    for (i = 0; i <= SINE_SIZE; i++) {
+ *        f = cos((double)(i) / SINE_SIZE * (2 * M_PI));
+ *    #ifndef HEXTER_USE_FLOATING_POINT
+ *        printf(" %ld,", lrint(f * (double)FP_SIZE));
+ *    #else
+ *        printf(" %#.9gf,", (float)f);
+ *    #endif
+ *    }
+ */
+const dx7_sample_t dx7_voice_sin_table[SINE_SIZE + 1] = {
+#ifndef HEXTER_USE_FLOATING_POINT
+     16777216,  16777196,  16777137,  16777038,  16776900,  16776723,  16776505,  16776249,
+     16775953,  16775617,  16775242,  16774828,  16774374,  16773880,  16773347,  16772775,
+     16772163,  16771512,  16770821,  16770091,  16769321,  16768512,  16767663,  16766775,
+     16765847,  16764881,  16763874,  16762828,  16761743,  16760618,  16759454,  16758250,
+     16757007,  16755725,  16754403,  16753041,  16751640,  16750200,  16748721,  16747202,
+     16745643,  16744045,  16742408,  16740731,  16739015,  16737260,  16735465,  16733631,
+     16731757,  16729844,  16727892,  16725900,  16723869,  16721799,  16719689,  16717540,
+     16715352,  16713124,  16710857,  16708551,  16706205,  16703820,  16701396,  16698932,
+     16696429,  16693887,  16691305,  16688685,  16686025,  16683325,  16680587,  16677809,
+     16674992,  16672136,  16669240,  16666305,  16663331,  16660318,  16657266,  16654174,
+     16651044,  16647874,  16644664,  16641416,  16638129,  16634802,  16631436,  16628032,
+     16624588,  16621104,  16617582,  16614021,  16610420,  16606781,  16603102,  16599385,
+     16595628,  16591832,  16587997,  16584124,  16580211,  16576259,  16572268,  16568238,
+     16564169,  16560061,  16555914,  16551729,  16547504,  16543240,  16538938,  16534596,
+     16530216,  16525797,  16521338,  16516841,  16512305,  16507731,  16503117,  16498464,
+     16493773,  16489043,  16484274,  16479466,  16474620,  16469735,  16464811,  16459848,
+     16454846,  16449806,  16444727,  16439610,  16434454,  16429259,  16424025,  16418753,
+     16413442,  16408092,  16402704,  16397277,  16391812,  16386308,  16380766,  16375185,
+     16369565,  16363907,  16358211,  16352476,  16346702,  16340890,  16335040,  16329151,
+     16323224,  16317258,  16311254,  16305211,  16299131,  16293011,  16286854,  16280658,
+     16274424,  16268151,  16261841,  16255492,  16249104,  16242679,  16236215,  16229713,
+     16223173,  16216595,  16209978,  16203324,  16196631,  16189900,  16183131,  16176324,
+     16169479,  16162596,  16155675,  16148716,  16141719,  16134683,  16127610,  16120499,
+     16113350,  16106163,  16098939,  16091676,  16084375,  16077037,  16069661,  16062247,
+     16054795,  16047305,  16039778,  16032213,  16024610,  16016969,  16009291,  16001575,
+     15993821,  15986030,  15978201,  15970335,  15962431,  15954489,  15946510,  15938494,
+     15930439,  15922348,  15914219,  15906052,  15897848,  15889607,  15881328,  15873012,
+     15864658,  15856268,  15847839,  15839374,  15830871,  15822331,  15813754,  15805140,
+     15796488,  15787799,  15779073,  15770310,  15761510,  15752673,  15743799,  15734887,
+     15725939,  15716954,  15707931,  15698872,  15689776,  15680643,  15671472,  15662266,
+     15653022,  15643741,  15634424,  15625069,  15615678,  15606251,  15596786,  15587285,
+     15577747,  15568173,  15558561,  15548914,  15539229,  15529508,  15519751,  15509957,
+     15500126,  15490260,  15480356,  15470416,  15460440,  15450427,  15440379,  15430293,
+     15420172,  15410014,  15399820,  15389589,  15379323,  15369020,  15358681,  15348306,
+     15337895,  15327447,  15316964,  15306444,  15295889,  15285298,  15274670,  15264007,
+     15253308,  15242572,  15231801,  15220995,  15210152,  15199273,  15188359,  15177409,
+     15166424,  15155402,  15144345,  15133253,  15122124,  15110960,  15099761,  15088526,
+     15077256,  15065950,  15054608,  15043232,  15031819,  15020372,  15008889,  14997371,
+     14985817,  14974228,  14962604,  14950945,  14939251,  14927521,  14915756,  14903957,
+     14892122,  14880252,  14868347,  14856407,  14844432,  14832422,  14820378,  14808298,
+     14796184,  14784034,  14771850,  14759632,  14747378,  14735090,  14722767,  14710409,
+     14698017,  14685590,  14673129,  14660633,  14648103,  14635538,  14622939,  14610305,
+     14597637,  14584935,  14572198,  14559427,  14546622,  14533783,  14520909,  14508001,
+     14495059,  14482083,  14469073,  14456029,  14442951,  14429838,  14416692,  14403512,
+     14390298,  14377050,  14363769,  14350453,  14337104,  14323721,  14310304,  14296854,
+     14283370,  14269852,  14256301,  14242716,  14229098,  14215446,  14201761,  14188043,
+     14174291,  14160505,  14146687,  14132835,  14118950,  14105031,  14091080,  14077095,
+     14063077,  14049026,  14034942,  14020825,  14006675,  13992492,  13978276,  13964027,
+     13949745,  13935431,  13921083,  13906703,  13892291,  13877845,  13863367,  13848856,
+     13834313,  13819737,  13805129,  13790488,  13775814,  13761108,  13746370,  13731600,
+     13716797,  13701962,  13687095,  13672195,  13657263,  13642299,  13627304,  13612276,
+     13597215,  13582123,  13566999,  13551844,  13536656,  13521436,  13506185,  13490901,
+     13475586,  13460240,  13444861,  13429451,  13414009,  13398536,  13383032,  13367495,
+     13351928,  13336329,  13320698,  13305036,  13289343,  13273619,  13257863,  13242076,
+     13226258,  13210409,  13194529,  13178618,  13162675,  13146702,  13130698,  13114663,
+     13098597,  13082500,  13066373,  13050215,  13034026,  13017806,  13001556,  12985275,
+     12968963,  12952621,  12936249,  12919846,  12903413,  12886949,  12870455,  12853931,
+     12837376,  12820792,  12804177,  12787532,  12770857,  12754152,  12737417,  12720651,
+     12703856,  12687031,  12670177,  12653292,  12636378,  12619433,  12602460,  12585456,
+     12568423,  12551360,  12534268,  12517147,  12499995,  12482815,  12465605,  12448366,
+     12431097,  12413799,  12396472,  12379116,  12361731,  12344316,  12326873,  12309400,
+     12291899,  12274369,  12256809,  12239221,  12221604,  12203959,  12186284,  12168581,
+     12150850,  12133089,  12115301,  12097483,  12079638,  12061763,  12043861,  12025930,
+     12007971,  11989983,  11971967,  11953924,  11935852,  11917752,  11899623,  11881467,
+     11863283,  11845071,  11826831,  11808564,  11790268,  11771945,  11753594,  11735215,
+     11716809,  11698375,  11679914,  11661425,  11642909,  11624365,  11605794,  11587196,
+     11568571,  11549918,  11531238,  11512531,  11493797,  11475035,  11456247,  11437432,
+     11418590,  11399721,  11380825,  11361903,  11342953,  11323977,  11304975,  11285945,
+     11266890,  11247807,  11228699,  11209563,  11190402,  11171214,  11152000,  11132759,
+     11113493,  11094200,  11074881,  11055536,  11036165,  11016768,  10997345,  10977896,
+     10958422,  10938922,  10919395,  10899844,  10880266,  10860663,  10841035,  10821380,
+     10801701,  10781996,  10762266,  10742510,  10722729,  10702923,  10683091,  10663235,
+     10643353,  10623447,  10603515,  10583558,  10563577,  10543570,  10523539,  10503483,
+     10483403,  10463297,  10443167,  10423013,  10402834,  10382630,  10362402,  10342150,
+     10321873,  10301572,  10281247,  10260898,  10240524,  10220127,  10199705,  10179259,
+     10158790,  10138296,  10117779,  10097237,  10076672,  10056084,  10035471,  10014835,
+      9994176,   9973493,   9952786,   9932056,   9911303,   9890526,   9869727,   9848903,
+      9828057,   9807188,   9786295,   9765380,   9744441,   9723480,   9702495,   9681488,
+      9660458,   9639406,   9618330,   9597232,   9576112,   9554969,   9533803,   9512615,
+      9491405,   9470172,   9448917,   9427640,   9406340,   9385019,   9363675,   9342309,
+      9320922,   9299512,   9278081,   9256627,   9235152,   9213655,   9192137,   9170597,
+      9149035,   9127452,   9105847,   9084221,   9062573,   9040905,   9019214,   8997503,
+      8975771,   8954017,   8932242,   8910447,   8888630,   8866792,   8844934,   8823054,
+      8801154,   8779234,   8757292,   8735330,   8713348,   8691345,   8669321,   8647277,
+      8625213,   8603128,   8581023,   8558898,   8536753,   8514588,   8492403,   8470197,
+      8447972,   8425727,   8403462,   8381178,   8358873,   8336549,   8314205,   8291842,
+      8269459,   8247057,   8224636,   8202195,   8179734,   8157255,   8134756,   8112238,
+      8089701,   8067145,   8044570,   8021976,   7999364,   7976732,   7954082,   7931413,
+      7908725,   7886019,   7863294,   7840550,   7817788,   7795008,   7772209,   7749393,
+      7726557,   7703704,   7680833,   7657943,   7635036,   7612110,   7589167,   7566205,
+      7543226,   7520230,   7497215,   7474183,   7451133,   7428066,   7404981,   7381879,
+      7358759,   7335623,   7312468,   7289297,   7266109,   7242903,   7219680,   7196441,
+      7173184,   7149911,   7126620,   7103313,   7079990,   7056649,   7033292,   7009919,
+      6986529,   6963122,   6939699,   6916260,   6892805,   6869333,   6845845,   6822341,
+      6798821,   6775285,   6751733,   6728165,   6704582,   6680982,   6657367,   6633736,
+      6610090,   6586428,   6562750,   6539057,   6515349,   6491625,   6467886,   6444132,
+      6420363,   6396578,   6372779,   6348964,   6325135,   6301290,   6277431,   6253557,
+      6229669,   6205765,   6181848,   6157915,   6133968,   6110007,   6086031,   6062041,
+      6038037,   6014018,   5989986,   5965939,   5941878,   5917803,   5893714,   5869612,
+      5845495,   5821365,   5797221,   5773064,   5748893,   5724708,   5700510,   5676299,
+      5652074,   5627836,   5603584,   5579320,   5555042,   5530751,   5506447,   5482131,
+      5457801,   5433459,   5409103,   5384735,   5360355,   5335961,   5311555,   5287137,
+      5262706,   5238263,   5213808,   5189340,   5164860,   5140368,   5115864,   5091347,
+      5066819,   5042279,   5017727,   4993163,   4968587,   4944000,   4919401,   4894791,
+      4870169,   4845535,   4820890,   4796234,   4771567,   4746888,   4722198,   4697497,
+      4672785,   4648062,   4623328,   4598583,   4573827,   4549061,   4524284,   4499496,
+      4474698,   4449889,   4425069,   4400239,   4375399,   4350549,   4325688,   4300817,
+      4275936,   4251045,   4226144,   4201233,   4176312,   4151381,   4126441,   4101491,
+      4076531,   4051562,   4026583,   4001594,   3976596,   3951589,   3926572,   3901547,
+      3876512,   3851468,   3826415,   3801352,   3776281,   3751201,   3726113,   3701015,
+      3675909,   3650794,   3625670,   3600538,   3575398,   3550249,   3525092,   3499926,
+      3474752,   3449570,   3424380,   3399182,   3373976,   3348762,   3323540,   3298310,
+      3273072,   3247827,   3222574,   3197314,   3172046,   3146770,   3121487,   3096197,
+      3070900,   3045595,   3020283,   2994964,   2969638,   2944305,   2918965,   2893618,
+      2868265,   2842904,   2817537,   2792163,   2766783,   2741396,   2716003,   2690603,
+      2665197,   2639785,   2614367,   2588942,   2563511,   2538075,   2512632,   2487183,
+      2461729,   2436269,   2410803,   2385331,   2359854,   2334371,   2308883,   2283389,
+      2257890,   2232385,   2206875,   2181361,   2155841,   2130315,   2104785,   2079250,
+      2053710,   2028166,   2002616,   1977062,   1951503,   1925939,   1900371,   1874799,
+      1849222,   1823640,   1798055,   1772465,   1746871,   1721273,   1695671,   1670065,
+      1644455,   1618841,   1593223,   1567602,   1541976,   1516348,   1490715,   1465079,
+      1439440,   1413797,   1388151,   1362502,   1336849,   1311194,   1285535,   1259873,
+      1234209,   1208541,   1182870,   1157197,   1131521,   1105843,   1080161,   1054478,
+      1028791,   1003103,    977411,    951718,    926023,    900325,    874625,    848923,
+       823219,    797513,    771805,    746096,    720384,    694671,    668957,    643240,
+       617523,    591804,    566083,    540361,    514638,    488913,    463188,    437461,
+       411733,    386005,    360275,    334545,    308814,    283082,    257349,    231616,
+       205882,    180148,    154413,    128678,    102943,     77208,     51472,     25736,
+            0,    -25736,    -51472,    -77208,   -102943,   -128678,   -154413,   -180148,
+      -205882,   -231616,   -257349,   -283082,   -308814,   -334545,   -360275,   -386005,
+      -411733,   -437461,   -463188,   -488913,   -514638,   -540361,   -566083,   -591804,
+      -617523,   -643240,   -668957,   -694671,   -720384,   -746096,   -771805,   -797513,
+      -823219,   -848923,   -874625,   -900325,   -926023,   -951718,   -977411,  -1003103,
+     -1028791,  -1054478,  -1080161,  -1105843,  -1131521,  -1157197,  -1182870,  -1208541,
+     -1234209,  -1259873,  -1285535,  -1311194,  -1336849,  -1362502,  -1388151,  -1413797,
+     -1439440,  -1465079,  -1490715,  -1516348,  -1541976,  -1567602,  -1593223,  -1618841,
+     -1644455,  -1670065,  -1695671,  -1721273,  -1746871,  -1772465,  -1798055,  -1823640,
+     -1849222,  -1874799,  -1900371,  -1925939,  -1951503,  -1977062,  -2002616,  -2028166,
+     -2053710,  -2079250,  -2104785,  -2130315,  -2155841,  -2181361,  -2206875,  -2232385,
+     -2257890,  -2283389,  -2308883,  -2334371,  -2359854,  -2385331,  -2410803,  -2436269,
+     -2461729,  -2487183,  -2512632,  -2538075,  -2563511,  -2588942,  -2614367,  -2639785,
+     -2665197,  -2690603,  -2716003,  -2741396,  -2766783,  -2792163,  -2817537,  -2842904,
+     -2868265,  -2893618,  -2918965,  -2944305,  -2969638,  -2994964,  -3020283,  -3045595,
+     -3070900,  -3096197,  -3121487,  -3146770,  -3172046,  -3197314,  -3222574,  -3247827,
+     -3273072,  -3298310,  -3323540,  -3348762,  -3373976,  -3399182,  -3424380,  -3449570,
+     -3474752,  -3499926,  -3525092,  -3550249,  -3575398,  -3600538,  -3625670,  -3650794,
+     -3675909,  -3701015,  -3726113,  -3751201,  -3776281,  -3801352,  -3826415,  -3851468,
+     -3876512,  -3901547,  -3926572,  -3951589,  -3976596,  -4001594,  -4026583,  -4051562,
+     -4076531,  -4101491,  -4126441,  -4151381,  -4176312,  -4201233,  -4226144,  -4251045,
+     -4275936,  -4300817,  -4325688,  -4350549,  -4375399,  -4400239,  -4425069,  -4449889,
+     -4474698,  -4499496,  -4524284,  -4549061,  -4573827,  -4598583,  -4623328,  -4648062,
+     -4672785,  -4697497,  -4722198,  -4746888,  -4771567,  -4796234,  -4820890,  -4845535,
+     -4870169,  -4894791,  -4919401,  -4944000,  -4968587,  -4993163,  -5017727,  -5042279,
+     -5066819,  -5091347,  -5115864,  -5140368,  -5164860,  -5189340,  -5213808,  -5238263,
+     -5262706,  -5287137,  -5311555,  -5335961,  -5360355,  -5384735,  -5409103,  -5433459,
+     -5457801,  -5482131,  -5506447,  -5530751,  -5555042,  -5579320,  -5603584,  -5627836,
+     -5652074,  -5676299,  -5700510,  -5724708,  -5748893,  -5773064,  -5797221,  -5821365,
+     -5845495,  -5869612,  -5893714,  -5917803,  -5941878,  -5965939,  -5989986,  -6014018,
+     -6038037,  -6062041,  -6086031,  -6110007,  -6133968,  -6157915,  -6181848,  -6205765,
+     -6229669,  -6253557,  -6277431,  -6301290,  -6325135,  -6348964,  -6372779,  -6396578,
+     -6420363,  -6444132,  -6467886,  -6491625,  -6515349,  -6539057,  -6562750,  -6586428,
+     -6610090,  -6633736,  -6657367,  -6680982,  -6704582,  -6728165,  -6751733,  -6775285,
+     -6798821,  -6822341,  -6845845,  -6869333,  -6892805,  -6916260,  -6939699,  -6963122,
+     -6986529,  -7009919,  -7033292,  -7056649,  -7079990,  -7103313,  -7126620,  -7149911,
+     -7173184,  -7196441,  -7219680,  -7242903,  -7266109,  -7289297,  -7312468,  -7335623,
+     -7358759,  -7381879,  -7404981,  -7428066,  -7451133,  -7474183,  -7497215,  -7520230,
+     -7543226,  -7566205,  -7589167,  -7612110,  -7635036,  -7657943,  -7680833,  -7703704,
+     -7726557,  -7749393,  -7772209,  -7795008,  -7817788,  -7840550,  -7863294,  -7886019,
+     -7908725,  -7931413,  -7954082,  -7976732,  -7999364,  -8021976,  -8044570,  -8067145,
+     -8089701,  -8112238,  -8134756,  -8157255,  -8179734,  -8202195,  -8224636,  -8247057,
+     -8269459,  -8291842,  -8314205,  -8336549,  -8358873,  -8381178,  -8403462,  -8425727,
+     -8447972,  -8470197,  -8492403,  -8514588,  -8536753,  -8558898,  -8581023,  -8603128,
+     -8625213,  -8647277,  -8669321,  -8691345,  -8713348,  -8735330,  -8757292,  -8779234,
+     -8801154,  -8823054,  -8844934,  -8866792,  -8888630,  -8910447,  -8932242,  -8954017,
+     -8975771,  -8997503,  -9019214,  -9040905,  -9062573,  -9084221,  -9105847,  -9127452,
+     -9149035,  -9170597,  -9192137,  -9213655,  -9235152,  -9256627,  -9278081,  -9299512,
+     -9320922,  -9342309,  -9363675,  -9385019,  -9406340,  -9427640,  -9448917,  -9470172,
+     -9491405,  -9512615,  -9533803,  -9554969,  -9576112,  -9597232,  -9618330,  -9639406,
+     -9660458,  -9681488,  -9702495,  -9723480,  -9744441,  -9765380,  -9786295,  -9807188,
+     -9828057,  -9848903,  -9869727,  -9890526,  -9911303,  -9932056,  -9952786,  -9973493,
+     -9994176, -10014835, -10035471, -10056084, -10076672, -10097237, -10117779, -10138296,
+    -10158790, -10179259, -10199705, -10220127, -10240524, -10260898, -10281247, -10301572,
+    -10321873, -10342150, -10362402, -10382630, -10402834, -10423013, -10443167, -10463297,
+    -10483403, -10503483, -10523539, -10543570, -10563577, -10583558, -10603515, -10623447,
+    -10643353, -10663235, -10683091, -10702923, -10722729, -10742510, -10762266, -10781996,
+    -10801701, -10821380, -10841035, -10860663, -10880266, -10899844, -10919395, -10938922,
+    -10958422, -10977896, -10997345, -11016768, -11036165, -11055536, -11074881, -11094200,
+    -11113493, -11132759, -11152000, -11171214, -11190402, -11209563, -11228699, -11247807,
+    -11266890, -11285945, -11304975, -11323977, -11342953, -11361903, -11380825, -11399721,
+    -11418590, -11437432, -11456247, -11475035, -11493797, -11512531, -11531238, -11549918,
+    -11568571, -11587196, -11605794, -11624365, -11642909, -11661425, -11679914, -11698375,
+    -11716809, -11735215, -11753594, -11771945, -11790268, -11808564, -11826831, -11845071,
+    -11863283, -11881467, -11899623, -11917752, -11935852, -11953924, -11971967, -11989983,
+    -12007971, -12025930, -12043861, -12061763, -12079638, -12097483, -12115301, -12133089,
+    -12150850, -12168581, -12186284, -12203959, -12221604, -12239221, -12256809, -12274369,
+    -12291899, -12309400, -12326873, -12344316, -12361731, -12379116, -12396472, -12413799,
+    -12431097, -12448366, -12465605, -12482815, -12499995, -12517147, -12534268, -12551360,
+    -12568423, -12585456, -12602460, -12619433, -12636378, -12653292, -12670177, -12687031,
+    -12703856, -12720651, -12737417, -12754152, -12770857, -12787532, -12804177, -12820792,
+    -12837376, -12853931, -12870455, -12886949, -12903413, -12919846, -12936249, -12952621,
+    -12968963, -12985275, -13001556, -13017806, -13034026, -13050215, -13066373, -13082500,
+    -13098597, -13114663, -13130698, -13146702, -13162675, -13178618, -13194529, -13210409,
+    -13226258, -13242076, -13257863, -13273619, -13289343, -13305036, -13320698, -13336329,
+    -13351928, -13367495, -13383032, -13398536, -13414009, -13429451, -13444861, -13460240,
+    -13475586, -13490901, -13506185, -13521436, -13536656, -13551844, -13566999, -13582123,
+    -13597215, -13612276, -13627304, -13642299, -13657263, -13672195, -13687095, -13701962,
+    -13716797, -13731600, -13746370, -13761108, -13775814, -13790488, -13805129, -13819737,
+    -13834313, -13848856, -13863367, -13877845, -13892291, -13906703, -13921083, -13935431,
+    -13949745, -13964027, -13978276, -13992492, -14006675, -14020825, -14034942, -14049026,
+    -14063077, -14077095, -14091080, -14105031, -14118950, -14132835, -14146687, -14160505,
+    -14174291, -14188043, -14201761, -14215446, -14229098, -14242716, -14256301, -14269852,
+    -14283370, -14296854, -14310304, -14323721, -14337104, -14350453, -14363769, -14377050,
+    -14390298, -14403512, -14416692, -14429838, -14442951, -14456029, -14469073, -14482083,
+    -14495059, -14508001, -14520909, -14533783, -14546622, -14559427, -14572198, -14584935,
+    -14597637, -14610305, -14622939, -14635538, -14648103, -14660633, -14673129, -14685590,
+    -14698017, -14710409, -14722767, -14735090, -14747378, -14759632, -14771850, -14784034,
+    -14796184, -14808298, -14820378, -14832422, -14844432, -14856407, -14868347, -14880252,
+    -14892122, -14903957, -14915756, -14927521, -14939251, -14950945, -14962604, -14974228,
+    -14985817, -14997371, -15008889, -15020372, -15031819, -15043232, -15054608, -15065950,
+    -15077256, -15088526, -15099761, -15110960, -15122124, -15133253, -15144345, -15155402,
+    -15166424, -15177409, -15188359, -15199273, -15210152, -15220995, -15231801, -15242572,
+    -15253308, -15264007, -15274670, -15285298, -15295889, -15306444, -15316964, -15327447,
+    -15337895, -15348306, -15358681, -15369020, -15379323, -15389589, -15399820, -15410014,
+    -15420172, -15430293, -15440379, -15450427, -15460440, -15470416, -15480356, -15490260,
+    -15500126, -15509957, -15519751, -15529508, -15539229, -15548914, -15558561, -15568173,
+    -15577747, -15587285, -15596786, -15606251, -15615678, -15625069, -15634424, -15643741,
+    -15653022, -15662266, -15671472, -15680643, -15689776, -15698872, -15707931, -15716954,
+    -15725939, -15734887, -15743799, -15752673, -15761510, -15770310, -15779073, -15787799,
+    -15796488, -15805140, -15813754, -15822331, -15830871, -15839374, -15847839, -15856268,
+    -15864658, -15873012, -15881328, -15889607, -15897848, -15906052, -15914219, -15922348,
+    -15930439, -15938494, -15946510, -15954489, -15962431, -15970335, -15978201, -15986030,
+    -15993821, -16001575, -16009291, -16016969, -16024610, -16032213, -16039778, -16047305,
+    -16054795, -16062247, -16069661, -16077037, -16084375, -16091676, -16098939, -16106163,
+    -16113350, -16120499, -16127610, -16134683, -16141719, -16148716, -16155675, -16162596,
+    -16169479, -16176324, -16183131, -16189900, -16196631, -16203324, -16209978, -16216595,
+    -16223173, -16229713, -16236215, -16242679, -16249104, -16255492, -16261841, -16268151,
+    -16274424, -16280658, -16286854, -16293011, -16299131, -16305211, -16311254, -16317258,
+    -16323224, -16329151, -16335040, -16340890, -16346702, -16352476, -16358211, -16363907,
+    -16369565, -16375185, -16380766, -16386308, -16391812, -16397277, -16402704, -16408092,
+    -16413442, -16418753, -16424025, -16429259, -16434454, -16439610, -16444727, -16449806,
+    -16454846, -16459848, -16464811, -16469735, -16474620, -16479466, -16484274, -16489043,
+    -16493773, -16498464, -16503117, -16507731, -16512305, -16516841, -16521338, -16525797,
+    -16530216, -16534596, -16538938, -16543240, -16547504, -16551729, -16555914, -16560061,
+    -16564169, -16568238, -16572268, -16576259, -16580211, -16584124, -16587997, -16591832,
+    -16595628, -16599385, -16603102, -16606781, -16610420, -16614021, -16617582, -16621104,
+    -16624588, -16628032, -16631436, -16634802, -16638129, -16641416, -16644664, -16647874,
+    -16651044, -16654174, -16657266, -16660318, -16663331, -16666305, -16669240, -16672136,
+    -16674992, -16677809, -16680587, -16683325, -16686025, -16688685, -16691305, -16693887,
+    -16696429, -16698932, -16701396, -16703820, -16706205, -16708551, -16710857, -16713124,
+    -16715352, -16717540, -16719689, -16721799, -16723869, -16725900, -16727892, -16729844,
+    -16731757, -16733631, -16735465, -16737260, -16739015, -16740731, -16742408, -16744045,
+    -16745643, -16747202, -16748721, -16750200, -16751640, -16753041, -16754403, -16755725,
+    -16757007, -16758250, -16759454, -16760618, -16761743, -16762828, -16763874, -16764881,
+    -16765847, -16766775, -16767663, -16768512, -16769321, -16770091, -16770821, -16771512,
+    -16772163, -16772775, -16773347, -16773880, -16774374, -16774828, -16775242, -16775617,
+    -16775953, -16776249, -16776505, -16776723, -16776900, -16777038, -16777137, -16777196,
+    -16777216, -16777196, -16777137, -16777038, -16776900, -16776723, -16776505, -16776249,
+    -16775953, -16775617, -16775242, -16774828, -16774374, -16773880, -16773347, -16772775,
+    -16772163, -16771512, -16770821, -16770091, -16769321, -16768512, -16767663, -16766775,
+    -16765847, -16764881, -16763874, -16762828, -16761743, -16760618, -16759454, -16758250,
+    -16757007, -16755725, -16754403, -16753041, -16751640, -16750200, -16748721, -16747202,
+    -16745643, -16744045, -16742408, -16740731, -16739015, -16737260, -16735465, -16733631,
+    -16731757, -16729844, -16727892, -16725900, -16723869, -16721799, -16719689, -16717540,
+    -16715352, -16713124, -16710857, -16708551, -16706205, -16703820, -16701396, -16698932,
+    -16696429, -16693887, -16691305, -16688685, -16686025, -16683325, -16680587, -16677809,
+    -16674992, -16672136, -16669240, -16666305, -16663331, -16660318, -16657266, -16654174,
+    -16651044, -16647874, -16644664, -16641416, -16638129, -16634802, -16631436, -16628032,
+    -16624588, -16621104, -16617582, -16614021, -16610420, -16606781, -16603102, -16599385,
+    -16595628, -16591832, -16587997, -16584124, -16580211, -16576259, -16572268, -16568238,
+    -16564169, -16560061, -16555914, -16551729, -16547504, -16543240, -16538938, -16534596,
+    -16530216, -16525797, -16521338, -16516841, -16512305, -16507731, -16503117, -16498464,
+    -16493773, -16489043, -16484274, -16479466, -16474620, -16469735, -16464811, -16459848,
+    -16454846, -16449806, -16444727, -16439610, -16434454, -16429259, -16424025, -16418753,
+    -16413442, -16408092, -16402704, -16397277, -16391812, -16386308, -16380766, -16375185,
+    -16369565, -16363907, -16358211, -16352476, -16346702, -16340890, -16335040, -16329151,
+    -16323224, -16317258, -16311254, -16305211, -16299131, -16293011, -16286854, -16280658,
+    -16274424, -16268151, -16261841, -16255492, -16249104, -16242679, -16236215, -16229713,
+    -16223173, -16216595, -16209978, -16203324, -16196631, -16189900, -16183131, -16176324,
+    -16169479, -16162596, -16155675, -16148716, -16141719, -16134683, -16127610, -16120499,
+    -16113350, -16106163, -16098939, -16091676, -16084375, -16077037, -16069661, -16062247,
+    -16054795, -16047305, -16039778, -16032213, -16024610, -16016969, -16009291, -16001575,
+    -15993821, -15986030, -15978201, -15970335, -15962431, -15954489, -15946510, -15938494,
+    -15930439, -15922348, -15914219, -15906052, -15897848, -15889607, -15881328, -15873012,
+    -15864658, -15856268, -15847839, -15839374, -15830871, -15822331, -15813754, -15805140,
+    -15796488, -15787799, -15779073, -15770310, -15761510, -15752673, -15743799, -15734887,
+    -15725939, -15716954, -15707931, -15698872, -15689776, -15680643, -15671472, -15662266,
+    -15653022, -15643741, -15634424, -15625069, -15615678, -15606251, -15596786, -15587285,
+    -15577747, -15568173, -15558561, -15548914, -15539229, -15529508, -15519751, -15509957,
+    -15500126, -15490260, -15480356, -15470416, -15460440, -15450427, -15440379, -15430293,
+    -15420172, -15410014, -15399820, -15389589, -15379323, -15369020, -15358681, -15348306,
+    -15337895, -15327447, -15316964, -15306444, -15295889, -15285298, -15274670, -15264007,
+    -15253308, -15242572, -15231801, -15220995, -15210152, -15199273, -15188359, -15177409,
+    -15166424, -15155402, -15144345, -15133253, -15122124, -15110960, -15099761, -15088526,
+    -15077256, -15065950, -15054608, -15043232, -15031819, -15020372, -15008889, -14997371,
+    -14985817, -14974228, -14962604, -14950945, -14939251, -14927521, -14915756, -14903957,
+    -14892122, -14880252, -14868347, -14856407, -14844432, -14832422, -14820378, -14808298,
+    -14796184, -14784034, -14771850, -14759632, -14747378, -14735090, -14722767, -14710409,
+    -14698017, -14685590, -14673129, -14660633, -14648103, -14635538, -14622939, -14610305,
+    -14597637, -14584935, -14572198, -14559427, -14546622, -14533783, -14520909, -14508001,
+    -14495059, -14482083, -14469073, -14456029, -14442951, -14429838, -14416692, -14403512,
+    -14390298, -14377050, -14363769, -14350453, -14337104, -14323721, -14310304, -14296854,
+    -14283370, -14269852, -14256301, -14242716, -14229098, -14215446, -14201761, -14188043,
+    -14174291, -14160505, -14146687, -14132835, -14118950, -14105031, -14091080, -14077095,
+    -14063077, -14049026, -14034942, -14020825, -14006675, -13992492, -13978276, -13964027,
+    -13949745, -13935431, -13921083, -13906703, -13892291, -13877845, -13863367, -13848856,
+    -13834313, -13819737, -13805129, -13790488, -13775814, -13761108, -13746370, -13731600,
+    -13716797, -13701962, -13687095, -13672195, -13657263, -13642299, -13627304, -13612276,
+    -13597215, -13582123, -13566999, -13551844, -13536656, -13521436, -13506185, -13490901,
+    -13475586, -13460240, -13444861, -13429451, -13414009, -13398536, -13383032, -13367495,
+    -13351928, -13336329, -13320698, -13305036, -13289343, -13273619, -13257863, -13242076,
+    -13226258, -13210409, -13194529, -13178618, -13162675, -13146702, -13130698, -13114663,
+    -13098597, -13082500, -13066373, -13050215, -13034026, -13017806, -13001556, -12985275,
+    -12968963, -12952621, -12936249, -12919846, -12903413, -12886949, -12870455, -12853931,
+    -12837376, -12820792, -12804177, -12787532, -12770857, -12754152, -12737417, -12720651,
+    -12703856, -12687031, -12670177, -12653292, -12636378, -12619433, -12602460, -12585456,
+    -12568423, -12551360, -12534268, -12517147, -12499995, -12482815, -12465605, -12448366,
+    -12431097, -12413799, -12396472, -12379116, -12361731, -12344316, -12326873, -12309400,
+    -12291899, -12274369, -12256809, -12239221, -12221604, -12203959, -12186284, -12168581,
+    -12150850, -12133089, -12115301, -12097483, -12079638, -12061763, -12043861, -12025930,
+    -12007971, -11989983, -11971967, -11953924, -11935852, -11917752, -11899623, -11881467,
+    -11863283, -11845071, -11826831, -11808564, -11790268, -11771945, -11753594, -11735215,
+    -11716809, -11698375, -11679914, -11661425, -11642909, -11624365, -11605794, -11587196,
+    -11568571, -11549918, -11531238, -11512531, -11493797, -11475035, -11456247, -11437432,
+    -11418590, -11399721, -11380825, -11361903, -11342953, -11323977, -11304975, -11285945,
+    -11266890, -11247807, -11228699, -11209563, -11190402, -11171214, -11152000, -11132759,
+    -11113493, -11094200, -11074881, -11055536, -11036165, -11016768, -10997345, -10977896,
+    -10958422, -10938922, -10919395, -10899844, -10880266, -10860663, -10841035, -10821380,
+    -10801701, -10781996, -10762266, -10742510, -10722729, -10702923, -10683091, -10663235,
+    -10643353, -10623447, -10603515, -10583558, -10563577, -10543570, -10523539, -10503483,
+    -10483403, -10463297, -10443167, -10423013, -10402834, -10382630, -10362402, -10342150,
+    -10321873, -10301572, -10281247, -10260898, -10240524, -10220127, -10199705, -10179259,
+    -10158790, -10138296, -10117779, -10097237, -10076672, -10056084, -10035471, -10014835,
+     -9994176,  -9973493,  -9952786,  -9932056,  -9911303,  -9890526,  -9869727,  -9848903,
+     -9828057,  -9807188,  -9786295,  -9765380,  -9744441,  -9723480,  -9702495,  -9681488,
+     -9660458,  -9639406,  -9618330,  -9597232,  -9576112,  -9554969,  -9533803,  -9512615,
+     -9491405,  -9470172,  -9448917,  -9427640,  -9406340,  -9385019,  -9363675,  -9342309,
+     -9320922,  -9299512,  -9278081,  -9256627,  -9235152,  -9213655,  -9192137,  -9170597,
+     -9149035,  -9127452,  -9105847,  -9084221,  -9062573,  -9040905,  -9019214,  -8997503,
+     -8975771,  -8954017,  -8932242,  -8910447,  -8888630,  -8866792,  -8844934,  -8823054,
+     -8801154,  -8779234,  -8757292,  -8735330,  -8713348,  -8691345,  -8669321,  -8647277,
+     -8625213,  -8603128,  -8581023,  -8558898,  -8536753,  -8514588,  -8492403,  -8470197,
+     -8447972,  -8425727,  -8403462,  -8381178,  -8358873,  -8336549,  -8314205,  -8291842,
+     -8269459,  -8247057,  -8224636,  -8202195,  -8179734,  -8157255,  -8134756,  -8112238,
+     -8089701,  -8067145,  -8044570,  -8021976,  -7999364,  -7976732,  -7954082,  -7931413,
+     -7908725,  -7886019,  -7863294,  -7840550,  -7817788,  -7795008,  -7772209,  -7749393,
+     -7726557,  -7703704,  -7680833,  -7657943,  -7635036,  -7612110,  -7589167,  -7566205,
+     -7543226,  -7520230,  -7497215,  -7474183,  -7451133,  -7428066,  -7404981,  -7381879,
+     -7358759,  -7335623,  -7312468,  -7289297,  -7266109,  -7242903,  -7219680,  -7196441,
+     -7173184,  -7149911,  -7126620,  -7103313,  -7079990,  -7056649,  -7033292,  -7009919,
+     -6986529,  -6963122,  -6939699,  -6916260,  -6892805,  -6869333,  -6845845,  -6822341,
+     -6798821,  -6775285,  -6751733,  -6728165,  -6704582,  -6680982,  -6657367,  -6633736,
+     -6610090,  -6586428,  -6562750,  -6539057,  -6515349,  -6491625,  -6467886,  -6444132,
+     -6420363,  -6396578,  -6372779,  -6348964,  -6325135,  -6301290,  -6277431,  -6253557,
+     -6229669,  -6205765,  -6181848,  -6157915,  -6133968,  -6110007,  -6086031,  -6062041,
+     -6038037,  -6014018,  -5989986,  -5965939,  -5941878,  -5917803,  -5893714,  -5869612,
+     -5845495,  -5821365,  -5797221,  -5773064,  -5748893,  -5724708,  -5700510,  -5676299,
+     -5652074,  -5627836,  -5603584,  -5579320,  -5555042,  -5530751,  -5506447,  -5482131,
+     -5457801,  -5433459,  -5409103,  -5384735,  -5360355,  -5335961,  -5311555,  -5287137,
+     -5262706,  -5238263,  -5213808,  -5189340,  -5164860,  -5140368,  -5115864,  -5091347,
+     -5066819,  -5042279,  -5017727,  -4993163,  -4968587,  -4944000,  -4919401,  -4894791,
+     -4870169,  -4845535,  -4820890,  -4796234,  -4771567,  -4746888,  -4722198,  -4697497,
+     -4672785,  -4648062,  -4623328,  -4598583,  -4573827,  -4549061,  -4524284,  -4499496,
+     -4474698,  -4449889,  -4425069,  -4400239,  -4375399,  -4350549,  -4325688,  -4300817,
+     -4275936,  -4251045,  -4226144,  -4201233,  -4176312,  -4151381,  -4126441,  -4101491,
+     -4076531,  -4051562,  -4026583,  -4001594,  -3976596,  -3951589,  -3926572,  -3901547,
+     -3876512,  -3851468,  -3826415,  -3801352,  -3776281,  -3751201,  -3726113,  -3701015,
+     -3675909,  -3650794,  -3625670,  -3600538,  -3575398,  -3550249,  -3525092,  -3499926,
+     -3474752,  -3449570,  -3424380,  -3399182,  -3373976,  -3348762,  -3323540,  -3298310,
+     -3273072,  -3247827,  -3222574,  -3197314,  -3172046,  -3146770,  -3121487,  -3096197,
+     -3070900,  -3045595,  -3020283,  -2994964,  -2969638,  -2944305,  -2918965,  -2893618,
+     -2868265,  -2842904,  -2817537,  -2792163,  -2766783,  -2741396,  -2716003,  -2690603,
+     -2665197,  -2639785,  -2614367,  -2588942,  -2563511,  -2538075,  -2512632,  -2487183,
+     -2461729,  -2436269,  -2410803,  -2385331,  -2359854,  -2334371,  -2308883,  -2283389,
+     -2257890,  -2232385,  -2206875,  -2181361,  -2155841,  -2130315,  -2104785,  -2079250,
+     -2053710,  -2028166,  -2002616,  -1977062,  -1951503,  -1925939,  -1900371,  -1874799,
+     -1849222,  -1823640,  -1798055,  -1772465,  -1746871,  -1721273,  -1695671,  -1670065,
+     -1644455,  -1618841,  -1593223,  -1567602,  -1541976,  -1516348,  -1490715,  -1465079,
+     -1439440,  -1413797,  -1388151,  -1362502,  -1336849,  -1311194,  -1285535,  -1259873,
+     -1234209,  -1208541,  -1182870,  -1157197,  -1131521,  -1105843,  -1080161,  -1054478,
+     -1028791,  -1003103,   -977411,   -951718,   -926023,   -900325,   -874625,   -848923,
+      -823219,   -797513,   -771805,   -746096,   -720384,   -694671,   -668957,   -643240,
+      -617523,   -591804,   -566083,   -540361,   -514638,   -488913,   -463188,   -437461,
+      -411733,   -386005,   -360275,   -334545,   -308814,   -283082,   -257349,   -231616,
+      -205882,   -180148,   -154413,   -128678,   -102943,    -77208,    -51472,    -25736,
+            0,     25736,     51472,     77208,    102943,    128678,    154413,    180148,
+       205882,    231616,    257349,    283082,    308814,    334545,    360275,    386005,
+       411733,    437461,    463188,    488913,    514638,    540361,    566083,    591804,
+       617523,    643240,    668957,    694671,    720384,    746096,    771805,    797513,
+       823219,    848923,    874625,    900325,    926023,    951718,    977411,   1003103,
+      1028791,   1054478,   1080161,   1105843,   1131521,   1157197,   1182870,   1208541,
+      1234209,   1259873,   1285535,   1311194,   1336849,   1362502,   1388151,   1413797,
+      1439440,   1465079,   1490715,   1516348,   1541976,   1567602,   1593223,   1618841,
+      1644455,   1670065,   1695671,   1721273,   1746871,   1772465,   1798055,   1823640,
+      1849222,   1874799,   1900371,   1925939,   1951503,   1977062,   2002616,   2028166,
+      2053710,   2079250,   2104785,   2130315,   2155841,   2181361,   2206875,   2232385,
+      2257890,   2283389,   2308883,   2334371,   2359854,   2385331,   2410803,   2436269,
+      2461729,   2487183,   2512632,   2538075,   2563511,   2588942,   2614367,   2639785,
+      2665197,   2690603,   2716003,   2741396,   2766783,   2792163,   2817537,   2842904,
+      2868265,   2893618,   2918965,   2944305,   2969638,   2994964,   3020283,   3045595,
+      3070900,   3096197,   3121487,   3146770,   3172046,   3197314,   3222574,   3247827,
+      3273072,   3298310,   3323540,   3348762,   3373976,   3399182,   3424380,   3449570,
+      3474752,   3499926,   3525092,   3550249,   3575398,   3600538,   3625670,   3650794,
+      3675909,   3701015,   3726113,   3751201,   3776281,   3801352,   3826415,   3851468,
+      3876512,   3901547,   3926572,   3951589,   3976596,   4001594,   4026583,   4051562,
+      4076531,   4101491,   4126441,   4151381,   4176312,   4201233,   4226144,   4251045,
+      4275936,   4300817,   4325688,   4350549,   4375399,   4400239,   4425069,   4449889,
+      4474698,   4499496,   4524284,   4549061,   4573827,   4598583,   4623328,   4648062,
+      4672785,   4697497,   4722198,   4746888,   4771567,   4796234,   4820890,   4845535,
+      4870169,   4894791,   4919401,   4944000,   4968587,   4993163,   5017727,   5042279,
+      5066819,   5091347,   5115864,   5140368,   5164860,   5189340,   5213808,   5238263,
+      5262706,   5287137,   5311555,   5335961,   5360355,   5384735,   5409103,   5433459,
+      5457801,   5482131,   5506447,   5530751,   5555042,   5579320,   5603584,   5627836,
+      5652074,   5676299,   5700510,   5724708,   5748893,   5773064,   5797221,   5821365,
+      5845495,   5869612,   5893714,   5917803,   5941878,   5965939,   5989986,   6014018,
+      6038037,   6062041,   6086031,   6110007,   6133968,   6157915,   6181848,   6205765,
+      6229669,   6253557,   6277431,   6301290,   6325135,   6348964,   6372779,   6396578,
+      6420363,   6444132,   6467886,   6491625,   6515349,   6539057,   6562750,   6586428,
+      6610090,   6633736,   6657367,   6680982,   6704582,   6728165,   6751733,   6775285,
+      6798821,   6822341,   6845845,   6869333,   6892805,   6916260,   6939699,   6963122,
+      6986529,   7009919,   7033292,   7056649,   7079990,   7103313,   7126620,   7149911,
+      7173184,   7196441,   7219680,   7242903,   7266109,   7289297,   7312468,   7335623,
+      7358759,   7381879,   7404981,   7428066,   7451133,   7474183,   7497215,   7520230,
+      7543226,   7566205,   7589167,   7612110,   7635036,   7657943,   7680833,   7703704,
+      7726557,   7749393,   7772209,   7795008,   7817788,   7840550,   7863294,   7886019,
+      7908725,   7931413,   7954082,   7976732,   7999364,   8021976,   8044570,   8067145,
+      8089701,   8112238,   8134756,   8157255,   8179734,   8202195,   8224636,   8247057,
+      8269459,   8291842,   8314205,   8336549,   8358873,   8381178,   8403462,   8425727,
+      8447972,   8470197,   8492403,   8514588,   8536753,   8558898,   8581023,   8603128,
+      8625213,   8647277,   8669321,   8691345,   8713348,   8735330,   8757292,   8779234,
+      8801154,   8823054,   8844934,   8866792,   8888630,   8910447,   8932242,   8954017,
+      8975771,   8997503,   9019214,   9040905,   9062573,   9084221,   9105847,   9127452,
+      9149035,   9170597,   9192137,   9213655,   9235152,   9256627,   9278081,   9299512,
+      9320922,   9342309,   9363675,   9385019,   9406340,   9427640,   9448917,   9470172,
+      9491405,   9512615,   9533803,   9554969,   9576112,   9597232,   9618330,   9639406,
+      9660458,   9681488,   9702495,   9723480,   9744441,   9765380,   9786295,   9807188,
+      9828057,   9848903,   9869727,   9890526,   9911303,   9932056,   9952786,   9973493,
+      9994176,  10014835,  10035471,  10056084,  10076672,  10097237,  10117779,  10138296,
+     10158790,  10179259,  10199705,  10220127,  10240524,  10260898,  10281247,  10301572,
+     10321873,  10342150,  10362402,  10382630,  10402834,  10423013,  10443167,  10463297,
+     10483403,  10503483,  10523539,  10543570,  10563577,  10583558,  10603515,  10623447,
+     10643353,  10663235,  10683091,  10702923,  10722729,  10742510,  10762266,  10781996,
+     10801701,  10821380,  10841035,  10860663,  10880266,  10899844,  10919395,  10938922,
+     10958422,  10977896,  10997345,  11016768,  11036165,  11055536,  11074881,  11094200,
+     11113493,  11132759,  11152000,  11171214,  11190402,  11209563,  11228699,  11247807,
+     11266890,  11285945,  11304975,  11323977,  11342953,  11361903,  11380825,  11399721,
+     11418590,  11437432,  11456247,  11475035,  11493797,  11512531,  11531238,  11549918,
+     11568571,  11587196,  11605794,  11624365,  11642909,  11661425,  11679914,  11698375,
+     11716809,  11735215,  11753594,  11771945,  11790268,  11808564,  11826831,  11845071,
+     11863283,  11881467,  11899623,  11917752,  11935852,  11953924,  11971967,  11989983,
+     12007971,  12025930,  12043861,  12061763,  12079638,  12097483,  12115301,  12133089,
+     12150850,  12168581,  12186284,  12203959,  12221604,  12239221,  12256809,  12274369,
+     12291899,  12309400,  12326873,  12344316,  12361731,  12379116,  12396472,  12413799,
+     12431097,  12448366,  12465605,  12482815,  12499995,  12517147,  12534268,  12551360,
+     12568423,  12585456,  12602460,  12619433,  12636378,  12653292,  12670177,  12687031,
+     12703856,  12720651,  12737417,  12754152,  12770857,  12787532,  12804177,  12820792,
+     12837376,  12853931,  12870455,  12886949,  12903413,  12919846,  12936249,  12952621,
+     12968963,  12985275,  13001556,  13017806,  13034026,  13050215,  13066373,  13082500,
+     13098597,  13114663,  13130698,  13146702,  13162675,  13178618,  13194529,  13210409,
+     13226258,  13242076,  13257863,  13273619,  13289343,  13305036,  13320698,  13336329,
+     13351928,  13367495,  13383032,  13398536,  13414009,  13429451,  13444861,  13460240,
+     13475586,  13490901,  13506185,  13521436,  13536656,  13551844,  13566999,  13582123,
+     13597215,  13612276,  13627304,  13642299,  13657263,  13672195,  13687095,  13701962,
+     13716797,  13731600,  13746370,  13761108,  13775814,  13790488,  13805129,  13819737,
+     13834313,  13848856,  13863367,  13877845,  13892291,  13906703,  13921083,  13935431,
+     13949745,  13964027,  13978276,  13992492,  14006675,  14020825,  14034942,  14049026,
+     14063077,  14077095,  14091080,  14105031,  14118950,  14132835,  14146687,  14160505,
+     14174291,  14188043,  14201761,  14215446,  14229098,  14242716,  14256301,  14269852,
+     14283370,  14296854,  14310304,  14323721,  14337104,  14350453,  14363769,  14377050,
+     14390298,  14403512,  14416692,  14429838,  14442951,  14456029,  14469073,  14482083,
+     14495059,  14508001,  14520909,  14533783,  14546622,  14559427,  14572198,  14584935,
+     14597637,  14610305,  14622939,  14635538,  14648103,  14660633,  14673129,  14685590,
+     14698017,  14710409,  14722767,  14735090,  14747378,  14759632,  14771850,  14784034,
+     14796184,  14808298,  14820378,  14832422,  14844432,  14856407,  14868347,  14880252,
+     14892122,  14903957,  14915756,  14927521,  14939251,  14950945,  14962604,  14974228,
+     14985817,  14997371,  15008889,  15020372,  15031819,  15043232,  15054608,  15065950,
+     15077256,  15088526,  15099761,  15110960,  15122124,  15133253,  15144345,  15155402,
+     15166424,  15177409,  15188359,  15199273,  15210152,  15220995,  15231801,  15242572,
+     15253308,  15264007,  15274670,  15285298,  15295889,  15306444,  15316964,  15327447,
+     15337895,  15348306,  15358681,  15369020,  15379323,  15389589,  15399820,  15410014,
+     15420172,  15430293,  15440379,  15450427,  15460440,  15470416,  15480356,  15490260,
+     15500126,  15509957,  15519751,  15529508,  15539229,  15548914,  15558561,  15568173,
+     15577747,  15587285,  15596786,  15606251,  15615678,  15625069,  15634424,  15643741,
+     15653022,  15662266,  15671472,  15680643,  15689776,  15698872,  15707931,  15716954,
+     15725939,  15734887,  15743799,  15752673,  15761510,  15770310,  15779073,  15787799,
+     15796488,  15805140,  15813754,  15822331,  15830871,  15839374,  15847839,  15856268,
+     15864658,  15873012,  15881328,  15889607,  15897848,  15906052,  15914219,  15922348,
+     15930439,  15938494,  15946510,  15954489,  15962431,  15970335,  15978201,  15986030,
+     15993821,  16001575,  16009291,  16016969,  16024610,  16032213,  16039778,  16047305,
+     16054795,  16062247,  16069661,  16077037,  16084375,  16091676,  16098939,  16106163,
+     16113350,  16120499,  16127610,  16134683,  16141719,  16148716,  16155675,  16162596,
+     16169479,  16176324,  16183131,  16189900,  16196631,  16203324,  16209978,  16216595,
+     16223173,  16229713,  16236215,  16242679,  16249104,  16255492,  16261841,  16268151,
+     16274424,  16280658,  16286854,  16293011,  16299131,  16305211,  16311254,  16317258,
+     16323224,  16329151,  16335040,  16340890,  16346702,  16352476,  16358211,  16363907,
+     16369565,  16375185,  16380766,  16386308,  16391812,  16397277,  16402704,  16408092,
+     16413442,  16418753,  16424025,  16429259,  16434454,  16439610,  16444727,  16449806,
+     16454846,  16459848,  16464811,  16469735,  16474620,  16479466,  16484274,  16489043,
+     16493773,  16498464,  16503117,  16507731,  16512305,  16516841,  16521338,  16525797,
+     16530216,  16534596,  16538938,  16543240,  16547504,  16551729,  16555914,  16560061,
+     16564169,  16568238,  16572268,  16576259,  16580211,  16584124,  16587997,  16591832,
+     16595628,  16599385,  16603102,  16606781,  16610420,  16614021,  16617582,  16621104,
+     16624588,  16628032,  16631436,  16634802,  16638129,  16641416,  16644664,  16647874,
+     16651044,  16654174,  16657266,  16660318,  16663331,  16666305,  16669240,  16672136,
+     16674992,  16677809,  16680587,  16683325,  16686025,  16688685,  16691305,  16693887,
+     16696429,  16698932,  16701396,  16703820,  16706205,  16708551,  16710857,  16713124,
+     16715352,  16717540,  16719689,  16721799,  16723869,  16725900,  16727892,  16729844,
+     16731757,  16733631,  16735465,  16737260,  16739015,  16740731,  16742408,  16744045,
+     16745643,  16747202,  16748721,  16750200,  16751640,  16753041,  16754403,  16755725,
+     16757007,  16758250,  16759454,  16760618,  16761743,  16762828,  16763874,  16764881,
+     16765847,  16766775,  16767663,  16768512,  16769321,  16770091,  16770821,  16771512,
+     16772163,  16772775,  16773347,  16773880,  16774374,  16774828,  16775242,  16775617,
+     16775953,  16776249,  16776505,  16776723,  16776900,  16777038,  16777137,  16777196,
+     16777216,
+#else /* HEXTER_USE_FLOATING_POINT */
+         1.00000000f,     0.999998808f,     0.999995291f,     0.999989390f,
+        0.999981165f,     0.999970615f,     0.999957621f,     0.999942362f,
+        0.999924719f,     0.999904692f,     0.999882340f,     0.999857664f,
+        0.999830604f,     0.999801159f,     0.999769390f,     0.999735296f,
+        0.999698818f,     0.999660015f,     0.999618828f,     0.999575317f,
+        0.999529421f,     0.999481201f,     0.999430597f,     0.999377668f,
+        0.999322355f,     0.999264777f,     0.999204755f,     0.999142408f,
+        0.999077737f,     0.999010682f,     0.998941302f,     0.998869538f,
+        0.998795450f,     0.998719037f,     0.998640239f,     0.998559058f,
+        0.998475552f,     0.998389721f,     0.998301566f,     0.998211026f,
+        0.998118103f,     0.998022854f,     0.997925282f,     0.997825325f,
+        0.997723043f,     0.997618437f,     0.997511446f,     0.997402132f,
+        0.997290432f,     0.997176409f,     0.997060061f,     0.996941328f,
+        0.996820271f,     0.996696889f,     0.996571124f,     0.996443033f,
+        0.996312618f,     0.996179819f,     0.996044695f,     0.995907247f,
+        0.995767415f,     0.995625257f,     0.995480776f,     0.995333910f,
+        0.995184720f,     0.995033205f,     0.994879305f,     0.994723141f,
+        0.994564593f,     0.994403660f,     0.994240463f,     0.994074881f,
+        0.993906975f,     0.993736744f,     0.993564129f,     0.993389189f,
+        0.993211925f,     0.993032336f,     0.992850423f,     0.992666125f,
+        0.992479563f,     0.992290616f,     0.992099285f,     0.991905689f,
+        0.991709769f,     0.991511464f,     0.991310835f,     0.991107941f,
+        0.990902662f,     0.990695000f,     0.990485072f,     0.990272820f,
+        0.990058184f,     0.989841282f,     0.989621997f,     0.989400446f,
+        0.989176512f,     0.988950253f,     0.988721669f,     0.988490820f,
+        0.988257587f,     0.988022029f,     0.987784147f,     0.987543941f,
+        0.987301409f,     0.987056553f,     0.986809373f,     0.986559927f,
+        0.986308098f,     0.986053944f,     0.985797524f,     0.985538721f,
+        0.985277653f,     0.985014260f,     0.984748483f,     0.984480441f,
+        0.984210074f,     0.983937442f,     0.983662426f,     0.983385086f,
+        0.983105481f,     0.982823551f,     0.982539296f,     0.982252717f,
+        0.981963873f,     0.981672704f,     0.981379211f,     0.981083393f,
+        0.980785251f,     0.980484843f,     0.980182111f,     0.979877114f,
+        0.979569793f,     0.979260147f,     0.978948176f,     0.978633940f,
+        0.978317380f,     0.977998495f,     0.977677345f,     0.977353871f,
+        0.977028131f,     0.976700068f,     0.976369739f,     0.976037085f,
+        0.975702107f,     0.975364864f,     0.975025356f,     0.974683523f,
+        0.974339366f,     0.973992944f,     0.973644257f,     0.973293245f,
+        0.972939968f,     0.972584367f,     0.972226501f,     0.971866310f,
+        0.971503913f,     0.971139133f,     0.970772147f,     0.970402837f,
+        0.970031261f,     0.969657362f,     0.969281256f,     0.968902826f,
+        0.968522072f,     0.968139112f,     0.967753828f,     0.967366278f,
+        0.966976464f,     0.966584384f,     0.966189981f,     0.965793371f,
+        0.965394437f,     0.964993238f,     0.964589775f,     0.964184046f,
+        0.963776052f,     0.963365793f,     0.962953269f,     0.962538481f,
+        0.962121427f,     0.961702049f,     0.961280465f,     0.960856616f,
+        0.960430503f,     0.960002124f,     0.959571540f,     0.959138632f,
+        0.958703458f,     0.958266079f,     0.957826436f,     0.957384527f,
+        0.956940353f,     0.956493914f,     0.956045270f,     0.955594361f,
+        0.955141187f,     0.954685748f,     0.954228103f,     0.953768194f,
+        0.953306019f,     0.952841640f,     0.952374995f,     0.951906145f,
+        0.951435030f,     0.950961649f,     0.950486064f,     0.950008273f,
+        0.949528158f,     0.949045897f,     0.948561370f,     0.948074579f,
+        0.947585583f,     0.947094381f,     0.946600914f,     0.946105242f,
+        0.945607305f,     0.945107222f,     0.944604814f,     0.944100261f,
+        0.943593442f,     0.943084419f,     0.942573190f,     0.942059755f,
+        0.941544056f,     0.941026151f,     0.940506041f,     0.939983726f,
+        0.939459205f,     0.938932478f,     0.938403547f,     0.937872350f,
+        0.937339008f,     0.936803460f,     0.936265647f,     0.935725689f,
+        0.935183525f,     0.934639156f,     0.934092522f,     0.933543801f,
+        0.932992816f,     0.932439625f,     0.931884289f,     0.931326687f,
+        0.930766940f,     0.930205047f,     0.929640889f,     0.929074585f,
+        0.928506076f,     0.927935421f,     0.927362502f,     0.926787496f,
+        0.926210225f,     0.925630808f,     0.925049245f,     0.924465477f,
+        0.923879504f,     0.923291445f,     0.922701120f,     0.922108650f,
+        0.921514034f,     0.920917213f,     0.920318305f,     0.919717133f,
+        0.919113874f,     0.918508410f,     0.917900801f,     0.917290986f,
+        0.916679084f,     0.916064978f,     0.915448725f,     0.914830327f,
+        0.914209783f,     0.913587034f,     0.912962198f,     0.912335157f,
+        0.911706030f,     0.911074758f,     0.910441279f,     0.909805715f,
+        0.909168005f,     0.908528090f,     0.907886088f,     0.907242000f,
+        0.906595707f,     0.905947268f,     0.905296743f,     0.904644072f,
+        0.903989315f,     0.903332353f,     0.902673304f,     0.902012169f,
+        0.901348829f,     0.900683403f,     0.900015891f,     0.899346232f,
+        0.898674488f,     0.898000598f,     0.897324562f,     0.896646500f,
+        0.895966232f,     0.895283937f,     0.894599497f,     0.893912971f,
+        0.893224299f,     0.892533541f,     0.891840696f,     0.891145766f,
+        0.890448749f,     0.889749587f,     0.889048338f,     0.888345063f,
+        0.887639642f,     0.886932135f,     0.886222541f,     0.885510862f,
+        0.884797096f,     0.884081244f,     0.883363366f,     0.882643342f,
+        0.881921291f,     0.881197095f,     0.880470872f,     0.879742622f,
+        0.879012227f,     0.878279805f,     0.877545297f,     0.876808703f,
+        0.876070082f,     0.875329375f,     0.874586642f,     0.873841822f,
+        0.873094976f,     0.872346044f,     0.871595085f,     0.870842040f,
+        0.870086968f,     0.869329870f,     0.868570685f,     0.867809474f,
+        0.867046237f,     0.866280973f,     0.865513623f,     0.864744246f,
+        0.863972843f,     0.863199413f,     0.862423956f,     0.861646473f,
+        0.860866964f,     0.860085368f,     0.859301805f,     0.858516216f,
+        0.857728601f,     0.856938958f,     0.856147349f,     0.855353653f,
+        0.854557991f,     0.853760302f,     0.852960587f,     0.852158904f,
+        0.851355195f,     0.850549459f,     0.849741757f,     0.848932028f,
+        0.848120332f,     0.847306609f,     0.846490920f,     0.845673263f,
+        0.844853580f,     0.844031870f,     0.843208253f,     0.842382610f,
+        0.841554999f,     0.840725362f,     0.839893818f,     0.839060247f,
+        0.838224709f,     0.837387204f,     0.836547732f,     0.835706294f,
+        0.834862888f,     0.834017515f,     0.833170176f,     0.832320869f,
+        0.831469595f,     0.830616415f,     0.829761207f,     0.828904092f,
+        0.828045070f,     0.827184021f,     0.826321065f,     0.825456142f,
+        0.824589312f,     0.823720515f,     0.822849810f,     0.821977139f,
+        0.821102500f,     0.820225954f,     0.819347501f,     0.818467140f,
+        0.817584813f,     0.816700578f,     0.815814435f,     0.814926326f,
+        0.814036310f,     0.813144386f,     0.812250614f,     0.811354876f,
+        0.810457170f,     0.809557617f,     0.808656156f,     0.807752848f,
+        0.806847572f,     0.805940390f,     0.805031359f,     0.804120362f,
+        0.803207517f,     0.802292824f,     0.801376164f,     0.800457656f,
+        0.799537241f,     0.798614979f,     0.797690868f,     0.796764791f,
+        0.795836926f,     0.794907153f,     0.793975472f,     0.793041945f,
+        0.792106569f,     0.791169345f,     0.790230215f,     0.789289236f,
+        0.788346410f,     0.787401736f,     0.786455214f,     0.785506845f,
+        0.784556568f,     0.783604503f,     0.782650590f,     0.781694829f,
+        0.780737221f,     0.779777765f,     0.778816521f,     0.777853429f,
+        0.776888490f,     0.775921702f,     0.774953127f,     0.773982704f,
+        0.773010433f,     0.772036374f,     0.771060526f,     0.770082831f,
+        0.769103348f,     0.768122017f,     0.767138898f,     0.766153991f,
+        0.765167236f,     0.764178753f,     0.763188422f,     0.762196302f,
+        0.761202395f,     0.760206699f,     0.759209216f,     0.758209884f,
+        0.757208824f,     0.756205976f,     0.755201399f,     0.754194975f,
+        0.753186822f,     0.752176821f,     0.751165152f,     0.750151634f,
+        0.749136388f,     0.748119354f,     0.747100592f,     0.746080101f,
+        0.745057762f,     0.744033754f,     0.743007958f,     0.741980433f,
+        0.740951121f,     0.739920080f,     0.738887310f,     0.737852812f,
+        0.736816585f,     0.735778570f,     0.734738886f,     0.733697414f,
+        0.732654274f,     0.731609404f,     0.730562747f,     0.729514420f,
+        0.728464365f,     0.727412641f,     0.726359129f,     0.725303948f,
+        0.724247098f,     0.723188460f,     0.722128212f,     0.721066177f,
+        0.720002532f,     0.718937099f,     0.717870057f,     0.716801286f,
+        0.715730846f,     0.714658678f,     0.713584840f,     0.712509394f,
+        0.711432219f,     0.710353374f,     0.709272802f,     0.708190620f,
+        0.707106769f,     0.706021249f,     0.704934061f,     0.703845263f,
+        0.702754736f,     0.701662600f,     0.700568795f,     0.699473321f,
+        0.698376238f,     0.697277486f,     0.696177125f,     0.695075095f,
+        0.693971455f,     0.692866147f,     0.691759229f,     0.690650702f,
+        0.689540565f,     0.688428760f,     0.687315345f,     0.686200321f,
+        0.685083687f,     0.683965385f,     0.682845533f,     0.681724072f,
+        0.680601001f,     0.679476321f,     0.678350031f,     0.677222192f,
+        0.676092684f,     0.674961627f,     0.673829019f,     0.672694743f,
+        0.671558976f,     0.670421541f,     0.669282615f,     0.668142021f,
+        0.666999936f,     0.665856242f,     0.664710999f,     0.663564146f,
+        0.662415802f,     0.661265850f,     0.660114348f,     0.658961296f,
+        0.657806695f,     0.656650543f,     0.655492842f,     0.654333591f,
+        0.653172851f,     0.652010560f,     0.650846660f,     0.649681330f,
+        0.648514390f,     0.647345960f,     0.646176040f,     0.645004511f,
+        0.643831551f,     0.642657042f,     0.641481042f,     0.640303493f,
+        0.639124453f,     0.637943923f,     0.636761844f,     0.635578334f,
+        0.634393275f,     0.633206785f,     0.632018745f,     0.630829215f,
+        0.629638255f,     0.628445745f,     0.627251804f,     0.626056373f,
+        0.624859512f,     0.623661101f,     0.622461259f,     0.621259987f,
+        0.620057225f,     0.618852973f,     0.617647290f,     0.616440177f,
+        0.615231574f,     0.614021540f,     0.612810075f,     0.611597180f,
+        0.610382795f,     0.609167039f,     0.607949793f,     0.606731117f,
+        0.605511069f,     0.604289532f,     0.603066623f,     0.601842225f,
+        0.600616455f,     0.599389315f,     0.598160684f,     0.596930683f,
+        0.595699310f,     0.594466507f,     0.593232274f,     0.591996670f,
+        0.590759695f,     0.589521289f,     0.588281572f,     0.587040365f,
+        0.585797846f,     0.584553957f,     0.583308637f,     0.582062006f,
+        0.580813944f,     0.579564571f,     0.578313768f,     0.577061653f,
+        0.575808167f,     0.574553370f,     0.573297143f,     0.572039604f,
+        0.570780754f,     0.569520533f,     0.568258941f,     0.566996038f,
+        0.565731823f,     0.564466238f,     0.563199341f,     0.561931133f,
+        0.560661554f,     0.559390724f,     0.558118522f,     0.556845009f,
+        0.555570245f,     0.554294109f,     0.553016722f,     0.551737964f,
+        0.550457954f,     0.549176633f,     0.547894061f,     0.546610177f,
+        0.545324981f,     0.544038534f,     0.542750776f,     0.541461766f,
+        0.540171444f,     0.538879931f,     0.537587047f,     0.536292970f,
+        0.534997642f,     0.533701003f,     0.532403111f,     0.531104028f,
+        0.529803634f,     0.528501987f,     0.527199149f,     0.525895000f,
+        0.524589658f,     0.523283124f,     0.521975279f,     0.520666242f,
+        0.519356012f,     0.518044531f,     0.516731799f,     0.515417874f,
+        0.514102757f,     0.512786388f,     0.511468828f,     0.510150075f,
+        0.508830130f,     0.507508993f,     0.506186664f,     0.504863083f,
+        0.503538370f,     0.502212465f,     0.500885367f,     0.499557108f,
+        0.498227656f,     0.496897042f,     0.495565265f,     0.494232297f,
+        0.492898196f,     0.491562903f,     0.490226477f,     0.488888890f,
+        0.487550169f,     0.486210287f,     0.484869242f,     0.483527064f,
+        0.482183784f,     0.480839342f,     0.479493767f,     0.478147060f,
+        0.476799220f,     0.475450277f,     0.474100202f,     0.472749025f,
+        0.471396744f,     0.470043331f,     0.468688816f,     0.467333198f,
+        0.465976506f,     0.464618683f,     0.463259786f,     0.461899787f,
+        0.460538715f,     0.459176540f,     0.457813293f,     0.456448972f,
+        0.455083579f,     0.453717113f,     0.452349573f,     0.450980991f,
+        0.449611336f,     0.448240608f,     0.446868837f,     0.445496023f,
+        0.444122136f,     0.442747235f,     0.441371262f,     0.439994276f,
+        0.438616246f,     0.437237173f,     0.435857087f,     0.434475958f,
+        0.433093816f,     0.431710660f,     0.430326492f,     0.428941280f,
+        0.427555084f,     0.426167876f,     0.424779683f,     0.423390478f,
+        0.422000259f,     0.420609087f,     0.419216901f,     0.417823702f,
+        0.416429549f,     0.415034413f,     0.413638324f,     0.412241220f,
+        0.410843164f,     0.409444153f,     0.408044159f,     0.406643212f,
+        0.405241311f,     0.403838456f,     0.402434647f,     0.401029885f,
+        0.399624199f,     0.398217559f,     0.396809995f,     0.395401478f,
+        0.393992037f,     0.392581671f,     0.391170382f,     0.389758170f,
+        0.388345033f,     0.386931002f,     0.385516047f,     0.384100199f,
+        0.382683426f,     0.381265759f,     0.379847199f,     0.378427744f,
+        0.377007425f,     0.375586182f,     0.374164075f,     0.372741073f,
+        0.371317208f,     0.369892448f,     0.368466824f,     0.367040336f,
+        0.365612984f,     0.364184797f,     0.362755716f,     0.361325800f,
+        0.359895051f,     0.358463407f,     0.357030958f,     0.355597675f,
+        0.354163527f,     0.352728546f,     0.351292759f,     0.349856138f,
+        0.348418683f,     0.346980423f,     0.345541328f,     0.344101429f,
+        0.342660725f,     0.341219217f,     0.339776874f,     0.338333756f,
+        0.336889863f,     0.335445136f,     0.333999664f,     0.332553357f,
+        0.331106305f,     0.329658449f,     0.328209847f,     0.326760441f,
+        0.325310290f,     0.323859364f,     0.322407693f,     0.320955247f,
+        0.319502026f,     0.318048090f,     0.316593379f,     0.315137923f,
+        0.313681751f,     0.312224805f,     0.310767144f,     0.309308767f,
+        0.307849646f,     0.306389809f,     0.304929227f,     0.303467959f,
+        0.302005947f,     0.300543249f,     0.299079835f,     0.297615707f,
+        0.296150893f,     0.294685364f,     0.293219149f,     0.291752249f,
+        0.290284663f,     0.288816422f,     0.287347466f,     0.285877824f,
+        0.284407526f,     0.282936573f,     0.281464934f,     0.279992640f,
+        0.278519690f,     0.277046084f,     0.275571823f,     0.274096906f,
+        0.272621363f,     0.271145165f,     0.269668311f,     0.268190861f,
+        0.266712755f,     0.265234023f,     0.263754666f,     0.262274712f,
+        0.260794103f,     0.259312928f,     0.257831097f,     0.256348670f,
+        0.254865646f,     0.253382027f,     0.251897812f,     0.250413001f,
+        0.248927608f,     0.247441620f,     0.245955050f,     0.244467899f,
+        0.242980182f,     0.241491884f,     0.240003020f,     0.238513589f,
+        0.237023607f,     0.235533059f,     0.234041959f,     0.232550308f,
+        0.231058106f,     0.229565367f,     0.228072077f,     0.226578265f,
+        0.225083917f,     0.223589033f,     0.222093627f,     0.220597684f,
+        0.219101235f,     0.217604280f,     0.216106802f,     0.214608818f,
+        0.213110313f,     0.211611331f,     0.210111842f,     0.208611846f,
+        0.207111374f,     0.205610409f,     0.204108968f,     0.202607036f,
+        0.201104641f,     0.199601755f,     0.198098406f,     0.196594596f,
+        0.195090324f,     0.193585590f,     0.192080393f,     0.190574750f,
+        0.189068660f,     0.187562123f,     0.186055154f,     0.184547737f,
+        0.183039889f,     0.181531608f,     0.180022895f,     0.178513765f,
+        0.177004218f,     0.175494254f,     0.173983872f,     0.172473088f,
+        0.170961887f,     0.169450298f,     0.167938292f,     0.166425899f,
+        0.164913118f,     0.163399950f,     0.161886394f,     0.160372451f,
+        0.158858150f,     0.157343462f,     0.155828401f,     0.154312968f,
+        0.152797192f,     0.151281044f,     0.149764538f,     0.148247674f,
+        0.146730468f,     0.145212919f,     0.143695027f,     0.142176807f,
+        0.140658244f,     0.139139339f,     0.137620121f,     0.136100575f,
+        0.134580702f,     0.133060530f,     0.131540030f,     0.130019218f,
+        0.128498107f,     0.126976699f,     0.125454977f,     0.123932973f,
+        0.122410677f,     0.120888084f,     0.119365215f,     0.117842063f,
+        0.116318628f,     0.114794925f,     0.113270953f,     0.111746714f,
+        0.110222206f,     0.108697444f,     0.107172422f,     0.105647154f,
+        0.104121633f,     0.102595866f,     0.101069860f,    0.0995436162f,
+       0.0980171412f,    0.0964904279f,    0.0949634984f,    0.0934363380f,
+       0.0919089541f,    0.0903813615f,    0.0888535529f,    0.0873255357f,
+       0.0857973099f,    0.0842688903f,    0.0827402622f,    0.0812114477f,
+       0.0796824396f,    0.0781532452f,    0.0766238645f,    0.0750942975f,
+       0.0735645667f,    0.0720346496f,    0.0705045760f,    0.0689743310f,
+       0.0674439222f,    0.0659133494f,    0.0643826276f,    0.0628517568f,
+       0.0613207370f,    0.0597895719f,    0.0582582653f,    0.0567268208f,
+       0.0551952459f,    0.0536635369f,    0.0521317050f,    0.0505997501f,
+       0.0490676761f,    0.0475354828f,    0.0460031815f,    0.0444707721f,
+       0.0429382585f,    0.0414056405f,    0.0398729257f,    0.0383401215f,
+       0.0368072242f,    0.0352742374f,    0.0337411724f,    0.0322080255f,
+       0.0306748040f,    0.0291415080f,    0.0276081450f,    0.0260747187f,
+       0.0245412290f,    0.0230076816f,    0.0214740802f,    0.0199404284f,
+       0.0184067301f,    0.0168729872f,    0.0153392060f,    0.0138053885f,
+       0.0122715384f,    0.0107376594f,   0.00920375437f,   0.00766982883f,
+      0.00613588467f,   0.00460192608f,   0.00306795677f,   0.00153398013f,
+     6.12323426e-17f,  -0.00153398013f,  -0.00306795677f,  -0.00460192608f,
+     -0.00613588467f,  -0.00766982883f,  -0.00920375437f,   -0.0107376594f,
+      -0.0122715384f,   -0.0138053885f,   -0.0153392060f,   -0.0168729872f,
+      -0.0184067301f,   -0.0199404284f,   -0.0214740802f,   -0.0230076816f,
+      -0.0245412290f,   -0.0260747187f,   -0.0276081450f,   -0.0291415080f,
+      -0.0306748040f,   -0.0322080255f,   -0.0337411724f,   -0.0352742374f,
+      -0.0368072242f,   -0.0383401215f,   -0.0398729257f,   -0.0414056405f,
+      -0.0429382585f,   -0.0444707721f,   -0.0460031815f,   -0.0475354828f,
+      -0.0490676761f,   -0.0505997501f,   -0.0521317050f,   -0.0536635369f,
+      -0.0551952459f,   -0.0567268208f,   -0.0582582653f,   -0.0597895719f,
+      -0.0613207370f,   -0.0628517568f,   -0.0643826276f,   -0.0659133494f,
+      -0.0674439222f,   -0.0689743310f,   -0.0705045760f,   -0.0720346496f,
+      -0.0735645667f,   -0.0750942975f,   -0.0766238645f,   -0.0781532452f,
+      -0.0796824396f,   -0.0812114477f,   -0.0827402622f,   -0.0842688903f,
+      -0.0857973099f,   -0.0873255357f,   -0.0888535529f,   -0.0903813615f,
+      -0.0919089541f,   -0.0934363380f,   -0.0949634984f,   -0.0964904279f,
+      -0.0980171412f,   -0.0995436162f,    -0.101069860f,    -0.102595866f,
+       -0.104121633f,    -0.105647154f,    -0.107172422f,    -0.108697444f,
+       -0.110222206f,    -0.111746714f,    -0.113270953f,    -0.114794925f,
+       -0.116318628f,    -0.117842063f,    -0.119365215f,    -0.120888084f,
+       -0.122410677f,    -0.123932973f,    -0.125454977f,    -0.126976699f,
+       -0.128498107f,    -0.130019218f,    -0.131540030f,    -0.133060530f,
+       -0.134580702f,    -0.136100575f,    -0.137620121f,    -0.139139339f,
+       -0.140658244f,    -0.142176807f,    -0.143695027f,    -0.145212919f,
+       -0.146730468f,    -0.148247674f,    -0.149764538f,    -0.151281044f,
+       -0.152797192f,    -0.154312968f,    -0.155828401f,    -0.157343462f,
+       -0.158858150f,    -0.160372451f,    -0.161886394f,    -0.163399950f,
+       -0.164913118f,    -0.166425899f,    -0.167938292f,    -0.169450298f,
+       -0.170961887f,    -0.172473088f,    -0.173983872f,    -0.175494254f,
+       -0.177004218f,    -0.178513765f,    -0.180022895f,    -0.181531608f,
+       -0.183039889f,    -0.184547737f,    -0.186055154f,    -0.187562123f,
+       -0.189068660f,    -0.190574750f,    -0.192080393f,    -0.193585590f,
+       -0.195090324f,    -0.196594596f,    -0.198098406f,    -0.199601755f,
+       -0.201104641f,    -0.202607036f,    -0.204108968f,    -0.205610409f,
+       -0.207111374f,    -0.208611846f,    -0.210111842f,    -0.211611331f,
+       -0.213110313f,    -0.214608818f,    -0.216106802f,    -0.217604280f,
+       -0.219101235f,    -0.220597684f,    -0.222093627f,    -0.223589033f,
+       -0.225083917f,    -0.226578265f,    -0.228072077f,    -0.229565367f,
+       -0.231058106f,    -0.232550308f,    -0.234041959f,    -0.235533059f,
+       -0.237023607f,    -0.238513589f,    -0.240003020f,    -0.241491884f,
+       -0.242980182f,    -0.244467899f,    -0.245955050f,    -0.247441620f,
+       -0.248927608f,    -0.250413001f,    -0.251897812f,    -0.253382027f,
+       -0.254865646f,    -0.256348670f,    -0.257831097f,    -0.259312928f,
+       -0.260794103f,    -0.262274712f,    -0.263754666f,    -0.265234023f,
+       -0.266712755f,    -0.268190861f,    -0.269668311f,    -0.271145165f,
+       -0.272621363f,    -0.274096906f,    -0.275571823f,    -0.277046084f,
+       -0.278519690f,    -0.279992640f,    -0.281464934f,    -0.282936573f,
+       -0.284407526f,    -0.285877824f,    -0.287347466f,    -0.288816422f,
+       -0.290284663f,    -0.291752249f,    -0.293219149f,    -0.294685364f,
+       -0.296150893f,    -0.297615707f,    -0.299079835f,    -0.300543249f,
+       -0.302005947f,    -0.303467959f,    -0.304929227f,    -0.306389809f,
+       -0.307849646f,    -0.309308767f,    -0.310767144f,    -0.312224805f,
+       -0.313681751f,    -0.315137923f,    -0.316593379f,    -0.318048090f,
+       -0.319502026f,    -0.320955247f,    -0.322407693f,    -0.323859364f,
+       -0.325310290f,    -0.326760441f,    -0.328209847f,    -0.329658449f,
+       -0.331106305f,    -0.332553357f,    -0.333999664f,    -0.335445136f,
+       -0.336889863f,    -0.338333756f,    -0.339776874f,    -0.341219217f,
+       -0.342660725f,    -0.344101429f,    -0.345541328f,    -0.346980423f,
+       -0.348418683f,    -0.349856138f,    -0.351292759f,    -0.352728546f,
+       -0.354163527f,    -0.355597675f,    -0.357030958f,    -0.358463407f,
+       -0.359895051f,    -0.361325800f,    -0.362755716f,    -0.364184797f,
+       -0.365612984f,    -0.367040336f,    -0.368466824f,    -0.369892448f,
+       -0.371317208f,    -0.372741073f,    -0.374164075f,    -0.375586182f,
+       -0.377007425f,    -0.378427744f,    -0.379847199f,    -0.381265759f,
+       -0.382683426f,    -0.384100199f,    -0.385516047f,    -0.386931002f,
+       -0.388345033f,    -0.389758170f,    -0.391170382f,    -0.392581671f,
+       -0.393992037f,    -0.395401478f,    -0.396809995f,    -0.398217559f,
+       -0.399624199f,    -0.401029885f,    -0.402434647f,    -0.403838456f,
+       -0.405241311f,    -0.406643212f,    -0.408044159f,    -0.409444153f,
+       -0.410843164f,    -0.412241220f,    -0.413638324f,    -0.415034413f,
+       -0.416429549f,    -0.417823702f,    -0.419216901f,    -0.420609087f,
+       -0.422000259f,    -0.423390478f,    -0.424779683f,    -0.426167876f,
+       -0.427555084f,    -0.428941280f,    -0.430326492f,    -0.431710660f,
+       -0.433093816f,    -0.434475958f,    -0.435857087f,    -0.437237173f,
+       -0.438616246f,    -0.439994276f,    -0.441371262f,    -0.442747235f,
+       -0.444122136f,    -0.445496023f,    -0.446868837f,    -0.448240608f,
+       -0.449611336f,    -0.450980991f,    -0.452349573f,    -0.453717113f,
+       -0.455083579f,    -0.456448972f,    -0.457813293f,    -0.459176540f,
+       -0.460538715f,    -0.461899787f,    -0.463259786f,    -0.464618683f,
+       -0.465976506f,    -0.467333198f,    -0.468688816f,    -0.470043331f,
+       -0.471396744f,    -0.472749025f,    -0.474100202f,    -0.475450277f,
+       -0.476799220f,    -0.478147060f,    -0.479493767f,    -0.480839342f,
+       -0.482183784f,    -0.483527064f,    -0.484869242f,    -0.486210287f,
+       -0.487550169f,    -0.488888890f,    -0.490226477f,    -0.491562903f,
+       -0.492898196f,    -0.494232297f,    -0.495565265f,    -0.496897042f,
+       -0.498227656f,    -0.499557108f,    -0.500885367f,    -0.502212465f,
+       -0.503538370f,    -0.504863083f,    -0.506186664f,    -0.507508993f,
+       -0.508830130f,    -0.510150075f,    -0.511468828f,    -0.512786388f,
+       -0.514102757f,    -0.515417874f,    -0.516731799f,    -0.518044531f,
+       -0.519356012f,    -0.520666242f,    -0.521975279f,    -0.523283124f,
+       -0.524589658f,    -0.525895000f,    -0.527199149f,    -0.528501987f,
+       -0.529803634f,    -0.531104028f,    -0.532403111f,    -0.533701003f,
+       -0.534997642f,    -0.536292970f,    -0.537587047f,    -0.538879931f,
+       -0.540171444f,    -0.541461766f,    -0.542750776f,    -0.544038534f,
+       -0.545324981f,    -0.546610177f,    -0.547894061f,    -0.549176633f,
+       -0.550457954f,    -0.551737964f,    -0.553016722f,    -0.554294109f,
+       -0.555570245f,    -0.556845009f,    -0.558118522f,    -0.559390724f,
+       -0.560661554f,    -0.561931133f,    -0.563199341f,    -0.564466238f,
+       -0.565731823f,    -0.566996038f,    -0.568258941f,    -0.569520533f,
+       -0.570780754f,    -0.572039604f,    -0.573297143f,    -0.574553370f,
+       -0.575808167f,    -0.577061653f,    -0.578313768f,    -0.579564571f,
+       -0.580813944f,    -0.582062006f,    -0.583308637f,    -0.584553957f,
+       -0.585797846f,    -0.587040365f,    -0.588281572f,    -0.589521289f,
+       -0.590759695f,    -0.591996670f,    -0.593232274f,    -0.594466507f,
+       -0.595699310f,    -0.596930683f,    -0.598160684f,    -0.599389315f,
+       -0.600616455f,    -0.601842225f,    -0.603066623f,    -0.604289532f,
+       -0.605511069f,    -0.606731117f,    -0.607949793f,    -0.609167039f,
+       -0.610382795f,    -0.611597180f,    -0.612810075f,    -0.614021540f,
+       -0.615231574f,    -0.616440177f,    -0.617647290f,    -0.618852973f,
+       -0.620057225f,    -0.621259987f,    -0.622461259f,    -0.623661101f,
+       -0.624859512f,    -0.626056373f,    -0.627251804f,    -0.628445745f,
+       -0.629638255f,    -0.630829215f,    -0.632018745f,    -0.633206785f,
+       -0.634393275f,    -0.635578334f,    -0.636761844f,    -0.637943923f,
+       -0.639124453f,    -0.640303493f,    -0.641481042f,    -0.642657042f,
+       -0.643831551f,    -0.645004511f,    -0.646176040f,    -0.647345960f,
+       -0.648514390f,    -0.649681330f,    -0.650846660f,    -0.652010560f,
+       -0.653172851f,    -0.654333591f,    -0.655492842f,    -0.656650543f,
+       -0.657806695f,    -0.658961296f,    -0.660114348f,    -0.661265850f,
+       -0.662415802f,    -0.663564146f,    -0.664710999f,    -0.665856242f,
+       -0.666999936f,    -0.668142021f,    -0.669282615f,    -0.670421541f,
+       -0.671558976f,    -0.672694743f,    -0.673829019f,    -0.674961627f,
+       -0.676092684f,    -0.677222192f,    -0.678350031f,    -0.679476321f,
+       -0.680601001f,    -0.681724072f,    -0.682845533f,    -0.683965385f,
+       -0.685083687f,    -0.686200321f,    -0.687315345f,    -0.688428760f,
+       -0.689540565f,    -0.690650702f,    -0.691759229f,    -0.692866147f,
+       -0.693971455f,    -0.695075095f,    -0.696177125f,    -0.697277486f,
+       -0.698376238f,    -0.699473321f,    -0.700568795f,    -0.701662600f,
+       -0.702754736f,    -0.703845263f,    -0.704934061f,    -0.706021249f,
+       -0.707106769f,    -0.708190620f,    -0.709272802f,    -0.710353374f,
+       -0.711432219f,    -0.712509394f,    -0.713584840f,    -0.714658678f,
+       -0.715730846f,    -0.716801286f,    -0.717870057f,    -0.718937099f,
+       -0.720002532f,    -0.721066177f,    -0.722128212f,    -0.723188460f,
+       -0.724247098f,    -0.725303948f,    -0.726359129f,    -0.727412641f,
+       -0.728464365f,    -0.729514420f,    -0.730562747f,    -0.731609404f,
+       -0.732654274f,    -0.733697414f,    -0.734738886f,    -0.735778570f,
+       -0.736816585f,    -0.737852812f,    -0.738887310f,    -0.739920080f,
+       -0.740951121f,    -0.741980433f,    -0.743007958f,    -0.744033754f,
+       -0.745057762f,    -0.746080101f,    -0.747100592f,    -0.748119354f,
+       -0.749136388f,    -0.750151634f,    -0.751165152f,    -0.752176821f,
+       -0.753186822f,    -0.754194975f,    -0.755201399f,    -0.756205976f,
+       -0.757208824f,    -0.758209884f,    -0.759209216f,    -0.760206699f,
+       -0.761202395f,    -0.762196302f,    -0.763188422f,    -0.764178753f,
+       -0.765167236f,    -0.766153991f,    -0.767138898f,    -0.768122017f,
+       -0.769103348f,    -0.770082831f,    -0.771060526f,    -0.772036374f,
+       -0.773010433f,    -0.773982704f,    -0.774953127f,    -0.775921702f,
+       -0.776888490f,    -0.777853429f,    -0.778816521f,    -0.779777765f,
+       -0.780737221f,    -0.781694829f,    -0.782650590f,    -0.783604503f,
+       -0.784556568f,    -0.785506845f,    -0.786455214f,    -0.787401736f,
+       -0.788346410f,    -0.789289236f,    -0.790230215f,    -0.791169345f,
+       -0.792106569f,    -0.793041945f,    -0.793975472f,    -0.794907153f,
+       -0.795836926f,    -0.796764791f,    -0.797690868f,    -0.798614979f,
+       -0.799537241f,    -0.800457656f,    -0.801376164f,    -0.802292824f,
+       -0.803207517f,    -0.804120362f,    -0.805031359f,    -0.805940390f,
+       -0.806847572f,    -0.807752848f,    -0.808656156f,    -0.809557617f,
+       -0.810457170f,    -0.811354876f,    -0.812250614f,    -0.813144386f,
+       -0.814036310f,    -0.814926326f,    -0.815814435f,    -0.816700578f,
+       -0.817584813f,    -0.818467140f,    -0.819347501f,    -0.820225954f,
+       -0.821102500f,    -0.821977139f,    -0.822849810f,    -0.823720515f,
+       -0.824589312f,    -0.825456142f,    -0.826321065f,    -0.827184021f,
+       -0.828045070f,    -0.828904092f,    -0.829761207f,    -0.830616415f,
+       -0.831469595f,    -0.832320869f,    -0.833170176f,    -0.834017515f,
+       -0.834862888f,    -0.835706294f,    -0.836547732f,    -0.837387204f,
+       -0.838224709f,    -0.839060247f,    -0.839893818f,    -0.840725362f,
+       -0.841554999f,    -0.842382610f,    -0.843208253f,    -0.844031870f,
+       -0.844853580f,    -0.845673263f,    -0.846490920f,    -0.847306609f,
+       -0.848120332f,    -0.848932028f,    -0.849741757f,    -0.850549459f,
+       -0.851355195f,    -0.852158904f,    -0.852960587f,    -0.853760302f,
+       -0.854557991f,    -0.855353653f,    -0.856147349f,    -0.856938958f,
+       -0.857728601f,    -0.858516216f,    -0.859301805f,    -0.860085368f,
+       -0.860866964f,    -0.861646473f,    -0.862423956f,    -0.863199413f,
+       -0.863972843f,    -0.864744246f,    -0.865513623f,    -0.866280973f,
+       -0.867046237f,    -0.867809474f,    -0.868570685f,    -0.869329870f,
+       -0.870086968f,    -0.870842040f,    -0.871595085f,    -0.872346044f,
+       -0.873094976f,    -0.873841822f,    -0.874586642f,    -0.875329375f,
+       -0.876070082f,    -0.876808703f,    -0.877545297f,    -0.878279805f,
+       -0.879012227f,    -0.879742622f,    -0.880470872f,    -0.881197095f,
+       -0.881921291f,    -0.882643342f,    -0.883363366f,    -0.884081244f,
+       -0.884797096f,    -0.885510862f,    -0.886222541f,    -0.886932135f,
+       -0.887639642f,    -0.888345063f,    -0.889048338f,    -0.889749587f,
+       -0.890448749f,    -0.891145766f,    -0.891840696f,    -0.892533541f,
+       -0.893224299f,    -0.893912971f,    -0.894599497f,    -0.895283937f,
+       -0.895966232f,    -0.896646500f,    -0.897324562f,    -0.898000598f,
+       -0.898674488f,    -0.899346232f,    -0.900015891f,    -0.900683403f,
+       -0.901348829f,    -0.902012169f,    -0.902673304f,    -0.903332353f,
+       -0.903989315f,    -0.904644072f,    -0.905296743f,    -0.905947268f,
+       -0.906595707f,    -0.907242000f,    -0.907886088f,    -0.908528090f,
+       -0.909168005f,    -0.909805715f,    -0.910441279f,    -0.911074758f,
+       -0.911706030f,    -0.912335157f,    -0.912962198f,    -0.913587034f,
+       -0.914209783f,    -0.914830327f,    -0.915448725f,    -0.916064978f,
+       -0.916679084f,    -0.917290986f,    -0.917900801f,    -0.918508410f,
+       -0.919113874f,    -0.919717133f,    -0.920318305f,    -0.920917213f,
+       -0.921514034f,    -0.922108650f,    -0.922701120f,    -0.923291445f,
+       -0.923879504f,    -0.924465477f,    -0.925049245f,    -0.925630808f,
+       -0.926210225f,    -0.926787496f,    -0.927362502f,    -0.927935421f,
+       -0.928506076f,    -0.929074585f,    -0.929640889f,    -0.930205047f,
+       -0.930766940f,    -0.931326687f,    -0.931884289f,    -0.932439625f,
+       -0.932992816f,    -0.933543801f,    -0.934092522f,    -0.934639156f,
+       -0.935183525f,    -0.935725689f,    -0.936265647f,    -0.936803460f,
+       -0.937339008f,    -0.937872350f,    -0.938403547f,    -0.938932478f,
+       -0.939459205f,    -0.939983726f,    -0.940506041f,    -0.941026151f,
+       -0.941544056f,    -0.942059755f,    -0.942573190f,    -0.943084419f,
+       -0.943593442f,    -0.944100261f,    -0.944604814f,    -0.945107222f,
+       -0.945607305f,    -0.946105242f,    -0.946600914f,    -0.947094381f,
+       -0.947585583f,    -0.948074579f,    -0.948561370f,    -0.949045897f,
+       -0.949528158f,    -0.950008273f,    -0.950486064f,    -0.950961649f,
+       -0.951435030f,    -0.951906145f,    -0.952374995f,    -0.952841640f,
+       -0.953306019f,    -0.953768194f,    -0.954228103f,    -0.954685748f,
+       -0.955141187f,    -0.955594361f,    -0.956045270f,    -0.956493914f,
+       -0.956940353f,    -0.957384527f,    -0.957826436f,    -0.958266079f,
+       -0.958703458f,    -0.959138632f,    -0.959571540f,    -0.960002124f,
+       -0.960430503f,    -0.960856616f,    -0.961280465f,    -0.961702049f,
+       -0.962121427f,    -0.962538481f,    -0.962953269f,    -0.963365793f,
+       -0.963776052f,    -0.964184046f,    -0.964589775f,    -0.964993238f,
+       -0.965394437f,    -0.965793371f,    -0.966189981f,    -0.966584384f,
+       -0.966976464f,    -0.967366278f,    -0.967753828f,    -0.968139112f,
+       -0.968522072f,    -0.968902826f,    -0.969281256f,    -0.969657362f,
+       -0.970031261f,    -0.970402837f,    -0.970772147f,    -0.971139133f,
+       -0.971503913f,    -0.971866310f,    -0.972226501f,    -0.972584367f,
+       -0.972939968f,    -0.973293245f,    -0.973644257f,    -0.973992944f,
+       -0.974339366f,    -0.974683523f,    -0.975025356f,    -0.975364864f,
+       -0.975702107f,    -0.976037085f,    -0.976369739f,    -0.976700068f,
+       -0.977028131f,    -0.977353871f,    -0.977677345f,    -0.977998495f,
+       -0.978317380f,    -0.978633940f,    -0.978948176f,    -0.979260147f,
+       -0.979569793f,    -0.979877114f,    -0.980182111f,    -0.980484843f,
+       -0.980785251f,    -0.981083393f,    -0.981379211f,    -0.981672704f,
+       -0.981963873f,    -0.982252717f,    -0.982539296f,    -0.982823551f,
+       -0.983105481f,    -0.983385086f,    -0.983662426f,    -0.983937442f,
+       -0.984210074f,    -0.984480441f,    -0.984748483f,    -0.985014260f,
+       -0.985277653f,    -0.985538721f,    -0.985797524f,    -0.986053944f,
+       -0.986308098f,    -0.986559927f,    -0.986809373f,    -0.987056553f,
+       -0.987301409f,    -0.987543941f,    -0.987784147f,    -0.988022029f,
+       -0.988257587f,    -0.988490820f,    -0.988721669f,    -0.988950253f,
+       -0.989176512f,    -0.989400446f,    -0.989621997f,    -0.989841282f,
+       -0.990058184f,    -0.990272820f,    -0.990485072f,    -0.990695000f,
+       -0.990902662f,    -0.991107941f,    -0.991310835f,    -0.991511464f,
+       -0.991709769f,    -0.991905689f,    -0.992099285f,    -0.992290616f,
+       -0.992479563f,    -0.992666125f,    -0.992850423f,    -0.993032336f,
+       -0.993211925f,    -0.993389189f,    -0.993564129f,    -0.993736744f,
+       -0.993906975f,    -0.994074881f,    -0.994240463f,    -0.994403660f,
+       -0.994564593f,    -0.994723141f,    -0.994879305f,    -0.995033205f,
+       -0.995184720f,    -0.995333910f,    -0.995480776f,    -0.995625257f,
+       -0.995767415f,    -0.995907247f,    -0.996044695f,    -0.996179819f,
+       -0.996312618f,    -0.996443033f,    -0.996571124f,    -0.996696889f,
+       -0.996820271f,    -0.996941328f,    -0.997060061f,    -0.997176409f,
+       -0.997290432f,    -0.997402132f,    -0.997511446f,    -0.997618437f,
+       -0.997723043f,    -0.997825325f,    -0.997925282f,    -0.998022854f,
+       -0.998118103f,    -0.998211026f,    -0.998301566f,    -0.998389721f,
+       -0.998475552f,    -0.998559058f,    -0.998640239f,    -0.998719037f,
+       -0.998795450f,    -0.998869538f,    -0.998941302f,    -0.999010682f,
+       -0.999077737f,    -0.999142408f,    -0.999204755f,    -0.999264777f,
+       -0.999322355f,    -0.999377668f,    -0.999430597f,    -0.999481201f,
+       -0.999529421f,    -0.999575317f,    -0.999618828f,    -0.999660015f,
+       -0.999698818f,    -0.999735296f,    -0.999769390f,    -0.999801159f,
+       -0.999830604f,    -0.999857664f,    -0.999882340f,    -0.999904692f,
+       -0.999924719f,    -0.999942362f,    -0.999957621f,    -0.999970615f,
+       -0.999981165f,    -0.999989390f,    -0.999995291f,    -0.999998808f,
+        -1.00000000f,    -0.999998808f,    -0.999995291f,    -0.999989390f,
+       -0.999981165f,    -0.999970615f,    -0.999957621f,    -0.999942362f,
+       -0.999924719f,    -0.999904692f,    -0.999882340f,    -0.999857664f,
+       -0.999830604f,    -0.999801159f,    -0.999769390f,    -0.999735296f,
+       -0.999698818f,    -0.999660015f,    -0.999618828f,    -0.999575317f,
+       -0.999529421f,    -0.999481201f,    -0.999430597f,    -0.999377668f,
+       -0.999322355f,    -0.999264777f,    -0.999204755f,    -0.999142408f,
+       -0.999077737f,    -0.999010682f,    -0.998941302f,    -0.998869538f,
+       -0.998795450f,    -0.998719037f,    -0.998640239f,    -0.998559058f,
+       -0.998475552f,    -0.998389721f,    -0.998301566f,    -0.998211026f,
+       -0.998118103f,    -0.998022854f,    -0.997925282f,    -0.997825325f,
+       -0.997723043f,    -0.997618437f,    -0.997511446f,    -0.997402132f,
+       -0.997290432f,    -0.997176409f,    -0.997060061f,    -0.996941328f,
+       -0.996820271f,    -0.996696889f,    -0.996571124f,    -0.996443033f,
+       -0.996312618f,    -0.996179819f,    -0.996044695f,    -0.995907247f,
+       -0.995767415f,    -0.995625257f,    -0.995480776f,    -0.995333910f,
+       -0.995184720f,    -0.995033205f,    -0.994879305f,    -0.994723141f,
+       -0.994564593f,    -0.994403660f,    -0.994240463f,    -0.994074881f,
+       -0.993906975f,    -0.993736744f,    -0.993564129f,    -0.993389189f,
+       -0.993211925f,    -0.993032336f,    -0.992850423f,    -0.992666125f,
+       -0.992479563f,    -0.992290616f,    -0.992099285f,    -0.991905689f,
+       -0.991709769f,    -0.991511464f,    -0.991310835f,    -0.991107941f,
+       -0.990902662f,    -0.990695000f,    -0.990485072f,    -0.990272820f,
+       -0.990058184f,    -0.989841282f,    -0.989621997f,    -0.989400446f,
+       -0.989176512f,    -0.988950253f,    -0.988721669f,    -0.988490820f,
+       -0.988257587f,    -0.988022029f,    -0.987784147f,    -0.987543941f,
+       -0.987301409f,    -0.987056553f,    -0.986809373f,    -0.986559927f,
+       -0.986308098f,    -0.986053944f,    -0.985797524f,    -0.985538721f,
+       -0.985277653f,    -0.985014260f,    -0.984748483f,    -0.984480441f,
+       -0.984210074f,    -0.983937442f,    -0.983662426f,    -0.983385086f,
+       -0.983105481f,    -0.982823551f,    -0.982539296f,    -0.982252717f,
+       -0.981963873f,    -0.981672704f,    -0.981379211f,    -0.981083393f,
+       -0.980785251f,    -0.980484843f,    -0.980182111f,    -0.979877114f,
+       -0.979569793f,    -0.979260147f,    -0.978948176f,    -0.978633940f,
+       -0.978317380f,    -0.977998495f,    -0.977677345f,    -0.977353871f,
+       -0.977028131f,    -0.976700068f,    -0.976369739f,    -0.976037085f,
+       -0.975702107f,    -0.975364864f,    -0.975025356f,    -0.974683523f,
+       -0.974339366f,    -0.973992944f,    -0.973644257f,    -0.973293245f,
+       -0.972939968f,    -0.972584367f,    -0.972226501f,    -0.971866310f,
+       -0.971503913f,    -0.971139133f,    -0.970772147f,    -0.970402837f,
+       -0.970031261f,    -0.969657362f,    -0.969281256f,    -0.968902826f,
+       -0.968522072f,    -0.968139112f,    -0.967753828f,    -0.967366278f,
+       -0.966976464f,    -0.966584384f,    -0.966189981f,    -0.965793371f,
+       -0.965394437f,    -0.964993238f,    -0.964589775f,    -0.964184046f,
+       -0.963776052f,    -0.963365793f,    -0.962953269f,    -0.962538481f,
+       -0.962121427f,    -0.961702049f,    -0.961280465f,    -0.960856616f,
+       -0.960430503f,    -0.960002124f,    -0.959571540f,    -0.959138632f,
+       -0.958703458f,    -0.958266079f,    -0.957826436f,    -0.957384527f,
+       -0.956940353f,    -0.956493914f,    -0.956045270f,    -0.955594361f,
+       -0.955141187f,    -0.954685748f,    -0.954228103f,    -0.953768194f,
+       -0.953306019f,    -0.952841640f,    -0.952374995f,    -0.951906145f,
+       -0.951435030f,    -0.950961649f,    -0.950486064f,    -0.950008273f,
+       -0.949528158f,    -0.949045897f,    -0.948561370f,    -0.948074579f,
+       -0.947585583f,    -0.947094381f,    -0.946600914f,    -0.946105242f,
+       -0.945607305f,    -0.945107222f,    -0.944604814f,    -0.944100261f,
+       -0.943593442f,    -0.943084419f,    -0.942573190f,    -0.942059755f,
+       -0.941544056f,    -0.941026151f,    -0.940506041f,    -0.939983726f,
+       -0.939459205f,    -0.938932478f,    -0.938403547f,    -0.937872350f,
+       -0.937339008f,    -0.936803460f,    -0.936265647f,    -0.935725689f,
+       -0.935183525f,    -0.934639156f,    -0.934092522f,    -0.933543801f,
+       -0.932992816f,    -0.932439625f,    -0.931884289f,    -0.931326687f,
+       -0.930766940f,    -0.930205047f,    -0.929640889f,    -0.929074585f,
+       -0.928506076f,    -0.927935421f,    -0.927362502f,    -0.926787496f,
+       -0.926210225f,    -0.925630808f,    -0.925049245f,    -0.924465477f,
+       -0.923879504f,    -0.923291445f,    -0.922701120f,    -0.922108650f,
+       -0.921514034f,    -0.920917213f,    -0.920318305f,    -0.919717133f,
+       -0.919113874f,    -0.918508410f,    -0.917900801f,    -0.917290986f,
+       -0.916679084f,    -0.916064978f,    -0.915448725f,    -0.914830327f,
+       -0.914209783f,    -0.913587034f,    -0.912962198f,    -0.912335157f,
+       -0.911706030f,    -0.911074758f,    -0.910441279f,    -0.909805715f,
+       -0.909168005f,    -0.908528090f,    -0.907886088f,    -0.907242000f,
+       -0.906595707f,    -0.905947268f,    -0.905296743f,    -0.904644072f,
+       -0.903989315f,    -0.903332353f,    -0.902673304f,    -0.902012169f,
+       -0.901348829f,    -0.900683403f,    -0.900015891f,    -0.899346232f,
+       -0.898674488f,    -0.898000598f,    -0.897324562f,    -0.896646500f,
+       -0.895966232f,    -0.895283937f,    -0.894599497f,    -0.893912971f,
+       -0.893224299f,    -0.892533541f,    -0.891840696f,    -0.891145766f,
+       -0.890448749f,    -0.889749587f,    -0.889048338f,    -0.888345063f,
+       -0.887639642f,    -0.886932135f,    -0.886222541f,    -0.885510862f,
+       -0.884797096f,    -0.884081244f,    -0.883363366f,    -0.882643342f,
+       -0.881921291f,    -0.881197095f,    -0.880470872f,    -0.879742622f,
+       -0.879012227f,    -0.878279805f,    -0.877545297f,    -0.876808703f,
+       -0.876070082f,    -0.875329375f,    -0.874586642f,    -0.873841822f,
+       -0.873094976f,    -0.872346044f,    -0.871595085f,    -0.870842040f,
+       -0.870086968f,    -0.869329870f,    -0.868570685f,    -0.867809474f,
+       -0.867046237f,    -0.866280973f,    -0.865513623f,    -0.864744246f,
+       -0.863972843f,    -0.863199413f,    -0.862423956f,    -0.861646473f,
+       -0.860866964f,    -0.860085368f,    -0.859301805f,    -0.858516216f,
+       -0.857728601f,    -0.856938958f,    -0.856147349f,    -0.855353653f,
+       -0.854557991f,    -0.853760302f,    -0.852960587f,    -0.852158904f,
+       -0.851355195f,    -0.850549459f,    -0.849741757f,    -0.848932028f,
+       -0.848120332f,    -0.847306609f,    -0.846490920f,    -0.845673263f,
+       -0.844853580f,    -0.844031870f,    -0.843208253f,    -0.842382610f,
+       -0.841554999f,    -0.840725362f,    -0.839893818f,    -0.839060247f,
+       -0.838224709f,    -0.837387204f,    -0.836547732f,    -0.835706294f,
+       -0.834862888f,    -0.834017515f,    -0.833170176f,    -0.832320869f,
+       -0.831469595f,    -0.830616415f,    -0.829761207f,    -0.828904092f,
+       -0.828045070f,    -0.827184021f,    -0.826321065f,    -0.825456142f,
+       -0.824589312f,    -0.823720515f,    -0.822849810f,    -0.821977139f,
+       -0.821102500f,    -0.820225954f,    -0.819347501f,    -0.818467140f,
+       -0.817584813f,    -0.816700578f,    -0.815814435f,    -0.814926326f,
+       -0.814036310f,    -0.813144386f,    -0.812250614f,    -0.811354876f,
+       -0.810457170f,    -0.809557617f,    -0.808656156f,    -0.807752848f,
+       -0.806847572f,    -0.805940390f,    -0.805031359f,    -0.804120362f,
+       -0.803207517f,    -0.802292824f,    -0.801376164f,    -0.800457656f,
+       -0.799537241f,    -0.798614979f,    -0.797690868f,    -0.796764791f,
+       -0.795836926f,    -0.794907153f,    -0.793975472f,    -0.793041945f,
+       -0.792106569f,    -0.791169345f,    -0.790230215f,    -0.789289236f,
+       -0.788346410f,    -0.787401736f,    -0.786455214f,    -0.785506845f,
+       -0.784556568f,    -0.783604503f,    -0.782650590f,    -0.781694829f,
+       -0.780737221f,    -0.779777765f,    -0.778816521f,    -0.777853429f,
+       -0.776888490f,    -0.775921702f,    -0.774953127f,    -0.773982704f,
+       -0.773010433f,    -0.772036374f,    -0.771060526f,    -0.770082831f,
+       -0.769103348f,    -0.768122017f,    -0.767138898f,    -0.766153991f,
+       -0.765167236f,    -0.764178753f,    -0.763188422f,    -0.762196302f,
+       -0.761202395f,    -0.760206699f,    -0.759209216f,    -0.758209884f,
+       -0.757208824f,    -0.756205976f,    -0.755201399f,    -0.754194975f,
+       -0.753186822f,    -0.752176821f,    -0.751165152f,    -0.750151634f,
+       -0.749136388f,    -0.748119354f,    -0.747100592f,    -0.746080101f,
+       -0.745057762f,    -0.744033754f,    -0.743007958f,    -0.741980433f,
+       -0.740951121f,    -0.739920080f,    -0.738887310f,    -0.737852812f,
+       -0.736816585f,    -0.735778570f,    -0.734738886f,    -0.733697414f,
+       -0.732654274f,    -0.731609404f,    -0.730562747f,    -0.729514420f,
+       -0.728464365f,    -0.727412641f,    -0.726359129f,    -0.725303948f,
+       -0.724247098f,    -0.723188460f,    -0.722128212f,    -0.721066177f,
+       -0.720002532f,    -0.718937099f,    -0.717870057f,    -0.716801286f,
+       -0.715730846f,    -0.714658678f,    -0.713584840f,    -0.712509394f,
+       -0.711432219f,    -0.710353374f,    -0.709272802f,    -0.708190620f,
+       -0.707106769f,    -0.706021249f,    -0.704934061f,    -0.703845263f,
+       -0.702754736f,    -0.701662600f,    -0.700568795f,    -0.699473321f,
+       -0.698376238f,    -0.697277486f,    -0.696177125f,    -0.695075095f,
+       -0.693971455f,    -0.692866147f,    -0.691759229f,    -0.690650702f,
+       -0.689540565f,    -0.688428760f,    -0.687315345f,    -0.686200321f,
+       -0.685083687f,    -0.683965385f,    -0.682845533f,    -0.681724072f,
+       -0.680601001f,    -0.679476321f,    -0.678350031f,    -0.677222192f,
+       -0.676092684f,    -0.674961627f,    -0.673829019f,    -0.672694743f,
+       -0.671558976f,    -0.670421541f,    -0.669282615f,    -0.668142021f,
+       -0.666999936f,    -0.665856242f,    -0.664710999f,    -0.663564146f,
+       -0.662415802f,    -0.661265850f,    -0.660114348f,    -0.658961296f,
+       -0.657806695f,    -0.656650543f,    -0.655492842f,    -0.654333591f,
+       -0.653172851f,    -0.652010560f,    -0.650846660f,    -0.649681330f,
+       -0.648514390f,    -0.647345960f,    -0.646176040f,    -0.645004511f,
+       -0.643831551f,    -0.642657042f,    -0.641481042f,    -0.640303493f,
+       -0.639124453f,    -0.637943923f,    -0.636761844f,    -0.635578334f,
+       -0.634393275f,    -0.633206785f,    -0.632018745f,    -0.630829215f,
+       -0.629638255f,    -0.628445745f,    -0.627251804f,    -0.626056373f,
+       -0.624859512f,    -0.623661101f,    -0.622461259f,    -0.621259987f,
+       -0.620057225f,    -0.618852973f,    -0.617647290f,    -0.616440177f,
+       -0.615231574f,    -0.614021540f,    -0.612810075f,    -0.611597180f,
+       -0.610382795f,    -0.609167039f,    -0.607949793f,    -0.606731117f,
+       -0.605511069f,    -0.604289532f,    -0.603066623f,    -0.601842225f,
+       -0.600616455f,    -0.599389315f,    -0.598160684f,    -0.596930683f,
+       -0.595699310f,    -0.594466507f,    -0.593232274f,    -0.591996670f,
+       -0.590759695f,    -0.589521289f,    -0.588281572f,    -0.587040365f,
+       -0.585797846f,    -0.584553957f,    -0.583308637f,    -0.582062006f,
+       -0.580813944f,    -0.579564571f,    -0.578313768f,    -0.577061653f,
+       -0.575808167f,    -0.574553370f,    -0.573297143f,    -0.572039604f,
+       -0.570780754f,    -0.569520533f,    -0.568258941f,    -0.566996038f,
+       -0.565731823f,    -0.564466238f,    -0.563199341f,    -0.561931133f,
+       -0.560661554f,    -0.559390724f,    -0.558118522f,    -0.556845009f,
+       -0.555570245f,    -0.554294109f,    -0.553016722f,    -0.551737964f,
+       -0.550457954f,    -0.549176633f,    -0.547894061f,    -0.546610177f,
+       -0.545324981f,    -0.544038534f,    -0.542750776f,    -0.541461766f,
+       -0.540171444f,    -0.538879931f,    -0.537587047f,    -0.536292970f,
+       -0.534997642f,    -0.533701003f,    -0.532403111f,    -0.531104028f,
+       -0.529803634f,    -0.528501987f,    -0.527199149f,    -0.525895000f,
+       -0.524589658f,    -0.523283124f,    -0.521975279f,    -0.520666242f,
+       -0.519356012f,    -0.518044531f,    -0.516731799f,    -0.515417874f,
+       -0.514102757f,    -0.512786388f,    -0.511468828f,    -0.510150075f,
+       -0.508830130f,    -0.507508993f,    -0.506186664f,    -0.504863083f,
+       -0.503538370f,    -0.502212465f,    -0.500885367f,    -0.499557108f,
+       -0.498227656f,    -0.496897042f,    -0.495565265f,    -0.494232297f,
+       -0.492898196f,    -0.491562903f,    -0.490226477f,    -0.488888890f,
+       -0.487550169f,    -0.486210287f,    -0.484869242f,    -0.483527064f,
+       -0.482183784f,    -0.480839342f,    -0.479493767f,    -0.478147060f,
+       -0.476799220f,    -0.475450277f,    -0.474100202f,    -0.472749025f,
+       -0.471396744f,    -0.470043331f,    -0.468688816f,    -0.467333198f,
+       -0.465976506f,    -0.464618683f,    -0.463259786f,    -0.461899787f,
+       -0.460538715f,    -0.459176540f,    -0.457813293f,    -0.456448972f,
+       -0.455083579f,    -0.453717113f,    -0.452349573f,    -0.450980991f,
+       -0.449611336f,    -0.448240608f,    -0.446868837f,    -0.445496023f,
+       -0.444122136f,    -0.442747235f,    -0.441371262f,    -0.439994276f,
+       -0.438616246f,    -0.437237173f,    -0.435857087f,    -0.434475958f,
+       -0.433093816f,    -0.431710660f,    -0.430326492f,    -0.428941280f,
+       -0.427555084f,    -0.426167876f,    -0.424779683f,    -0.423390478f,
+       -0.422000259f,    -0.420609087f,    -0.419216901f,    -0.417823702f,
+       -0.416429549f,    -0.415034413f,    -0.413638324f,    -0.412241220f,
+       -0.410843164f,    -0.409444153f,    -0.408044159f,    -0.406643212f,
+       -0.405241311f,    -0.403838456f,    -0.402434647f,    -0.401029885f,
+       -0.399624199f,    -0.398217559f,    -0.396809995f,    -0.395401478f,
+       -0.393992037f,    -0.392581671f,    -0.391170382f,    -0.389758170f,
+       -0.388345033f,    -0.386931002f,    -0.385516047f,    -0.384100199f,
+       -0.382683426f,    -0.381265759f,    -0.379847199f,    -0.378427744f,
+       -0.377007425f,    -0.375586182f,    -0.374164075f,    -0.372741073f,
+       -0.371317208f,    -0.369892448f,    -0.368466824f,    -0.367040336f,
+       -0.365612984f,    -0.364184797f,    -0.362755716f,    -0.361325800f,
+       -0.359895051f,    -0.358463407f,    -0.357030958f,    -0.355597675f,
+       -0.354163527f,    -0.352728546f,    -0.351292759f,    -0.349856138f,
+       -0.348418683f,    -0.346980423f,    -0.345541328f,    -0.344101429f,
+       -0.342660725f,    -0.341219217f,    -0.339776874f,    -0.338333756f,
+       -0.336889863f,    -0.335445136f,    -0.333999664f,    -0.332553357f,
+       -0.331106305f,    -0.329658449f,    -0.328209847f,    -0.326760441f,
+       -0.325310290f,    -0.323859364f,    -0.322407693f,    -0.320955247f,
+       -0.319502026f,    -0.318048090f,    -0.316593379f,    -0.315137923f,
+       -0.313681751f,    -0.312224805f,    -0.310767144f,    -0.309308767f,
+       -0.307849646f,    -0.306389809f,    -0.304929227f,    -0.303467959f,
+       -0.302005947f,    -0.300543249f,    -0.299079835f,    -0.297615707f,
+       -0.296150893f,    -0.294685364f,    -0.293219149f,    -0.291752249f,
+       -0.290284663f,    -0.288816422f,    -0.287347466f,    -0.285877824f,
+       -0.284407526f,    -0.282936573f,    -0.281464934f,    -0.279992640f,
+       -0.278519690f,    -0.277046084f,    -0.275571823f,    -0.274096906f,
+       -0.272621363f,    -0.271145165f,    -0.269668311f,    -0.268190861f,
+       -0.266712755f,    -0.265234023f,    -0.263754666f,    -0.262274712f,
+       -0.260794103f,    -0.259312928f,    -0.257831097f,    -0.256348670f,
+       -0.254865646f,    -0.253382027f,    -0.251897812f,    -0.250413001f,
+       -0.248927608f,    -0.247441620f,    -0.245955050f,    -0.244467899f,
+       -0.242980182f,    -0.241491884f,    -0.240003020f,    -0.238513589f,
+       -0.237023607f,    -0.235533059f,    -0.234041959f,    -0.232550308f,
+       -0.231058106f,    -0.229565367f,    -0.228072077f,    -0.226578265f,
+       -0.225083917f,    -0.223589033f,    -0.222093627f,    -0.220597684f,
+       -0.219101235f,    -0.217604280f,    -0.216106802f,    -0.214608818f,
+       -0.213110313f,    -0.211611331f,    -0.210111842f,    -0.208611846f,
+       -0.207111374f,    -0.205610409f,    -0.204108968f,    -0.202607036f,
+       -0.201104641f,    -0.199601755f,    -0.198098406f,    -0.196594596f,
+       -0.195090324f,    -0.193585590f,    -0.192080393f,    -0.190574750f,
+       -0.189068660f,    -0.187562123f,    -0.186055154f,    -0.184547737f,
+       -0.183039889f,    -0.181531608f,    -0.180022895f,    -0.178513765f,
+       -0.177004218f,    -0.175494254f,    -0.173983872f,    -0.172473088f,
+       -0.170961887f,    -0.169450298f,    -0.167938292f,    -0.166425899f,
+       -0.164913118f,    -0.163399950f,    -0.161886394f,    -0.160372451f,
+       -0.158858150f,    -0.157343462f,    -0.155828401f,    -0.154312968f,
+       -0.152797192f,    -0.151281044f,    -0.149764538f,    -0.148247674f,
+       -0.146730468f,    -0.145212919f,    -0.143695027f,    -0.142176807f,
+       -0.140658244f,    -0.139139339f,    -0.137620121f,    -0.136100575f,
+       -0.134580702f,    -0.133060530f,    -0.131540030f,    -0.130019218f,
+       -0.128498107f,    -0.126976699f,    -0.125454977f,    -0.123932973f,
+       -0.122410677f,    -0.120888084f,    -0.119365215f,    -0.117842063f,
+       -0.116318628f,    -0.114794925f,    -0.113270953f,    -0.111746714f,
+       -0.110222206f,    -0.108697444f,    -0.107172422f,    -0.105647154f,
+       -0.104121633f,    -0.102595866f,    -0.101069860f,   -0.0995436162f,
+      -0.0980171412f,   -0.0964904279f,   -0.0949634984f,   -0.0934363380f,
+      -0.0919089541f,   -0.0903813615f,   -0.0888535529f,   -0.0873255357f,
+      -0.0857973099f,   -0.0842688903f,   -0.0827402622f,   -0.0812114477f,
+      -0.0796824396f,   -0.0781532452f,   -0.0766238645f,   -0.0750942975f,
+      -0.0735645667f,   -0.0720346496f,   -0.0705045760f,   -0.0689743310f,
+      -0.0674439222f,   -0.0659133494f,   -0.0643826276f,   -0.0628517568f,
+      -0.0613207370f,   -0.0597895719f,   -0.0582582653f,   -0.0567268208f,
+      -0.0551952459f,   -0.0536635369f,   -0.0521317050f,   -0.0505997501f,
+      -0.0490676761f,   -0.0475354828f,   -0.0460031815f,   -0.0444707721f,
+      -0.0429382585f,   -0.0414056405f,   -0.0398729257f,   -0.0383401215f,
+      -0.0368072242f,   -0.0352742374f,   -0.0337411724f,   -0.0322080255f,
+      -0.0306748040f,   -0.0291415080f,   -0.0276081450f,   -0.0260747187f,
+      -0.0245412290f,   -0.0230076816f,   -0.0214740802f,   -0.0199404284f,
+      -0.0184067301f,   -0.0168729872f,   -0.0153392060f,   -0.0138053885f,
+      -0.0122715384f,   -0.0107376594f,  -0.00920375437f,  -0.00766982883f,
+     -0.00613588467f,  -0.00460192608f,  -0.00306795677f,  -0.00153398013f,
+    -1.83697015e-16f,   0.00153398013f,   0.00306795677f,   0.00460192608f,
+      0.00613588467f,   0.00766982883f,   0.00920375437f,    0.0107376594f,
+       0.0122715384f,    0.0138053885f,    0.0153392060f,    0.0168729872f,
+       0.0184067301f,    0.0199404284f,    0.0214740802f,    0.0230076816f,
+       0.0245412290f,    0.0260747187f,    0.0276081450f,    0.0291415080f,
+       0.0306748040f,    0.0322080255f,    0.0337411724f,    0.0352742374f,
+       0.0368072242f,    0.0383401215f,    0.0398729257f,    0.0414056405f,
+       0.0429382585f,    0.0444707721f,    0.0460031815f,    0.0475354828f,
+       0.0490676761f,    0.0505997501f,    0.0521317050f,    0.0536635369f,
+       0.0551952459f,    0.0567268208f,    0.0582582653f,    0.0597895719f,
+       0.0613207370f,    0.0628517568f,    0.0643826276f,    0.0659133494f,
+       0.0674439222f,    0.0689743310f,    0.0705045760f,    0.0720346496f,
+       0.0735645667f,    0.0750942975f,    0.0766238645f,    0.0781532452f,
+       0.0796824396f,    0.0812114477f,    0.0827402622f,    0.0842688903f,
+       0.0857973099f,    0.0873255357f,    0.0888535529f,    0.0903813615f,
+       0.0919089541f,    0.0934363380f,    0.0949634984f,    0.0964904279f,
+       0.0980171412f,    0.0995436162f,     0.101069860f,     0.102595866f,
+        0.104121633f,     0.105647154f,     0.107172422f,     0.108697444f,
+        0.110222206f,     0.111746714f,     0.113270953f,     0.114794925f,
+        0.116318628f,     0.117842063f,     0.119365215f,     0.120888084f,
+        0.122410677f,     0.123932973f,     0.125454977f,     0.126976699f,
+        0.128498107f,     0.130019218f,     0.131540030f,     0.133060530f,
+        0.134580702f,     0.136100575f,     0.137620121f,     0.139139339f,
+        0.140658244f,     0.142176807f,     0.143695027f,     0.145212919f,
+        0.146730468f,     0.148247674f,     0.149764538f,     0.151281044f,
+        0.152797192f,     0.154312968f,     0.155828401f,     0.157343462f,
+        0.158858150f,     0.160372451f,     0.161886394f,     0.163399950f,
+        0.164913118f,     0.166425899f,     0.167938292f,     0.169450298f,
+        0.170961887f,     0.172473088f,     0.173983872f,     0.175494254f,
+        0.177004218f,     0.178513765f,     0.180022895f,     0.181531608f,
+        0.183039889f,     0.184547737f,     0.186055154f,     0.187562123f,
+        0.189068660f,     0.190574750f,     0.192080393f,     0.193585590f,
+        0.195090324f,     0.196594596f,     0.198098406f,     0.199601755f,
+        0.201104641f,     0.202607036f,     0.204108968f,     0.205610409f,
+        0.207111374f,     0.208611846f,     0.210111842f,     0.211611331f,
+        0.213110313f,     0.214608818f,     0.216106802f,     0.217604280f,
+        0.219101235f,     0.220597684f,     0.222093627f,     0.223589033f,
+        0.225083917f,     0.226578265f,     0.228072077f,     0.229565367f,
+        0.231058106f,     0.232550308f,     0.234041959f,     0.235533059f,
+        0.237023607f,     0.238513589f,     0.240003020f,     0.241491884f,
+        0.242980182f,     0.244467899f,     0.245955050f,     0.247441620f,
+        0.248927608f,     0.250413001f,     0.251897812f,     0.253382027f,
+        0.254865646f,     0.256348670f,     0.257831097f,     0.259312928f,
+        0.260794103f,     0.262274712f,     0.263754666f,     0.265234023f,
+        0.266712755f,     0.268190861f,     0.269668311f,     0.271145165f,
+        0.272621363f,     0.274096906f,     0.275571823f,     0.277046084f,
+        0.278519690f,     0.279992640f,     0.281464934f,     0.282936573f,
+        0.284407526f,     0.285877824f,     0.287347466f,     0.288816422f,
+        0.290284663f,     0.291752249f,     0.293219149f,     0.294685364f,
+        0.296150893f,     0.297615707f,     0.299079835f,     0.300543249f,
+        0.302005947f,     0.303467959f,     0.304929227f,     0.306389809f,
+        0.307849646f,     0.309308767f,     0.310767144f,     0.312224805f,
+        0.313681751f,     0.315137923f,     0.316593379f,     0.318048090f,
+        0.319502026f,     0.320955247f,     0.322407693f,     0.323859364f,
+        0.325310290f,     0.326760441f,     0.328209847f,     0.329658449f,
+        0.331106305f,     0.332553357f,     0.333999664f,     0.335445136f,
+        0.336889863f,     0.338333756f,     0.339776874f,     0.341219217f,
+        0.342660725f,     0.344101429f,     0.345541328f,     0.346980423f,
+        0.348418683f,     0.349856138f,     0.351292759f,     0.352728546f,
+        0.354163527f,     0.355597675f,     0.357030958f,     0.358463407f,
+        0.359895051f,     0.361325800f,     0.362755716f,     0.364184797f,
+        0.365612984f,     0.367040336f,     0.368466824f,     0.369892448f,
+        0.371317208f,     0.372741073f,     0.374164075f,     0.375586182f,
+        0.377007425f,     0.378427744f,     0.379847199f,     0.381265759f,
+        0.382683426f,     0.384100199f,     0.385516047f,     0.386931002f,
+        0.388345033f,     0.389758170f,     0.391170382f,     0.392581671f,
+        0.393992037f,     0.395401478f,     0.396809995f,     0.398217559f,
+        0.399624199f,     0.401029885f,     0.402434647f,     0.403838456f,
+        0.405241311f,     0.406643212f,     0.408044159f,     0.409444153f,
+        0.410843164f,     0.412241220f,     0.413638324f,     0.415034413f,
+        0.416429549f,     0.417823702f,     0.419216901f,     0.420609087f,
+        0.422000259f,     0.423390478f,     0.424779683f,     0.426167876f,
+        0.427555084f,     0.428941280f,     0.430326492f,     0.431710660f,
+        0.433093816f,     0.434475958f,     0.435857087f,     0.437237173f,
+        0.438616246f,     0.439994276f,     0.441371262f,     0.442747235f,
+        0.444122136f,     0.445496023f,     0.446868837f,     0.448240608f,
+        0.449611336f,     0.450980991f,     0.452349573f,     0.453717113f,
+        0.455083579f,     0.456448972f,     0.457813293f,     0.459176540f,
+        0.460538715f,     0.461899787f,     0.463259786f,     0.464618683f,
+        0.465976506f,     0.467333198f,     0.468688816f,     0.470043331f,
+        0.471396744f,     0.472749025f,     0.474100202f,     0.475450277f,
+        0.476799220f,     0.478147060f,     0.479493767f,     0.480839342f,
+        0.482183784f,     0.483527064f,     0.484869242f,     0.486210287f,
+        0.487550169f,     0.488888890f,     0.490226477f,     0.491562903f,
+        0.492898196f,     0.494232297f,     0.495565265f,     0.496897042f,
+        0.498227656f,     0.499557108f,     0.500885367f,     0.502212465f,
+        0.503538370f,     0.504863083f,     0.506186664f,     0.507508993f,
+        0.508830130f,     0.510150075f,     0.511468828f,     0.512786388f,
+        0.514102757f,     0.515417874f,     0.516731799f,     0.518044531f,
+        0.519356012f,     0.520666242f,     0.521975279f,     0.523283124f,
+        0.524589658f,     0.525895000f,     0.527199149f,     0.528501987f,
+        0.529803634f,     0.531104028f,     0.532403111f,     0.533701003f,
+        0.534997642f,     0.536292970f,     0.537587047f,     0.538879931f,
+        0.540171444f,     0.541461766f,     0.542750776f,     0.544038534f,
+        0.545324981f,     0.546610177f,     0.547894061f,     0.549176633f,
+        0.550457954f,     0.551737964f,     0.553016722f,     0.554294109f,
+        0.555570245f,     0.556845009f,     0.558118522f,     0.559390724f,
+        0.560661554f,     0.561931133f,     0.563199341f,     0.564466238f,
+        0.565731823f,     0.566996038f,     0.568258941f,     0.569520533f,
+        0.570780754f,     0.572039604f,     0.573297143f,     0.574553370f,
+        0.575808167f,     0.577061653f,     0.578313768f,     0.579564571f,
+        0.580813944f,     0.582062006f,     0.583308637f,     0.584553957f,
+        0.585797846f,     0.587040365f,     0.588281572f,     0.589521289f,
+        0.590759695f,     0.591996670f,     0.593232274f,     0.594466507f,
+        0.595699310f,     0.596930683f,     0.598160684f,     0.599389315f,
+        0.600616455f,     0.601842225f,     0.603066623f,     0.604289532f,
+        0.605511069f,     0.606731117f,     0.607949793f,     0.609167039f,
+        0.610382795f,     0.611597180f,     0.612810075f,     0.614021540f,
+        0.615231574f,     0.616440177f,     0.617647290f,     0.618852973f,
+        0.620057225f,     0.621259987f,     0.622461259f,     0.623661101f,
+        0.624859512f,     0.626056373f,     0.627251804f,     0.628445745f,
+        0.629638255f,     0.630829215f,     0.632018745f,     0.633206785f,
+        0.634393275f,     0.635578334f,     0.636761844f,     0.637943923f,
+        0.639124453f,     0.640303493f,     0.641481042f,     0.642657042f,
+        0.643831551f,     0.645004511f,     0.646176040f,     0.647345960f,
+        0.648514390f,     0.649681330f,     0.650846660f,     0.652010560f,
+        0.653172851f,     0.654333591f,     0.655492842f,     0.656650543f,
+        0.657806695f,     0.658961296f,     0.660114348f,     0.661265850f,
+        0.662415802f,     0.663564146f,     0.664710999f,     0.665856242f,
+        0.666999936f,     0.668142021f,     0.669282615f,     0.670421541f,
+        0.671558976f,     0.672694743f,     0.673829019f,     0.674961627f,
+        0.676092684f,     0.677222192f,     0.678350031f,     0.679476321f,
+        0.680601001f,     0.681724072f,     0.682845533f,     0.683965385f,
+        0.685083687f,     0.686200321f,     0.687315345f,     0.688428760f,
+        0.689540565f,     0.690650702f,     0.691759229f,     0.692866147f,
+        0.693971455f,     0.695075095f,     0.696177125f,     0.697277486f,
+        0.698376238f,     0.699473321f,     0.700568795f,     0.701662600f,
+        0.702754736f,     0.703845263f,     0.704934061f,     0.706021249f,
+        0.707106769f,     0.708190620f,     0.709272802f,     0.710353374f,
+        0.711432219f,     0.712509394f,     0.713584840f,     0.714658678f,
+        0.715730846f,     0.716801286f,     0.717870057f,     0.718937099f,
+        0.720002532f,     0.721066177f,     0.722128212f,     0.723188460f,
+        0.724247098f,     0.725303948f,     0.726359129f,     0.727412641f,
+        0.728464365f,     0.729514420f,     0.730562747f,     0.731609404f,
+        0.732654274f,     0.733697414f,     0.734738886f,     0.735778570f,
+        0.736816585f,     0.737852812f,     0.738887310f,     0.739920080f,
+        0.740951121f,     0.741980433f,     0.743007958f,     0.744033754f,
+        0.745057762f,     0.746080101f,     0.747100592f,     0.748119354f,
+        0.749136388f,     0.750151634f,     0.751165152f,     0.752176821f,
+        0.753186822f,     0.754194975f,     0.755201399f,     0.756205976f,
+        0.757208824f,     0.758209884f,     0.759209216f,     0.760206699f,
+        0.761202395f,     0.762196302f,     0.763188422f,     0.764178753f,
+        0.765167236f,     0.766153991f,     0.767138898f,     0.768122017f,
+        0.769103348f,     0.770082831f,     0.771060526f,     0.772036374f,
+        0.773010433f,     0.773982704f,     0.774953127f,     0.775921702f,
+        0.776888490f,     0.777853429f,     0.778816521f,     0.779777765f,
+        0.780737221f,     0.781694829f,     0.782650590f,     0.783604503f,
+        0.784556568f,     0.785506845f,     0.786455214f,     0.787401736f,
+        0.788346410f,     0.789289236f,     0.790230215f,     0.791169345f,
+        0.792106569f,     0.793041945f,     0.793975472f,     0.794907153f,
+        0.795836926f,     0.796764791f,     0.797690868f,     0.798614979f,
+        0.799537241f,     0.800457656f,     0.801376164f,     0.802292824f,
+        0.803207517f,     0.804120362f,     0.805031359f,     0.805940390f,
+        0.806847572f,     0.807752848f,     0.808656156f,     0.809557617f,
+        0.810457170f,     0.811354876f,     0.812250614f,     0.813144386f,
+        0.814036310f,     0.814926326f,     0.815814435f,     0.816700578f,
+        0.817584813f,     0.818467140f,     0.819347501f,     0.820225954f,
+        0.821102500f,     0.821977139f,     0.822849810f,     0.823720515f,
+        0.824589312f,     0.825456142f,     0.826321065f,     0.827184021f,
+        0.828045070f,     0.828904092f,     0.829761207f,     0.830616415f,
+        0.831469595f,     0.832320869f,     0.833170176f,     0.834017515f,
+        0.834862888f,     0.835706294f,     0.836547732f,     0.837387204f,
+        0.838224709f,     0.839060247f,     0.839893818f,     0.840725362f,
+        0.841554999f,     0.842382610f,     0.843208253f,     0.844031870f,
+        0.844853580f,     0.845673263f,     0.846490920f,     0.847306609f,
+        0.848120332f,     0.848932028f,     0.849741757f,     0.850549459f,
+        0.851355195f,     0.852158904f,     0.852960587f,     0.853760302f,
+        0.854557991f,     0.855353653f,     0.856147349f,     0.856938958f,
+        0.857728601f,     0.858516216f,     0.859301805f,     0.860085368f,
+        0.860866964f,     0.861646473f,     0.862423956f,     0.863199413f,
+        0.863972843f,     0.864744246f,     0.865513623f,     0.866280973f,
+        0.867046237f,     0.867809474f,     0.868570685f,     0.869329870f,
+        0.870086968f,     0.870842040f,     0.871595085f,     0.872346044f,
+        0.873094976f,     0.873841822f,     0.874586642f,     0.875329375f,
+        0.876070082f,     0.876808703f,     0.877545297f,     0.878279805f,
+        0.879012227f,     0.879742622f,     0.880470872f,     0.881197095f,
+        0.881921291f,     0.882643342f,     0.883363366f,     0.884081244f,
+        0.884797096f,     0.885510862f,     0.886222541f,     0.886932135f,
+        0.887639642f,     0.888345063f,     0.889048338f,     0.889749587f,
+        0.890448749f,     0.891145766f,     0.891840696f,     0.892533541f,
+        0.893224299f,     0.893912971f,     0.894599497f,     0.895283937f,
+        0.895966232f,     0.896646500f,     0.897324562f,     0.898000598f,
+        0.898674488f,     0.899346232f,     0.900015891f,     0.900683403f,
+        0.901348829f,     0.902012169f,     0.902673304f,     0.903332353f,
+        0.903989315f,     0.904644072f,     0.905296743f,     0.905947268f,
+        0.906595707f,     0.907242000f,     0.907886088f,     0.908528090f,
+        0.909168005f,     0.909805715f,     0.910441279f,     0.911074758f,
+        0.911706030f,     0.912335157f,     0.912962198f,     0.913587034f,
+        0.914209783f,     0.914830327f,     0.915448725f,     0.916064978f,
+        0.916679084f,     0.917290986f,     0.917900801f,     0.918508410f,
+        0.919113874f,     0.919717133f,     0.920318305f,     0.920917213f,
+        0.921514034f,     0.922108650f,     0.922701120f,     0.923291445f,
+        0.923879504f,     0.924465477f,     0.925049245f,     0.925630808f,
+        0.926210225f,     0.926787496f,     0.927362502f,     0.927935421f,
+        0.928506076f,     0.929074585f,     0.929640889f,     0.930205047f,
+        0.930766940f,     0.931326687f,     0.931884289f,     0.932439625f,
+        0.932992816f,     0.933543801f,     0.934092522f,     0.934639156f,
+        0.935183525f,     0.935725689f,     0.936265647f,     0.936803460f,
+        0.937339008f,     0.937872350f,     0.938403547f,     0.938932478f,
+        0.939459205f,     0.939983726f,     0.940506041f,     0.941026151f,
+        0.941544056f,     0.942059755f,     0.942573190f,     0.943084419f,
+        0.943593442f,     0.944100261f,     0.944604814f,     0.945107222f,
+        0.945607305f,     0.946105242f,     0.946600914f,     0.947094381f,
+        0.947585583f,     0.948074579f,     0.948561370f,     0.949045897f,
+        0.949528158f,     0.950008273f,     0.950486064f,     0.950961649f,
+        0.951435030f,     0.951906145f,     0.952374995f,     0.952841640f,
+        0.953306019f,     0.953768194f,     0.954228103f,     0.954685748f,
+        0.955141187f,     0.955594361f,     0.956045270f,     0.956493914f,
+        0.956940353f,     0.957384527f,     0.957826436f,     0.958266079f,
+        0.958703458f,     0.959138632f,     0.959571540f,     0.960002124f,
+        0.960430503f,     0.960856616f,     0.961280465f,     0.961702049f,
+        0.962121427f,     0.962538481f,     0.962953269f,     0.963365793f,
+        0.963776052f,     0.964184046f,     0.964589775f,     0.964993238f,
+        0.965394437f,     0.965793371f,     0.966189981f,     0.966584384f,
+        0.966976464f,     0.967366278f,     0.967753828f,     0.968139112f,
+        0.968522072f,     0.968902826f,     0.969281256f,     0.969657362f,
+        0.970031261f,     0.970402837f,     0.970772147f,     0.971139133f,
+        0.971503913f,     0.971866310f,     0.972226501f,     0.972584367f,
+        0.972939968f,     0.973293245f,     0.973644257f,     0.973992944f,
+        0.974339366f,     0.974683523f,     0.975025356f,     0.975364864f,
+        0.975702107f,     0.976037085f,     0.976369739f,     0.976700068f,
+        0.977028131f,     0.977353871f,     0.977677345f,     0.977998495f,
+        0.978317380f,     0.978633940f,     0.978948176f,     0.979260147f,
+        0.979569793f,     0.979877114f,     0.980182111f,     0.980484843f,
+        0.980785251f,     0.981083393f,     0.981379211f,     0.981672704f,
+        0.981963873f,     0.982252717f,     0.982539296f,     0.982823551f,
+        0.983105481f,     0.983385086f,     0.983662426f,     0.983937442f,
+        0.984210074f,     0.984480441f,     0.984748483f,     0.985014260f,
+        0.985277653f,     0.985538721f,     0.985797524f,     0.986053944f,
+        0.986308098f,     0.986559927f,     0.986809373f,     0.987056553f,
+        0.987301409f,     0.987543941f,     0.987784147f,     0.988022029f,
+        0.988257587f,     0.988490820f,     0.988721669f,     0.988950253f,
+        0.989176512f,     0.989400446f,     0.989621997f,     0.989841282f,
+        0.990058184f,     0.990272820f,     0.990485072f,     0.990695000f,
+        0.990902662f,     0.991107941f,     0.991310835f,     0.991511464f,
+        0.991709769f,     0.991905689f,     0.992099285f,     0.992290616f,
+        0.992479563f,     0.992666125f,     0.992850423f,     0.993032336f,
+        0.993211925f,     0.993389189f,     0.993564129f,     0.993736744f,
+        0.993906975f,     0.994074881f,     0.994240463f,     0.994403660f,
+        0.994564593f,     0.994723141f,     0.994879305f,     0.995033205f,
+        0.995184720f,     0.995333910f,     0.995480776f,     0.995625257f,
+        0.995767415f,     0.995907247f,     0.996044695f,     0.996179819f,
+        0.996312618f,     0.996443033f,     0.996571124f,     0.996696889f,
+        0.996820271f,     0.996941328f,     0.997060061f,     0.997176409f,
+        0.997290432f,     0.997402132f,     0.997511446f,     0.997618437f,
+        0.997723043f,     0.997825325f,     0.997925282f,     0.998022854f,
+        0.998118103f,     0.998211026f,     0.998301566f,     0.998389721f,
+        0.998475552f,     0.998559058f,     0.998640239f,     0.998719037f,
+        0.998795450f,     0.998869538f,     0.998941302f,     0.999010682f,
+        0.999077737f,     0.999142408f,     0.999204755f,     0.999264777f,
+        0.999322355f,     0.999377668f,     0.999430597f,     0.999481201f,
+        0.999529421f,     0.999575317f,     0.999618828f,     0.999660015f,
+        0.999698818f,     0.999735296f,     0.999769390f,     0.999801159f,
+        0.999830604f,     0.999857664f,     0.999882340f,     0.999904692f,
+        0.999924719f,     0.999942362f,     0.999957621f,     0.999970615f,
+        0.999981165f,     0.999989390f,     0.999995291f,     0.999998808f,
+         1.00000000f,
+#endif /* ! HEXTER_USE_FLOATING_POINT */
+};
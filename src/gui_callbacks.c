@@ -57,6 +57,12 @@ static int export_file_start;
 static int export_file_end;
 
 static gchar *file_selection_last_filename = NULL;
+
+/* patch changes are sent at most this often, so bursts of edits go out
+ * together */
+#define PATCH_SYNC_INTERVAL  100  /* milliseconds */
+
+static gint patch_sync_timeout_tag = 0;
 extern char  *project_directory;
 
 void
@@ -189,6 +195,53 @@ on_position_change(GtkWidget *widget, gpointer data)
     gtk_label_set_text (GTK_LABEL (label), name);
 }
 
+static gint
+patch_sync_timeout_callback(gpointer data)
+{
+    int block;
+
+    for (block = 0; block < 4; block++) {
+        if (patch_section_dirty[block]) {
+            gui_data_send_dirty_patch_sections();
+            return TRUE;  /* check again after another interval */
+        }
+    }
+    patch_sync_timeout_tag = 0;
+    return FALSE;
+}
+
+/*
+ * schedule_patch_sync
+ *
+ * send changed patches to the host now, unless some were sent within the
+ * last PATCH_SYNC_INTERVAL, in which case they go at the end of it
+ */
+void
+schedule_patch_sync(void)
+{
+    if (patch_sync_timeout_tag)
+        return;
+    gui_data_send_dirty_patch_sections();
+    patch_sync_timeout_tag = gtk_timeout_add(PATCH_SYNC_INTERVAL,
+                                             patch_sync_timeout_callback,
+                                             NULL);
+}
+
+/*
+ * flush_patch_sync
+ *
+ * send any changed patches still waiting, before the GUI exits
+ */
+void
+flush_patch_sync(void)
+{
+    if (patch_sync_timeout_tag) {
+        gtk_timeout_remove(patch_sync_timeout_tag);
+        patch_sync_timeout_tag = 0;
+    }
+    gui_data_send_dirty_patch_sections();
+}
+
 void
 on_import_file_position_ok( GtkWidget *widget, gpointer data )
 {
@@ -209,7 +262,7 @@ on_import_file_position_ok( GtkWidget *widget, gpointer data )
             patch_edit_update_editors();
         }
         display_notice("Load Patch File succeeded:", message);
-        gui_data_send_dirty_patch_sections();
+        schedule_patch_sync();
 
     } else {  /* didn't load anything successfully */
 
@@ -573,7 +626,7 @@ on_edit_save_position_ok(GtkWidget *widget, gpointer data)
     edit_buffer.program = position;
     dx7_patch_pack(edit_buffer.voice, patches, position);
     gui_data_mark_dirty_patch_sections(position, position);
-    gui_data_send_dirty_patch_sections();
+    schedule_patch_sync();
 
     /* We make the saved-to program the new current one, and clear the
      * edit_buffer overlay if active, because this makes the system's
@@ -813,6 +866,20 @@ update_from_program_select(unsigned long bank, unsigned long program)
     }
 }
 
+static void
+update_patches_done(int section)
+{
+    gui_data_clear_patch_section(section);
+
+    rebuild_patches_clist();
+
+    if (!edit_buffer_active && (edit_buffer.program / 32) == section) {
+        dx7_patch_unpack(patches, edit_buffer.program, edit_buffer.voice);
+        /* set all the patch edit widgets to match */
+        patch_edit_update_editors();
+    }
+}
+
 void
 update_patches(const char *key, const char *value)
 {
@@ -829,11 +896,41 @@ update_patches(const char *key, const char *value)
         return;
     }
 
-    patch_section_dirty[section] = 0;
+    update_patches_done(section);
+}
+
+void
+update_patches_blob(const char *key, const uint8_t *data, int size)
+{
+    int section = key[7] - '0';
+
+    GUIDB_MESSAGE(DB_OSC, ": update_patches_blob: received new '%s'\n", key);
+
+    if (section < 0 || section > 3)
+        return;
+
+    if (!gui_data_blob_value(data, size, 32 * sizeof(dx7_patch_t),
+                             (uint8_t *)&patches[section * 32])) {
+        GUIDB_MESSAGE(DB_OSC, " update_patches_blob: wrong size!\n");
+        return;
+    }
+
+    update_patches_done(section);
+}
+
+void
+update_patch_delta(const char *value)
+{
+    GUIDB_MESSAGE(DB_OSC, ": update_patch_delta called\n");
+
+    if (gui_data_apply_patch_delta(value) < 0) {
+        GUIDB_MESSAGE(DB_OSC, " update_patch_delta: corrupt data!\n");
+        return;
+    }
 
     rebuild_patches_clist();
 
-    if (!edit_buffer_active && (edit_buffer.program / 32) == section) {
+    if (!edit_buffer_active) {
         dx7_patch_unpack(patches, edit_buffer.program, edit_buffer.voice);
         /* set all the patch edit widgets to match */
         patch_edit_update_editors();
@@ -863,6 +960,20 @@ update_edit_buffer(const char *value)
     }
 }
 
+void
+update_edit_buffer_blob(const uint8_t *data, int size)
+{
+    GUIDB_MESSAGE(DB_OSC, ": update_edit_buffer_blob called\n");
+
+    if (!gui_data_blob_value(data, size, sizeof(edit_buffer),
+                             (uint8_t *)&edit_buffer)) {
+        GUIDB_MESSAGE(DB_OSC, " update_edit_buffer_blob: wrong size!\n");
+        return;
+    }
+    edit_buffer_active = TRUE;
+    patch_edit_update_editors();
+}
+
 void
 update_performance_spin(int parameter, uint8_t value, uint8_t max)
 {
@@ -937,6 +1048,19 @@ update_performance(const char *value)
     update_performance_widgets(perf_buffer);
 }
 
+void
+update_performance_blob(const uint8_t *data, int size)
+{
+    uint8_t perf_buffer[DX7_PERFORMANCE_SIZE];
+
+    if (!gui_data_blob_value(data, size, DX7_PERFORMANCE_SIZE, perf_buffer)) {
+        GUIDB_MESSAGE(DB_OSC, " update_performance_blob: wrong size!\n");
+        return;
+    }
+
+    update_performance_widgets(perf_buffer);
+}
+
 void
 update_monophonic(const char *value)
 {
@@ -39,6 +39,8 @@ gint on_delete_event_wrapper(GtkWidget *widget, GdkEvent *event, gpointer data);
 void on_import_file_ok(GtkWidget *widget, gpointer data);
 void on_import_file_cancel(GtkWidget *widget, gpointer data);
 void on_position_change(GtkWidget *widget, gpointer data);
+void schedule_patch_sync(void);
+void flush_patch_sync(void);
 void on_import_file_position_ok(GtkWidget *widget, gpointer data);
 void on_import_file_position_cancel(GtkWidget *widget, gpointer data);
 void on_export_file_type_press(GtkWidget *widget, gpointer data);
@@ -75,9 +77,13 @@ void on_notice_dismiss(GtkWidget *widget, gpointer data);
 void update_voice_widget(int port, float value);
 void update_from_program_select(unsigned long bank, unsigned long program);
 void update_patches(const char *key, const char *value);
+void update_patches_blob(const char *key, const uint8_t *data, int size);
+void update_patch_delta(const char *value);
 void update_edit_buffer(const char *value);
+void update_edit_buffer_blob(const uint8_t *data, int size);
 void update_performance_widgets(uint8_t *performance);
 void update_performance(const char *value);
+void update_performance_blob(const uint8_t *data, int size);
 void update_monophonic(const char *value);
 void update_polyphony(const char *value);
 void patches_clist_set_program(void);
@@ -33,310 +33,80 @@
 #include "gui_main.h"
 #include "dx7_voice_data.h"
 
+/* Patch, edit buffer and performance data go to the host as configure()
+ * values, normally encode_7in6()'d into OSC strings, since that is what
+ * the plugin's configure() takes.  A host that understands this UI can
+ * instead move the raw bytes as OSC blobs, saving the encoding and most
+ * of the traffic, and converting them for the plugin itself; it says so
+ * by sending us a blob first, and until then we stick to strings. */
+
+/* patches changed since they were last sent, and patches sent by delta
+ * since their section was last sent in full */
+static uint8_t       patch_dirty[128];
+static uint8_t       patch_in_delta[128];
+static unsigned long patch_delta_version = 0;
+
+/* the last patch delta the host has, whichever of us sent it, whose
+ * patches are newer than any 'patchesN' the host sends us after it */
+static int           host_delta_count = 0;
+static uint8_t       host_delta_numbers[PATCH_DELTA_MAX];
+static dx7_patch_t   host_delta[PATCH_DELTA_MAX];
+
+/* set once the host has sent us a blob, after which we send it blobs too */
+static int           blob_configure = 0;
+
 /*
- * dx7_bulk_dump_checksum
+ * gui_data_enable_blob_configure
+ *
+ * note that the host has sent a blob configure value, and so accepts them
  */
-int
-dx7_bulk_dump_checksum(uint8_t *data, int length)
+void
+gui_data_enable_blob_configure(void)
 {
-    int sum = 0;
-    int i;
-
-    for (i = 0; i < length; sum -= data[i++]);
-    return sum & 0x7F;
+    if (!blob_configure)
+        GUIDB_MESSAGE(DB_OSC, " gui_data_enable_blob_configure: host sends blobs, switching to blob transport\n");
+    blob_configure = 1;
 }
 
 /*
- * dx7_patchbank_load
+ * gui_data_send_configure
+ *
+ * send 'length' (at most 4096) bytes of 7-bit data to the host as the
+ * value for 'key'
  */
-int
-dx7_patchbank_load(const char *filename, dx7_patch_t *firstpatch,
-                   int maxpatches, char **errmsg)
+void
+gui_data_send_configure(const char *key, uint8_t *data, int length)
 {
-    FILE *fp;
-    long filelength;
-    unsigned char *raw_patch_data = NULL;
-    size_t filename_length;
-    int count;
-    int patchstart;
-    int midshift;
-    int datastart;
-    int i;
-    int op;
-
-    /* this needs to 1) open and parse the file, 2a) if it's good, copy up
-     * to maxpatches patches beginning at firstpath, and not touch errmsg,
-     * 2b) if it's not good, set errmsg to a malloc'd error message that
-     * the caller must free. */
-
-    if ((fp = fopen(filename, "rb")) == NULL) {
-        if (errmsg) *errmsg = dssp_error_message("could not open file '%s' for reading: %s", filename, strerror(errno));
-        return 0;
-    }
-
-    if (fseek(fp, 0, SEEK_END) ||
-        (filelength = ftell(fp)) == -1 ||
-        fseek(fp, 0, SEEK_SET)) {
-        if (errmsg) *errmsg = dssp_error_message("couldn't get length of patch file: %s", strerror(errno));
-        fclose(fp);
-        return 0;
-    }
-    if (filelength == 0) {
-        if (errmsg) *errmsg = strdup("patch file has zero length");
-        fclose(fp);
-        return 0;
-    } else if (filelength > 2097152) {
-        if (errmsg) *errmsg = strdup("patch file is too large");
-        fclose(fp);
-        return 0;
-    } else if (filelength < 128) {
-        if (errmsg) *errmsg = strdup ("patch file is too small");
-        fclose (fp);
-        return 0;
-    }
-
-    if (!(raw_patch_data = (unsigned char *)malloc(filelength))) {
-        if (errmsg) *errmsg = strdup("couldn't allocate memory for raw patch file");
-        fclose(fp);
-        return 0;
+    char buffer[ENCODE_7IN6_SIZE(32 * DX7_VOICE_SIZE_PACKED)];
+    lo_blob blob;
+
+    if (blob_configure) {
+        blob = lo_blob_new(length, data);
+        lo_send(osc_host_address, osc_configure_path, "sb", key, blob);
+        lo_blob_free(blob);
+    } else {
+        encode_7in6(data, length, buffer);
+        lo_send(osc_host_address, osc_configure_path, "ss", key, buffer);
     }
-
-    if (fread(raw_patch_data, 1, filelength, fp) != (size_t)filelength) {
-        if (errmsg) *errmsg = dssp_error_message("short read on patch file: %s", strerror(errno));
-        free(raw_patch_data);
-        fclose(fp);
-        return 0;
-    }
-    fclose(fp);
-    filename_length = strlen (filename);
-
-    /* check if the file is a standard MIDI file */
-    if (raw_patch_data[0] == 0x4d &&    /* "M" */
-        raw_patch_data[1] == 0x54 &&    /* "T" */
-        raw_patch_data[2] == 0x68 &&    /* "h" */
-        raw_patch_data[3] == 0x64)      /* "d" */
-        midshift = 2;
-    else
-        midshift = 0;
-
-    /* scan SysEx or MIDI file for SysEx header(s) */
-    count = 0;
-    datastart = 0;
-    for (patchstart = 0; patchstart + midshift + 5 < filelength; patchstart++) {
-
-        if (raw_patch_data[patchstart] == 0xf0 &&
-            raw_patch_data[patchstart + 1 + midshift] == 0x43 &&
-            raw_patch_data[patchstart + 2 + midshift] <= 0x0f &&
-            raw_patch_data[patchstart + 3 + midshift] == 0x09 &&
-            raw_patch_data[patchstart + 5 + midshift] == 0x00 &&
-            patchstart + 4103 + midshift < filelength &&
-            raw_patch_data[patchstart + 4103 + midshift] == 0xf7) {  /* DX7 32 voice dump */
-
-            memmove(raw_patch_data + count * DX7_VOICE_SIZE_PACKED,
-                    raw_patch_data + patchstart + 6 + midshift, 4096);
-            count += 32;
-            patchstart += (DX7_DUMP_SIZE_VOICE_BULK - 1);
-
-        } else if (raw_patch_data[patchstart] == 0xf0 &&
-                   raw_patch_data[patchstart + midshift + 1] == 0x43 &&
-                   raw_patch_data[patchstart + midshift + 2] <= 0x0f &&
-                   raw_patch_data[patchstart + midshift + 4] == 0x01 &&
-                   raw_patch_data[patchstart + midshift + 5] == 0x1b &&
-                   patchstart + midshift + 162 < filelength &&
-                   raw_patch_data[patchstart + midshift + 162] == 0xf7) {  /* DX7 single voice (edit buffer) dump */
-
-            unsigned char buf[DX7_VOICE_SIZE_PACKED]; /* to avoid overlap in dx7_patch_pack() */
-
-            dx7_patch_pack(raw_patch_data + patchstart + midshift + 6,
-                           (dx7_patch_t *)buf, 0);
-            memcpy(raw_patch_data + count * DX7_VOICE_SIZE_PACKED,
-                   buf, DX7_VOICE_SIZE_PACKED);
-
-            count += 1;
-            patchstart += (DX7_DUMP_SIZE_VOICE_SINGLE - 1);
-        }
-    }
-
-    /* assume raw DX7/TX7 data if no SysEx header was found. */
-    /* assume the user knows what he is doing ;-) */
-
-    if (count == 0)
-        count = filelength / DX7_VOICE_SIZE_PACKED;
-
-    /* Dr.T and Steinberg TX7 file needs special treatment */
-    if ((!strcmp(filename + filename_length - 4, ".TX7") ||
-         !strcmp(filename + filename_length -4, ".SND") ||
-         !strcmp(filename + filename_length -4, ".tx7") ||
-         !strcmp(filename + filename_length - 4, ".snd")) && filelength == 8192) {
-
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Transform XSyn file also needs special treatment */
-    if ((!strcmp(filename + filename_length - 4, ".BNK") ||
-         !strcmp(filename + filename_length - 4, ".bnk")) && filelength == 8192) {
-
-        for (i=0; i<32; i++)
-        {
-            memmove(raw_patch_data + 128*i, raw_patch_data + 256*i, 128);
-        }
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Steinberg Synthworks DX7 SND */
-    if ((!strcmp (filename + filename_length - 4, ".SND") ||
-         !strcmp (filename + filename_length - 4, ".snd")) && filelength == 5216) {
-
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Voyetra SIDEMAN DX/TX
-     * Voyetra Patchmaster DX7/TX7 */
-    if ((filelength == 9816 || filelength == 5663) &&
-        raw_patch_data[0] == 0xdf &&
-        raw_patch_data[1] == 0x05 &&
-        raw_patch_data[2] == 0x01 && raw_patch_data[3] == 0x00) {
-
-        count = 32;
-        datastart = 0x60f;
-    }
-
-    /* Yamaha DX200 editor .DX2 */
-    if ((!strcmp (filename + filename_length - 4, ".DX2") ||
-         !strcmp (filename + filename_length - 4, ".dx2"))
-        && filelength == 326454)
-      {
-          memmove (raw_patch_data + 16384, raw_patch_data + 34, 128 * 381);
-          for (count = 0; count < 128; count++)
-            {
-                for (op = 0; op < 6; op++)
-                  {
-                      for (i = 0; i < 8; i++)
-                        {
-                            raw_patch_data[17 * (5 - op) + i + 128 * count] =
-                                raw_patch_data[16384 + 35 * op + 76 + i + 381 * count];
-                        }
-                      raw_patch_data[17 * (5 - op) + 8 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 84 + 381 * count] - 21;
-                      raw_patch_data[17 * (5 - op) + 9 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 87 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 10 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 88 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 11 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 85 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 86 + 381 * count] * 4;
-                      raw_patch_data[17 * (5 - op) + 12 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 89 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 75 + 381 * count] * 8;
-                      if (raw_patch_data[16384 + 35 * op + 71 + 381 * count] > 3)
-                          raw_patch_data[16384 + 35 * op + 71 + 381 * count] = 3;
-                      raw_patch_data[17 * (5 - op) + 13 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 71 + 381 * count] / 2 +
-                          raw_patch_data[16384 + 35 * op + 91 + 381 * count] * 4;
-                      raw_patch_data[17 * (5 - op) + 14 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 90 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 15 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 72 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 73 + 381 * count] * 2;
-                      raw_patch_data[17 * (5 - op) + 16 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 74 + 381 * count];
-                  }
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[102 + i + 128 * count] =
-                          raw_patch_data[16384 + 26 + i + 381 * count];
-                  }
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[106 + i + 128 * count] =
-                          raw_patch_data[16384 + 32 + i + 381 * count];
-                  }
-                raw_patch_data[110 + 128 * count] =
-                    raw_patch_data[16384 + 17 + 381 * count];
-                raw_patch_data[111 + 128 * count] =
-                    raw_patch_data[16384 + 18 + 381 * count] +
-                    raw_patch_data[16384 + 38 + 381 * count] * 8;
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[112 + i + 128 * count] =
-                          raw_patch_data[16384 + 20 + i + 381 * count];
-                  }
-                raw_patch_data[116 + 128 * count] =
-                    raw_patch_data[16384 + 24 + 381 * count] +
-                    raw_patch_data[16384 + 19 + 381 * count] * 2 +
-                    raw_patch_data[16384 + 25 + 381 * count] * 16;
-                raw_patch_data[117 + 128 * count] =
-                    raw_patch_data[16384 + 37 + 381 * count] - 36;
-                for (i = 0; i < 10; i++)
-                  {
-                      raw_patch_data[118 + i + 128 * count] =
-                          raw_patch_data[16384 + i + 381 * count];
-                  }
-            }
-
-          count = 128;
-          filelength = 16384;
-          datastart = 0;
-
-      }
-
-    /* finally, copy patchdata to the right location */
-    if (count > maxpatches)
-        count = maxpatches;
-
-    memcpy(firstpatch, raw_patch_data + datastart, 128 * count);
-    free (raw_patch_data);
-    return count;
 }
 
 /*
- * encode_7in6
+ * gui_data_blob_value
  *
- * encode a block of 7-bit data, in base64-ish style
+ * copy a blob configure value from the host of 'size' bytes into 'data',
+ * returning 0 if it is not the 'expected_length'
  */
-char *
-encode_7in6(uint8_t *data, int length)
+int
+gui_data_blob_value(const uint8_t *blob, int size, int expected_length,
+                    uint8_t *data)
 {
-    char *buffer;
-    int in, reg, above, below, shift, out;
-    int outchars = (length * 7 + 5) / 6;
-    unsigned int sum = 0;
-
-    if (!(buffer = (char *)malloc(25 + outchars)))
-        return NULL;
-
-    out = snprintf(buffer, 12, "%d ", length);
-
-    in = reg = above = below = 0;
-    while (outchars) {
-        if (above == 6) {
-            buffer[out] = base64[reg >> 7];
-            reg &= 0x7f;
-            above = 0;
-            out++;
-            outchars--;
-        }
-        if (below == 0) {
-            if (in < length) {
-                reg |= data[in] & 0x7f;
-                sum += data[in];
-            }
-            below = 7;
-            in++;
-        }
-        shift = 6 - above;
-        if (below < shift) shift = below;
-        reg <<= shift;
-        above += shift;
-        below -= shift;
-    }
-
-    snprintf(buffer + out, 12, " %d", sum);
+    int i;
 
-    return buffer;
+    if (size != expected_length)
+        return 0;
+    for (i = 0; i < size; i++)
+        data[i] = blob[i] & 0x7f;  /* as decode_7in6() would leave them */
+    return 1;
 }
 
 void
@@ -349,6 +119,8 @@ gui_data_patches_init(void)
     patch_section_dirty[1] = 0;
     patch_section_dirty[2] = 0;
     patch_section_dirty[3] = 0;
+    memset(patch_dirty, 0, sizeof(patch_dirty));
+    memset(patch_in_delta, 0, sizeof(patch_in_delta));
 }
 
 void
@@ -360,33 +132,127 @@ gui_data_patches_free(void)
 void
 gui_data_mark_dirty_patch_sections(int start_patch, int end_patch)
 {
-    int i, block;
-    for (i = start_patch; i <= end_patch; ) {
-        block = i >> 5;
-        patch_section_dirty[block] = 1;
-        i = (block + 1) << 5;
+    int i;
+    for (i = start_patch; i <= end_patch; i++) {
+        patch_section_dirty[i >> 5] = 1;
+        patch_dirty[i] = 1;
     }
 }
 
+/*
+ * gui_data_send_dirty_patch_sections
+ *
+ * Send the changed patches to the host: a section with more than
+ * PATCH_DELTA_SECTION_MAX patches changed since it was last sent in full
+ * is sent in full again with 'patchesN', and the other changed patches are
+ * added to the cumulative 'patch_delta'.  The delta is resent whenever
+ * anything changes, so that the host's last copy of it never holds
+ * patches older than its copies of the sections.
+ */
 void
 gui_data_send_dirty_patch_sections(void)
 {
-    int block;
-    char *p;
+    int block, i, count, sent = 0;
+    uint8_t numbers[PATCH_DELTA_MAX];
+    char buffer[PATCH_DELTA_SIZE];
     char key[9];
     for (block = 0; block < 4; block++) {
-        if (patch_section_dirty[block]) {
-            if ((p = encode_7in6((uint8_t *)&patches[block << 5],
-                                 32 * DX7_VOICE_SIZE_PACKED))) {
-                snprintf(key, 9, "patches%d", block);
-                lo_send(osc_host_address, osc_configure_path, "ss", key, p);
-                free(p);
-                patch_section_dirty[block] = 0;
+        if (!patch_section_dirty[block])
+            continue;
+        count = 0;
+        for (i = block << 5; i < (block + 1) << 5; i++)
+            if (patch_dirty[i] || patch_in_delta[i])
+                count++;
+        if (count > PATCH_DELTA_SECTION_MAX) {
+            snprintf(key, 9, "patches%d", block);
+            gui_data_send_configure(key, (uint8_t *)&patches[block << 5],
+                                    32 * DX7_VOICE_SIZE_PACKED);
+            for (i = block << 5; i < (block + 1) << 5; i++)
+                patch_dirty[i] = patch_in_delta[i] = 0;
+        } else {
+            for (i = block << 5; i < (block + 1) << 5; i++) {
+                if (patch_dirty[i]) {
+                    patch_in_delta[i] = 1;
+                    patch_dirty[i] = 0;
+                }
             }
         }
+        patch_section_dirty[block] = 0;
+        sent = 1;
+    }
+    if (!sent)
+        return;
+
+    count = 0;
+    for (i = 0; i < 128; i++)
+        if (patch_in_delta[i])
+            numbers[count++] = i;
+    encode_patch_delta(++patch_delta_version, count, numbers, patches, buffer);
+    lo_send(osc_host_address, osc_configure_path, "ss", "patch_delta", buffer);
+
+    host_delta_count = count;
+    for (i = 0; i < count; i++) {
+        host_delta_numbers[i] = numbers[i];
+        memcpy(&host_delta[i], &patches[numbers[i]], sizeof(dx7_patch_t));
     }
 }
 
+/*
+ * gui_data_clear_patch_section
+ *
+ * forget any unsent changes to a section, which the host has just sent in
+ * full, but put back the patches of the host's last delta that fall in
+ * it: a host restoring a session may send its stale 'patchesN' after the
+ * delta
+ */
+void
+gui_data_clear_patch_section(int section)
+{
+    int i;
+
+    patch_section_dirty[section] = 0;
+    for (i = section << 5; i < (section + 1) << 5; i++)
+        patch_dirty[i] = patch_in_delta[i] = 0;
+    for (i = 0; i < host_delta_count; i++) {
+        if (host_delta_numbers[i] >> 5 == section) {
+            memcpy(&patches[host_delta_numbers[i]], &host_delta[i], sizeof(dx7_patch_t));
+            patch_in_delta[host_delta_numbers[i]] = 1;
+        }
+    }
+}
+
+/*
+ * gui_data_apply_patch_delta
+ *
+ * apply a 'patch_delta' from the host, returning the number of patches it
+ * held, or -1 if it was corrupt
+ */
+int
+gui_data_apply_patch_delta(const char *value)
+{
+    unsigned long version;
+    uint8_t numbers[PATCH_DELTA_MAX];
+    dx7_patch_t delta[PATCH_DELTA_MAX];
+    int count, i;
+
+    count = decode_patch_delta(value, &version, numbers, delta);
+    if (count < 0)
+        return -1;
+
+    /* carry on numbering from the host's copy, and keep these patches in
+     * our delta, since the host's copies of their sections lack them */
+    if (patch_delta_version < version)
+        patch_delta_version = version;
+    for (i = 0; i < count; i++) {
+        memcpy(&patches[numbers[i]], &delta[i], sizeof(dx7_patch_t));
+        patch_in_delta[numbers[i]] = 1;
+    }
+    host_delta_count = count;
+    memcpy(host_delta_numbers, numbers, count);
+    memcpy(host_delta, delta, count * sizeof(dx7_patch_t));
+    return count;
+}
+
 int
 gui_data_save(char *filename, int type, int start, int end, char **message)
 {
@@ -476,12 +342,8 @@ gui_data_load(const char *filename, int position, char **message)
 void
 gui_data_send_edit_buffer(void)
 {
-    char *p;
-
-    if ((p = encode_7in6((uint8_t *)&edit_buffer, sizeof(edit_buffer)))) {
-        lo_send(osc_host_address, osc_configure_path, "ss", "edit_buffer", p);
-        free(p);
-    }
+    gui_data_send_configure("edit_buffer", (uint8_t *)&edit_buffer,
+                            sizeof(edit_buffer));
 }
 
 void
@@ -493,10 +355,6 @@ gui_data_send_edit_buffer_off(void)
 void
 gui_data_send_performance_buffer(uint8_t *performance_buffer)
 {
-    char *p;
-
-    if ((p = encode_7in6(performance_buffer, DX7_PERFORMANCE_SIZE))) {
-        lo_send(osc_host_address, osc_configure_path, "ss", "performance", p);
-        free(p);
-    }
+    gui_data_send_configure("performance", performance_buffer,
+                            DX7_PERFORMANCE_SIZE);
 }
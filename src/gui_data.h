@@ -23,14 +23,16 @@
 
 #include "hexter_types.h"
 
-int   dx7_bulk_dump_checksum(uint8_t *data, int length);
-int   dx7_patchbank_load(const char *filename, dx7_patch_t *firstpatch,
-                         int maxpatches, char **errmsg);
-char *encode_7in6(uint8_t *data, int length);
+void  gui_data_enable_blob_configure(void);
+void  gui_data_send_configure(const char *key, uint8_t *data, int length);
+int   gui_data_blob_value(const uint8_t *blob, int size, int expected_length,
+                          uint8_t *data);
 void  gui_data_patches_init(void);
 void  gui_data_patches_free(void);
 void  gui_data_mark_dirty_patch_sections(int start_patch, int end_patch);
 void  gui_data_send_dirty_patch_sections(void);
+void  gui_data_clear_patch_section(int section);
+int   gui_data_apply_patch_delta(const char *value);
 int   gui_data_save(char *filename, int type, int start, int end,
                     char **message);
 int   gui_data_load(const char *filename, int position, char **message);
@@ -30,8 +30,10 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include <pthread.h>
 #include <errno.h>
+#include <time.h>
 
 #include <ladspa.h>
 #include <alsa/seq_event.h>
@@ -42,16 +44,16 @@
 #include "hexter_synth.h"
 #include "dx7_voice.h"
 #include "dx7_voice_data.h"
+#include "hexter_record.h"
+#include "hexter_library.h"
+#include "hexter_loader.h"
+#include "hexter_bank.h"
 
 static LADSPA_Descriptor *hexter_LADSPA_descriptor = NULL;
 static DSSI_Descriptor   *hexter_DSSI_descriptor = NULL;
 
 static LADSPA_Data volume;
 
-static int
-dx7_patchbank_load_init(const char *filename, dx7_patch_t *firstpatch,
-                  int maxpatches, char **errmsg);
-
 static void
 hexter_cleanup(LADSPA_Handle instance);
 
@@ -59,39 +61,6 @@ static void
 hexter_run_synth(LADSPA_Handle instance, unsigned long sample_count,
                  snd_seq_event_t *events, unsigned long event_count);
 
-/* ---- mutual exclusion ---- */
-
-static inline int
-dssp_voicelist_mutex_trylock(hexter_instance_t *instance)
-{
-    int rc;
-
-    /* Attempt the mutex lock */
-    rc = pthread_mutex_trylock(&instance->voicelist_mutex);
-    if (rc) {
-        instance->voicelist_mutex_grab_failed = 1;
-        return rc;
-    }
-    /* Clean up if a previous mutex grab failed */
-    if (instance->voicelist_mutex_grab_failed) {
-        hexter_instance_all_voices_off(instance);
-        instance->voicelist_mutex_grab_failed = 0;
-    }
-    return 0;
-}
-
-inline int
-dssp_voicelist_mutex_lock(hexter_instance_t *instance)
-{
-    return pthread_mutex_lock(&instance->voicelist_mutex);
-}
-
-inline int
-dssp_voicelist_mutex_unlock(hexter_instance_t *instance)
-{
-    return pthread_mutex_unlock(&instance->voicelist_mutex);
-}
-
 /* ---- LADSPA interface ---- */
 
 /*
@@ -104,69 +73,72 @@ hexter_instantiate(const LADSPA_Descriptor *descriptor,
                    unsigned long sample_rate)
 {
     hexter_instance_t *instance;
-    int i;
+    const char *default_bank_path, *record_path, *library_path;
+    int sync;
 
-    instance = (hexter_instance_t *)calloc(1, sizeof(hexter_instance_t));
+    /* the engine proper, playing the built-in patches */
+    instance = hexter_instance_new(sample_rate);
     if (!instance) {
+        DEBUG_MESSAGE(-1, " hexter_instantiate: out of memory!\n");
         return NULL;
     }
 
-    /* do any per-instance one-time initialization here */
-    for (i = 0; i < HEXTER_MAX_POLYPHONY; i++) {
-        instance->voice[i] = dx7_voice_new();
-        if (!instance->voice[i]) {
-            DEBUG_MESSAGE(-1, " hexter_instantiate: out of memory!\n");
-            hexter_cleanup(instance);
-            return NULL;
+    /* a default bank file, if given, is loaded over the built-in patches
+     * in the background, unless a recorded session or an offline tool
+     * needs it in place before instantiate() returns */
+    default_bank_path = getenv("HEXTER_DEFAULT_BANK_PATH");
+    if (default_bank_path && !*default_bank_path)
+        default_bank_path = NULL;
+    record_path = getenv("HEXTER_RECORD_PATH");
+    sync = (record_path || getenv("HEXTER_DEFAULT_BANK_SYNC"));
+    if (default_bank_path && sync) {
+        char *errmsg = NULL;
+        dx7_patch_t *patches = (dx7_patch_t *)malloc(128 * DX7_VOICE_SIZE_PACKED);
+
+        if (patches) {
+            hexter_data_patches_init(patches);
+            if (!dx7_patchbank_load(default_bank_path, patches, 128, &errmsg)) {
+                DEBUG_MESSAGE(-1, " hexter_instantiate: could not load '%s': %s\n",
+                              default_bank_path, errmsg);
+                free(errmsg);
+            } else if (!hexter_instance_set_patches(instance, patches)) {
+                DEBUG_MESSAGE(-1, " hexter_instantiate: out of memory!\n");
+            }
+            free(patches);
         }
     }
-    if (!(instance->patches = (dx7_patch_t *)malloc(128 * DX7_VOICE_SIZE_PACKED))) {
-        DEBUG_MESSAGE(-1, " hexter_instantiate: out of memory!\n");
-        hexter_cleanup(instance);
-        return NULL;
+
+    /* if requested, record this instance's session for offline replay */
+    if (record_path) {
+        instance->recorder = hexter_recorder_new(record_path, sample_rate);
+        if (instance->recorder)
+            hexter_record_patches(instance->recorder, instance->patches);
     }
 
-    instance->sample_rate = (float)sample_rate;
-    instance->nugget_remains = 0;
-    dx7_eg_init_constants(instance);  /* depends on sample rate */
+    /* if given, map a patch library for banks 1 and up */
+    library_path = getenv("HEXTER_LIBRARY_PATH");
+    if (library_path && *library_path) {
+        char *errmsg = NULL;
 
-    instance->note_id = 0;
-    instance->polyphony = HEXTER_DEFAULT_POLYPHONY;
-    instance->monophonic = DSSP_MONO_MODE_OFF;
-    instance->max_voices = instance->polyphony;
-    instance->current_voices = 0;
-    instance->last_key = 0;
-    pthread_mutex_init(&instance->voicelist_mutex, NULL);
-    instance->voicelist_mutex_grab_failed = 0;
-    pthread_mutex_init(&instance->patches_mutex, NULL);
-    instance->pending_program_change = -1;
-    instance->current_program = 0;
-    instance->overlay_program = -1;
-    hexter_data_performance_init(instance->performance_buffer);
-
-    // Load default patches
-    const char* default_bank_path = getenv("HEXTER_DEFAULT_BANK_PATH");
-    if (default_bank_path) {
-		dx7_patchbank_load_init(default_bank_path, instance->patches,
-								128, NULL);
-		printf("Loaded bank: %s\n", default_bank_path);
-	} else {
-		hexter_data_patches_init(instance->patches);
-		printf("Set HEXTER_DEFAULT_BANK_PATH to change the bank\n");
+        instance->library = hexter_library_open(library_path, &errmsg);
+        if (!instance->library) {
+            DEBUG_MESSAGE(-1, " hexter_instantiate: %s\n", errmsg);
+            free(errmsg);
+        }
     }
 
-    hexter_instance_select_program(instance, 0, 0);
-    hexter_instance_init_controls(instance);
-
 	// Read external volume
 	const char* volume_var = getenv("HEXTER_VOLUME");
 	if (volume_var) {
 		volume = (LADSPA_Data) atof(volume_var);
-		printf("Volume: %f\n", volume);
-	} else {
-		printf("Set HEXTER_VOLUME to change the gain\n");
+		DEBUG_MESSAGE(DB_DSSI, " hexter_instantiate: volume %f\n", volume);
 	}
 
+    /* now that the instance is complete, start the background loader */
+    if (default_bank_path)
+        instance->loader = hexter_loader_start(instance, default_bank_path, !sync,
+                                               getenv("HEXTER_DEFAULT_BANK_WATCH") != NULL);
+
     return (LADSPA_Handle)instance;
 }
 
@@ -199,9 +171,13 @@ hexter_activate(LADSPA_Handle handle)
 {
     hexter_instance_t *instance = (hexter_instance_t *)handle;
 
+    if (instance->recorder)
+        hexter_record_control(instance->recorder, HEXTER_RECORD_ACTIVATE);
+
     hexter_instance_all_voices_off(instance);  /* stop all sounds immediately */
     instance->current_voices = 0;
     dx7_lfo_reset(instance);
+    hexter_instance_reset_parts(instance);
 }
 
 /*
@@ -229,6 +205,9 @@ hexter_deactivate(LADSPA_Handle handle)
 {
     hexter_instance_t *instance = (hexter_instance_t *)handle;
 
+    if (instance->recorder)
+        hexter_record_control(instance->recorder, HEXTER_RECORD_DEACTIVATE);
+
     hexter_instance_all_voices_off(instance);  /* stop all sounds immediately */
 }
 
@@ -241,19 +220,14 @@ static void
 hexter_cleanup(LADSPA_Handle handle)
 {
     hexter_instance_t *instance = (hexter_instance_t *)handle;
-    int i;
 
     if (instance) {
         hexter_deactivate(instance);
 
-        if (instance->patches) free(instance->patches);
-        for (i = 0; i < HEXTER_MAX_POLYPHONY; i++) {
-            if (instance->voice[i]) {
-                free(instance->voice[i]);
-                instance->voice[i] = NULL;
-            }
-        }
-        free(instance);
+        hexter_loader_stop(instance->loader);  /* before the patches go away */
+
+        if (instance->recorder) hexter_recorder_free(instance->recorder);
+        hexter_instance_free(instance);
     }
 }
 
@@ -271,33 +245,18 @@ hexter_configure(LADSPA_Handle handle, const char *key, const char *value)
 
     DEBUG_MESSAGE(DB_DSSI, " hexter_configure called with '%s' and '%s'\n", key, value);
 
-    if (strlen(key) == 8 && !strncmp(key, "patches", 7)) {
-
-        return hexter_instance_handle_patches(instance, key, value);
-
-    } else if (!strcmp(key, "edit_buffer")) {
-
-        return hexter_instance_handle_edit_buffer(instance, value);
-
-    } else if (!strcmp(key, "performance")) {  /* global performance parameters */
-
-        return hexter_instance_handle_performance(instance, value);
-
-    } else if (!strcmp(key, "monophonic")) {
-
-        return hexter_instance_handle_monophonic(instance, value);
-
-    } else if (!strcmp(key, "polyphony")) {
-
-        return hexter_instance_handle_polyphony(instance, value);
+    if (instance->recorder)
+        hexter_record_configure(instance->recorder, key, value);
 
 #ifdef DSSI_GLOBAL_CONFIGURE_PREFIX
-    } else if (!strcmp(key, DSSI_GLOBAL_CONFIGURE_PREFIX "polyphony")) {
+    if (!strcmp(key, DSSI_GLOBAL_CONFIGURE_PREFIX "polyphony")) {
 #else
-    } else if (!strcmp(key, "global_polyphony")) {
+    if (!strcmp(key, "global_polyphony")) {
 #endif
 
-        DEBUG_MESSAGE(DB_DSSI, " -- global polyphony limiting is no longer supported --\n");
+        /* the host sends the global key to every instance, each of which
+         * joins the process-wide voice budget */
+        return hexter_instance_handle_global_polyphony(instance, value);
 
 #ifdef DSSI_PROJECT_DIRECTORY_KEY
     } else if (!strcmp(key, DSSI_PROJECT_DIRECTORY_KEY)) {
@@ -306,7 +265,25 @@ hexter_configure(LADSPA_Handle handle, const char *key, const char *value)
 
 #endif
     }
-    return strdup("error: unrecognized configure key");
+    return hexter_instance_configure(instance, key, value);
+}
+
+/*
+ * hexter_set_program_descriptor
+ */
+static int
+hexter_set_program_descriptor(hexter_instance_t *instance,
+                              DSSI_Program_Descriptor *pd,
+                              unsigned long bank, unsigned long program)
+{
+    static char name[11];
+
+    if (!hexter_instance_patch_name(instance, bank, program, name))
+        return 0;
+    pd->Bank = bank;
+    pd->Program = program;
+    pd->Name = name;
+    return 1;
 }
 
 /*
@@ -319,14 +296,19 @@ hexter_get_program(LADSPA_Handle handle, unsigned long index)
 {
     hexter_instance_t *instance = (hexter_instance_t *)handle;
     static DSSI_Program_Descriptor pd;
+    int found;
 
     DEBUG_MESSAGE(DB_DSSI, " hexter_get_program called with %lu\n", index);
 
-    if (index < 128) {
-        hexter_instance_set_program_descriptor(instance, &pd, 0, index);
-        return &pd;
-    }
-    return NULL;
+    /* the bank may be swapped, and the old one freed, by a reload or a
+     * configure() at any time; programs past the first 128 are those of
+     * the patch library, if any */
+    pthread_mutex_lock(&instance->patches_mutex);
+    found = hexter_set_program_descriptor(instance, &pd, index / 128,
+                                          index % 128);
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    return found ? &pd : NULL;
 }
 
 /*
@@ -343,35 +325,19 @@ hexter_select_program(LADSPA_Handle handle, unsigned long bank,
     DEBUG_MESSAGE(DB_DSSI, " hexter_select_program called with %lu and %lu\n", bank, program);
 
     /* ignore invalid program requests */
-    if (bank || program >= 128)
+    if (program >= 128)
         return;
 
-    /* Attempt the patch mutex, return if lock fails. */
-    if (pthread_mutex_trylock(&instance->patches_mutex)) {
-        instance->pending_program_change = program;
+    /* if the patches are busy, the change is left pending */
+    if (!hexter_instance_try_select_program(instance, bank, program)) {
+        if (instance->recorder)
+            hexter_record_select_program(instance->recorder, bank, program,
+                                         HEXTER_RECORD_FLAG_PATCHES_BUSY);
         return;
     }
 
-    hexter_instance_select_program((hexter_instance_t *)instance, bank, program);
-
-    pthread_mutex_unlock(&instance->patches_mutex);
-}
-
-/*
- * hexter_handle_pending_program_change
- */
-static inline void
-hexter_handle_pending_program_change(hexter_instance_t *instance)
-{
-    /* Attempt the patch mutex, return if lock fails. */
-    if (pthread_mutex_trylock(&instance->patches_mutex))
-        return;
-
-    hexter_instance_select_program((hexter_instance_t *)instance, 0,
-                                   instance->pending_program_change);
-    instance->pending_program_change = -1;
-
-    pthread_mutex_unlock(&instance->patches_mutex);
+    if (instance->recorder)
+        hexter_record_select_program(instance->recorder, bank, program, 0);
 }
 
 /*
@@ -401,6 +367,10 @@ hexter_handle_event(hexter_instance_t *instance, snd_seq_event_t *event)
 {
     DEBUG_MESSAGE(DB_DSSI, " hexter_handle_event called with event type %d\n", event->type);
 
+    /* while multitimbral, each channel goes to its own part (the note and
+     * control event structures both begin with the channel) */
+    instance = HEXTER_INSTANCE_PART(instance, event->data.note.channel);
+
     switch (event->type) {
       case SND_SEQ_EVENT_NOTEOFF:
         hexter_instance_note_off(instance, event->data.note.note, event->data.note.velocity);
@@ -423,7 +393,15 @@ hexter_handle_event(hexter_instance_t *instance, snd_seq_event_t *event)
       case SND_SEQ_EVENT_PITCHBEND:
         hexter_instance_pitch_bend(instance, event->data.control.value);
         break;
-      /* SND_SEQ_EVENT_PGMCHANGE - shouldn't happen */
+      case SND_SEQ_EVENT_PGMCHANGE:
+        /* the host makes program changes on the instance's own channel
+         * with select_program(), but those for other parts come as events */
+        if (instance != instance->pool)
+            hexter_instance_try_select_program(instance,
+                                               instance->cc[MIDI_CTL_MSB_BANK] * 128 +
+                                                   instance->cc[MIDI_CTL_LSB_BANK],
+                                               event->data.control.value);
+        break;
       /* SND_SEQ_EVENT_SYSEX - shouldn't happen */
       /* SND_SEQ_EVENT_CONTROL14? */
       /* SND_SEQ_EVENT_NONREGPARAM? */
@@ -446,6 +424,7 @@ hexter_run_synth(LADSPA_Handle handle, unsigned long sample_count,
     unsigned long samples_done = 0;
     unsigned long event_index = 0;
     unsigned long burst_size;
+    struct timespec start, end;
 
     /* silence the buffer */
     memset(instance->output, 0, sizeof(LADSPA_Data) * sample_count);
@@ -454,16 +433,23 @@ hexter_run_synth(LADSPA_Handle handle, unsigned long sample_count,
 #endif /* defined(DSSP_DEBUG) && (DSSP_DEBUG & DB_AUDIO) */
 
     /* attempt the mutex, return only silence if lock fails. */
-    if (dssp_voicelist_mutex_trylock(instance))
+    if (dssp_voicelist_mutex_trylock(instance)) {
+        if (instance->recorder)
+            hexter_record_run(instance->recorder, sample_count, events,
+                              event_count, instance->output, *instance->tuning,
+                              *instance->volume, HEXTER_RECORD_FLAG_VOICELIST_BUSY);
         return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
 
-    if (instance->pending_program_change > -1)
-        hexter_handle_pending_program_change(instance);
+    if (instance->pending_program_change > -1 || HEXTER_INSTANCE_MULTITIMBRAL(instance))
+        hexter_instance_handle_pending_program_change(instance);
 
     while (samples_done < sample_count) {
 
         if (!instance->nugget_remains)
-            instance->nugget_remains = HEXTER_NUGGET_SIZE;
+            instance->nugget_remains = instance->nugget_frames;
 
         /* process any ready events */
         while (event_index < event_count
@@ -474,14 +460,14 @@ hexter_run_synth(LADSPA_Handle handle, unsigned long sample_count,
 
         /* calculate the sample count (burst_size) for the next
          * hexter_instance_render_voices() call to be the smallest of:
-         * - control calculation quantization size (HEXTER_NUGGET_SIZE,
-         *     in samples)
+         * - control calculation quantization size (HEXTER_NUGGET_SIZE
+         *     samples, instance->nugget_frames frames)
          * - the number of samples remaining in an already-begun nugget
          *     (instance->nugget_remains)
          * - the number of samples until the next event is ready
          * - the number of samples left in this run
          */
-        burst_size = HEXTER_NUGGET_SIZE;
+        burst_size = instance->nugget_frames;
         if (instance->nugget_remains < burst_size) {
             /* we're still in the middle of a nugget, so reduce the burst size
              * to end when the nugget ends */
@@ -504,7 +490,20 @@ hexter_run_synth(LADSPA_Handle handle, unsigned long sample_count,
         instance->nugget_remains -= burst_size;
     }
 
+    /* measure this run against its deadline, for the statistics and the
+     * governor */
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    hexter_instance_update_load(instance, sample_count,
+                                (double)(end.tv_sec - start.tv_sec) +
+                                (double)(end.tv_nsec - start.tv_nsec) / 1000000000.0);
+
     dssp_voicelist_mutex_unlock(instance);
+
+    if (instance->recorder)
+        hexter_record_run(instance->recorder, sample_count, events, event_count,
+                          instance->output, *instance->tuning, *instance->volume,
+                          (instance->pending_program_change > -1 ?
+                               HEXTER_RECORD_FLAG_PATCHES_BUSY : 0));
 }
 
 // optional:
@@ -557,8 +556,6 @@ void _init()
 
     DSSP_DEBUG_INIT("hexter.so");
 
-    dx7_voice_init_tables();
-
     hexter_LADSPA_descriptor =
         (LADSPA_Descriptor *) malloc(sizeof(LADSPA_Descriptor));
     if (hexter_LADSPA_descriptor) {
@@ -649,249 +646,3 @@ void _fini()
         free(hexter_DSSI_descriptor);
     }
 }
-
-/*
- * dx7_patchbank_load
- */
-int
-dx7_patchbank_load_init(const char *filename, dx7_patch_t *firstpatch,
-                        int maxpatches, char **errmsg)
-{
-    FILE *fp;
-    long filelength;
-    unsigned char *raw_patch_data = NULL;
-    size_t filename_length;
-    int count;
-    int patchstart;
-    int midshift;
-    int datastart;
-    int i;
-    int op;
-
-    /* this needs to 1) open and parse the file, 2a) if it's good, copy up
-     * to maxpatches patches beginning at firstpath, and not touch errmsg,
-     * 2b) if it's not good, set errmsg to a malloc'd error message that
-     * the caller must free. */
-
-    if ((fp = fopen(filename, "rb")) == NULL) {
-        if (errmsg) *errmsg = dssp_error_message("could not open file '%s' for reading: %s", filename, strerror(errno));
-        return 0;
-    }
-
-    if (fseek(fp, 0, SEEK_END) ||
-        (filelength = ftell(fp)) == -1 ||
-        fseek(fp, 0, SEEK_SET)) {
-        if (errmsg) *errmsg = dssp_error_message("couldn't get length of patch file: %s", strerror(errno));
-        fclose(fp);
-        return 0;
-    }
-    if (filelength == 0) {
-        if (errmsg) *errmsg = strdup("patch file has zero length");
-        fclose(fp);
-        return 0;
-    } else if (filelength > 2097152) {
-        if (errmsg) *errmsg = strdup("patch file is too large");
-        fclose(fp);
-        return 0;
-    } else if (filelength < 128) {
-        if (errmsg) *errmsg = strdup ("patch file is too small");
-        fclose (fp);
-        return 0;
-    }
-
-    if (!(raw_patch_data = (unsigned char *)malloc(filelength))) {
-        if (errmsg) *errmsg = strdup("couldn't allocate memory for raw patch file");
-        fclose(fp);
-        return 0;
-    }
-
-    if (fread(raw_patch_data, 1, filelength, fp) != (size_t)filelength) {
-        if (errmsg) *errmsg = dssp_error_message("short read on patch file: %s", strerror(errno));
-        free(raw_patch_data);
-        fclose(fp);
-        return 0;
-    }
-    fclose(fp);
-    filename_length = strlen (filename);
-
-    /* check if the file is a standard MIDI file */
-    if (raw_patch_data[0] == 0x4d &&    /* "M" */
-        raw_patch_data[1] == 0x54 &&    /* "T" */
-        raw_patch_data[2] == 0x68 &&    /* "h" */
-        raw_patch_data[3] == 0x64)      /* "d" */
-        midshift = 2;
-    else
-        midshift = 0;
-
-    /* scan SysEx or MIDI file for SysEx header(s) */
-    count = 0;
-    datastart = 0;
-    for (patchstart = 0; patchstart + midshift + 5 < filelength; patchstart++) {
-
-        if (raw_patch_data[patchstart] == 0xf0 &&
-            raw_patch_data[patchstart + 1 + midshift] == 0x43 &&
-            raw_patch_data[patchstart + 2 + midshift] <= 0x0f &&
-            raw_patch_data[patchstart + 3 + midshift] == 0x09 &&
-            raw_patch_data[patchstart + 5 + midshift] == 0x00 &&
-            patchstart + 4103 + midshift < filelength &&
-            raw_patch_data[patchstart + 4103 + midshift] == 0xf7) {  /* DX7 32 voice dump */
-
-            memmove(raw_patch_data + count * DX7_VOICE_SIZE_PACKED,
-                    raw_patch_data + patchstart + 6 + midshift, 4096);
-            count += 32;
-            patchstart += (DX7_DUMP_SIZE_VOICE_BULK - 1);
-
-        } else if (raw_patch_data[patchstart] == 0xf0 &&
-                   raw_patch_data[patchstart + midshift + 1] == 0x43 &&
-                   raw_patch_data[patchstart + midshift + 2] <= 0x0f &&
-                   raw_patch_data[patchstart + midshift + 4] == 0x01 &&
-                   raw_patch_data[patchstart + midshift + 5] == 0x1b &&
-                   patchstart + midshift + 162 < filelength &&
-                   raw_patch_data[patchstart + midshift + 162] == 0xf7) {  /* DX7 single voice (edit buffer) dump */
-
-            unsigned char buf[DX7_VOICE_SIZE_PACKED]; /* to avoid overlap in dx7_patch_pack() */
-
-            dx7_patch_pack(raw_patch_data + patchstart + midshift + 6,
-                           (dx7_patch_t *)buf, 0);
-            memcpy(raw_patch_data + count * DX7_VOICE_SIZE_PACKED,
-                   buf, DX7_VOICE_SIZE_PACKED);
-
-            count += 1;
-            patchstart += (DX7_DUMP_SIZE_VOICE_SINGLE - 1);
-        }
-    }
-
-    /* assume raw DX7/TX7 data if no SysEx header was found. */
-    /* assume the user knows what he is doing ;-) */
-
-    if (count == 0)
-        count = filelength / DX7_VOICE_SIZE_PACKED;
-
-    /* Dr.T and Steinberg TX7 file needs special treatment */
-    if ((!strcmp(filename + filename_length - 4, ".TX7") ||
-         !strcmp(filename + filename_length -4, ".SND") ||
-         !strcmp(filename + filename_length -4, ".tx7") ||
-         !strcmp(filename + filename_length - 4, ".snd")) && filelength == 8192) {
-
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Transform XSyn file also needs special treatment */
-    if ((!strcmp(filename + filename_length - 4, ".BNK") ||
-         !strcmp(filename + filename_length - 4, ".bnk")) && filelength == 8192) {
-
-        for (i=0; i<32; i++)
-        {
-            memmove(raw_patch_data + 128*i, raw_patch_data + 256*i, 128);
-        }
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Steinberg Synthworks DX7 SND */
-    if ((!strcmp (filename + filename_length - 4, ".SND") ||
-         !strcmp (filename + filename_length - 4, ".snd")) && filelength == 5216) {
-
-        count = 32;
-        filelength = 4096;
-    }
-
-    /* Voyetra SIDEMAN DX/TX
-     * Voyetra Patchmaster DX7/TX7 */
-    if ((filelength == 9816 || filelength == 5663) &&
-        raw_patch_data[0] == 0xdf &&
-        raw_patch_data[1] == 0x05 &&
-        raw_patch_data[2] == 0x01 && raw_patch_data[3] == 0x00) {
-
-        count = 32;
-        datastart = 0x60f;
-    }
-
-    /* Yamaha DX200 editor .DX2 */
-    if ((!strcmp (filename + filename_length - 4, ".DX2") ||
-         !strcmp (filename + filename_length - 4, ".dx2"))
-        && filelength == 326454)
-      {
-          memmove (raw_patch_data + 16384, raw_patch_data + 34, 128 * 381);
-          for (count = 0; count < 128; count++)
-            {
-                for (op = 0; op < 6; op++)
-                  {
-                      for (i = 0; i < 8; i++)
-                        {
-                            raw_patch_data[17 * (5 - op) + i + 128 * count] =
-                                raw_patch_data[16384 + 35 * op + 76 + i + 381 * count];
-                        }
-                      raw_patch_data[17 * (5 - op) + 8 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 84 + 381 * count] - 21;
-                      raw_patch_data[17 * (5 - op) + 9 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 87 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 10 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 88 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 11 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 85 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 86 + 381 * count] * 4;
-                      raw_patch_data[17 * (5 - op) + 12 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 89 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 75 + 381 * count] * 8;
-                      if (raw_patch_data[16384 + 35 * op + 71 + 381 * count] > 3)
-                          raw_patch_data[16384 + 35 * op + 71 + 381 * count] = 3;
-                      raw_patch_data[17 * (5 - op) + 13 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 71 + 381 * count] / 2 +
-                          raw_patch_data[16384 + 35 * op + 91 + 381 * count] * 4;
-                      raw_patch_data[17 * (5 - op) + 14 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 90 + 381 * count];
-                      raw_patch_data[17 * (5 - op) + 15 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 72 + 381 * count] +
-                          raw_patch_data[16384 + 35 * op + 73 + 381 * count] * 2;
-                      raw_patch_data[17 * (5 - op) + 16 + 128 * count] =
-                          raw_patch_data[16384 + 35 * op + 74 + 381 * count];
-                  }
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[102 + i + 128 * count] =
-                          raw_patch_data[16384 + 26 + i + 381 * count];
-                  }
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[106 + i + 128 * count] =
-                          raw_patch_data[16384 + 32 + i + 381 * count];
-                  }
-                raw_patch_data[110 + 128 * count] =
-                    raw_patch_data[16384 + 17 + 381 * count];
-                raw_patch_data[111 + 128 * count] =
-                    raw_patch_data[16384 + 18 + 381 * count] +
-                    raw_patch_data[16384 + 38 + 381 * count] * 8;
-                for (i = 0; i < 4; i++)
-                  {
-                      raw_patch_data[112 + i + 128 * count] =
-                          raw_patch_data[16384 + 20 + i + 381 * count];
-                  }
-                raw_patch_data[116 + 128 * count] =
-                    raw_patch_data[16384 + 24 + 381 * count] +
-                    raw_patch_data[16384 + 19 + 381 * count] * 2 +
-                    raw_patch_data[16384 + 25 + 381 * count] * 16;
-                raw_patch_data[117 + 128 * count] =
-                    raw_patch_data[16384 + 37 + 381 * count] - 36;
-                for (i = 0; i < 10; i++)
-                  {
-                      raw_patch_data[118 + i + 128 * count] =
-                          raw_patch_data[16384 + i + 381 * count];
-                  }
-            }
-
-          count = 128;
-          filelength = 16384;
-          datastart = 0;
-
-      }
-
-    /* finally, copy patchdata to the right location */
-    if (count > maxpatches)
-        count = maxpatches;
-
-    memcpy(firstpatch, raw_patch_data + datastart, 128 * count);
-    free (raw_patch_data);
-    return count;
-}
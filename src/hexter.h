@@ -83,6 +83,31 @@
 
 #define HEXTER_NUGGET_SIZE    64
 
+/* CPU-load governor ('configure governor on') tuning: the load is render
+ * time as a fraction of the block deadline, smoothed with this time
+ * constant (in seconds).  Above the high-water mark the voice limit is
+ * lowered, below the low-water mark it is raised again, with at least one
+ * time constant between changes. */
+#define HEXTER_GOVERNOR_TIME_CONSTANT  0.1
+#define HEXTER_GOVERNOR_HIGH_LOAD      0.7f
+#define HEXTER_GOVERNOR_LOW_LOAD       0.4f
+#define HEXTER_GOVERNOR_MIN_VOICES     2
+
+/* De-clicking: a stolen voice is faded out over this time (in seconds) by
+ * one of a few 'ghost' voices, instead of being cut off. */
+#define HEXTER_DECLICK_TIME  0.004
+#define HEXTER_MAX_GHOSTS    4
+
+/* Multitimbral operation ('configure multitimbral on'): one part per MIDI
+ * channel, all playing from the instance's one pool of voices. */
+#define HEXTER_PARTS  16
+
+/* Internal sample rate ('configure internal_rate auto'): the voices render
+ * at the host rate divided by the largest of 4 or 2 that leaves at least
+ * this rate, and are resampled up to the host rate.  At 88.2kHz and up,
+ * this saves rendering bandwidth no one can hear. */
+#define HEXTER_INTERNAL_RATE_MIN  44100.0f
+
 #define HEXTER_PORT_OUTPUT  0
 #define HEXTER_PORT_TUNING  1
 #define HEXTER_PORT_VOLUME  2
@@ -0,0 +1,590 @@
+/* hexter bulk patch audition renderer
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Renders a short preview clip of every patch in the given bank files,
+ * and in every bank of the -l patch library: one note of key -k (default
+ * 60), velocity -V (default 100), held for -d seconds (default 1), then
+ * released for up to -t seconds (default 2), ending early once the
+ * release has died away.  The patches are divided among -j worker threads
+ * (default: one per processor), each rendering with one engine and one
+ * clip buffer throughout.
+ *
+ * With -o <directory>, each clip is written as a mono 32-bit float WAV
+ * file named for its number and patch name.  With -c <file>, all are
+ * written to one container file, laid out as follows, all numbers being
+ * little-endian:
+ *
+ *   header, 32 bytes:
+ *     "HXAU", then uint32 version (1), sample rate, clip count, source
+ *     count and held frames, then uint8 key and velocity, and 6 zeros
+ *   index, 32 bytes per clip, in the order the clips were given:
+ *     uint64 byte offset of the clip's samples from the start of the
+ *     file, then uint32 frame count, source number, and patch number
+ *     within the source, then the 10-character patch name and 2 zeros
+ *   sources, one NUL-terminated string each:
+ *     the bank file name, or 'library:<bank>'
+ *   samples, 32-bit floats, clip after clip in the order they finished
+ *
+ * usage: hexter_audition [-k <key>] [-V <velocity>] [-d <seconds>]
+ *                        [-t <seconds>] [-r <sample rate>] [-j <threads>]
+ *                        [-l <library>] [-v] (-o <directory> | -c <file>)
+ *                        [<bank file> ...]
+ */
+
+#define _GNU_SOURCE 1
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "hexter_engine.h"
+
+#define AUDITION_BLOCK       1024        /* frames between checks for silence */
+#define AUDITION_SILENCE     0.0001f     /* -80 dB */
+#define PATCH_SIZE           128         /* bytes per packed DX7 voice */
+
+#define CONTAINER_HEADER_SIZE  32
+#define CONTAINER_ENTRY_SIZE   32
+
+typedef struct _clip_t
+{
+    unsigned long   source;
+    unsigned long   number;    /* within the source */
+    unsigned long   bank;      /* the engine bank it is played from */
+    unsigned long   program;
+    const uint8_t  *patch;     /* for bank file patches, else NULL */
+    uint64_t        offset;    /* in the container */
+    unsigned long   frames;
+    char            name[11];
+} clip_t;
+
+static int key = 60;
+static int velocity = 100;
+static double held = 1.0;
+static double tail = 2.0;
+static unsigned long sample_rate = 44100;
+static int threads = 0;
+static const char *library_file = NULL;
+static const char *output_dir = NULL;
+static const char *container_file = NULL;
+static int verbose = 0;
+
+static char **sources;
+static unsigned long source_count;
+static uint8_t *patches;
+static clip_t *clips;
+static unsigned long clip_count;
+static unsigned long held_frames, max_frames;
+
+/* the work queue: clips are handed out in pages of those sharing a bank */
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long next_clip;
+static FILE *container;
+static uint64_t container_offset;
+static double audio_seconds;
+
+static void
+usage(const char *program_name)
+{
+    fprintf(stderr, "usage: %s [-k <key>] [-V <velocity>] [-d <seconds>] [-t <seconds>]\n"
+                    "          [-r <sample rate>] [-j <threads>] [-l <library>] [-v]\n"
+                    "          (-o <directory> | -c <file>) [<bank file> ...]\n",
+            program_name);
+    exit(1);
+}
+
+static void
+out_of_memory(void)
+{
+    fprintf(stderr, "hexter_audition: out of memory\n");
+    exit(1);
+}
+
+static double
+clock_seconds(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+static void
+put_le32(uint8_t *p, uint32_t value)
+{
+    p[0] = value & 0xff;
+    p[1] = (value >> 8) & 0xff;
+    p[2] = (value >> 16) & 0xff;
+    p[3] = value >> 24;
+}
+
+static void
+add_source(const char *name)
+{
+    sources = (char **)realloc(sources, (source_count + 1) * sizeof(char *));
+    if (!sources || !(sources[source_count] = strdup(name)))
+        out_of_memory();
+    source_count++;
+}
+
+static clip_t *
+add_clip(unsigned long number)
+{
+    clip_t *clip;
+
+    clips = (clip_t *)realloc(clips, (clip_count + 1) * sizeof(clip_t));
+    if (!clips)
+        out_of_memory();
+    clip = &clips[clip_count++];
+    memset(clip, 0, sizeof(clip_t));
+    clip->source = source_count - 1;
+    clip->number = number;
+    return clip;
+}
+
+/*
+ * collect_clips
+ *
+ * read the patches of the bank files, and find those of the library
+ */
+static void
+collect_clips(int file_count, char **files)
+{
+    unsigned long count, total = 0, capacity, i, bank;
+    hexter_engine_t *engine;
+    struct stat st;
+    char *errmsg;
+    int f;
+
+    for (f = 0; f < file_count; f++) {
+        if (stat(files[f], &st) < 0) {
+            fprintf(stderr, "hexter_audition: could not stat '%s'\n", files[f]);
+            continue;
+        }
+        /* no layout packs a patch in fewer than 128 bytes */
+        capacity = st.st_size / PATCH_SIZE + 32;
+        patches = (uint8_t *)realloc(patches, (total + capacity) * PATCH_SIZE);
+        if (!patches)
+            out_of_memory();
+        count = hexter_engine_read_patches(files[f], patches + total * PATCH_SIZE,
+                                           capacity, &errmsg);
+        if (!count) {
+            fprintf(stderr, "hexter_audition: skipping '%s': %s\n", files[f], errmsg);
+            free(errmsg);
+            continue;
+        }
+        add_source(files[f]);
+        for (i = 0; i < count; i++)
+            add_clip(i)->bank = total + i;  /* fixed up below */
+        total += count;
+        if (verbose)
+            printf("%s: %lu patches\n", files[f], count);
+    }
+    /* now that 'patches' has stopped moving */
+    for (i = 0; i < clip_count; i++) {
+        clips[i].patch = patches + clips[i].bank * PATCH_SIZE;
+        clips[i].bank = 0;
+        clips[i].program = i % 128;
+        memcpy(clips[i].name, clips[i].patch + 118, 10);
+    }
+
+    if (!library_file)
+        return;
+    engine = hexter_engine_new(sample_rate);
+    if (!engine)
+        out_of_memory();
+    if ((errmsg = hexter_engine_configure(engine, "library", library_file))) {
+        fprintf(stderr, "hexter_audition: could not open library '%s': %s\n",
+                library_file, errmsg);
+        exit(1);
+    }
+    for (bank = 1; ; bank++) {
+        char name[11], source[32];
+
+        if (!hexter_engine_patch_name(engine, bank, 0, name))
+            break;
+        snprintf(source, sizeof(source), "library:%lu", bank);
+        add_source(source);
+        for (i = 0; i < 128 && hexter_engine_patch_name(engine, bank, i, name); i++) {
+            clip_t *clip = add_clip(i);
+
+            clip->bank = bank;
+            clip->program = i;
+            memcpy(clip->name, name, 10);
+        }
+    }
+    if (verbose)
+        printf("%s: %lu banks\n", library_file, bank - 1);
+    hexter_engine_free(engine);
+}
+
+/*
+ * render_clip
+ *
+ * render one note of the selected program into 'buffer', returning the
+ * number of frames kept
+ */
+static unsigned long
+render_clip(hexter_engine_t *engine, float *buffer)
+{
+    hexter_engine_event_t events[2];
+    unsigned long done = 0, count, e, i;
+    float peak;
+
+    events[0].frame = 0;
+    events[0].status = 0x90;
+    events[0].data1 = key;
+    events[0].data2 = velocity;
+    events[1].frame = held_frames;
+    events[1].status = 0x80;
+    events[1].data1 = key;
+    events[1].data2 = 64;
+
+    while (done < max_frames) {
+        count = (max_frames - done < AUDITION_BLOCK ? max_frames - done : AUDITION_BLOCK);
+        for (e = 0; e < 2 && events[e].frame < done; e++);
+        for (i = e; i < 2; i++)
+            events[i].frame -= done;
+        hexter_engine_render(engine, buffer + done, count, events + e, 2 - e);
+        for (i = e; i < 2; i++)
+            events[i].frame += done;
+
+        done += count;
+        if (done > held_frames) {  /* stop once the release has died away */
+            for (i = done - count, peak = 0.0f; i < done; i++) {
+                if (buffer[i] > peak) peak = buffer[i];
+                else if (-buffer[i] > peak) peak = -buffer[i];
+            }
+            if (peak < AUDITION_SILENCE)
+                break;
+        }
+    }
+    return done;
+}
+
+static void
+write_samples(FILE *fp, const float *samples, unsigned long count, uint8_t *bytes)
+{
+    unsigned long i;
+    uint32_t bits;
+
+    for (i = 0; i < count; i++) {  /* both formats are little-endian */
+        memcpy(&bits, &samples[i], 4);
+        put_le32(bytes + i * 4, bits);
+    }
+    fwrite(bytes, 4, count, fp);
+}
+
+/*
+ * write_wav
+ *
+ * write a clip as a mono WAVE_FORMAT_IEEE_FLOAT file
+ */
+static int
+write_wav(clip_t *clip, unsigned long index, const float *buffer, uint8_t *bytes)
+{
+    char filename[4096], name[11];
+    uint8_t header[58];
+    FILE *fp;
+    int i, ok;
+
+    for (i = 0; i < 10 && clip->name[i]; i++)
+        name[i] = ((clip->name[i] >= 'A' && clip->name[i] <= 'Z') ||
+                   (clip->name[i] >= 'a' && clip->name[i] <= 'z') ||
+                   (clip->name[i] >= '0' && clip->name[i] <= '9')) ? clip->name[i] : '_';
+    while (i > 0 && name[i - 1] == '_')
+        i--;
+    name[i] = 0;
+    snprintf(filename, sizeof(filename), "%s/%05lu-%s.wav", output_dir, index + 1, name);
+
+    if ((fp = fopen(filename, "wb")) == NULL) {
+        fprintf(stderr, "hexter_audition: could not create '%s'\n", filename);
+        return 0;
+    }
+    memcpy(header, "RIFF", 4);
+    put_le32(header + 4, 50 + clip->frames * 4);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    put_le32(header + 16, 18);
+    put_le32(header + 20, 3 | (1 << 16));        /* format 3, 1 channel */
+    put_le32(header + 24, sample_rate);
+    put_le32(header + 28, sample_rate * 4);      /* bytes per second */
+    put_le32(header + 32, 4 | (32 << 16));       /* block align, bits */
+    header[36] = header[37] = 0;                 /* no extension */
+    memcpy(header + 38, "fact", 4);
+    put_le32(header + 42, 4);
+    put_le32(header + 46, clip->frames);
+    memcpy(header + 50, "data", 4);
+    put_le32(header + 54, clip->frames * 4);
+    fwrite(header, 1, sizeof(header), fp);
+    write_samples(fp, buffer, clip->frames, bytes);
+
+    ok = !ferror(fp);
+    if (fclose(fp) || !ok) {
+        fprintf(stderr, "hexter_audition: error writing '%s'\n", filename);
+        return 0;
+    }
+    return 1;
+}
+
+static void *
+worker(void *arg)
+{
+    hexter_engine_t *engine = hexter_engine_new(sample_rate);
+    float *buffer = (float *)malloc(max_frames * sizeof(float));
+    uint8_t *bytes = (uint8_t *)malloc(max_frames * 4),
+            *page = (uint8_t *)calloc(128, PATCH_SIZE);
+    unsigned long first, last, i;
+    clip_t *clip;
+    char *errmsg;
+
+    if (!engine || !buffer || !bytes || !page)
+        out_of_memory();
+    hexter_engine_set_offline(engine, 1);
+    if (library_file &&
+        (errmsg = hexter_engine_configure(engine, "library", library_file))) {
+        fprintf(stderr, "hexter_audition: could not open library '%s': %s\n",
+                library_file, errmsg);
+        exit(1);
+    }
+
+    for (;;) {
+        /* take the next page: up to 128 bank file patches, or a library bank */
+        pthread_mutex_lock(&queue_mutex);
+        first = next_clip;
+        for (last = first + 1; last < clip_count &&
+                               clips[last].bank == clips[first].bank &&
+                               clips[last].program != 0; last++);
+        if (first < clip_count)
+            next_clip = last;
+        pthread_mutex_unlock(&queue_mutex);
+        if (first >= clip_count)
+            break;
+
+        if (!clips[first].bank) {
+            for (i = first; i < last; i++)
+                memcpy(page + clips[i].program * PATCH_SIZE, clips[i].patch, PATCH_SIZE);
+            if (!hexter_engine_set_patches(engine, page))
+                out_of_memory();
+        }
+
+        for (i = first; i < last; i++) {
+            clip = &clips[i];
+            hexter_engine_reset(engine);
+            hexter_engine_select_program(engine, clip->bank, clip->program);
+            clip->frames = render_clip(engine, buffer);
+
+            if (container) {
+                pthread_mutex_lock(&queue_mutex);
+                clip->offset = container_offset;
+                container_offset += clip->frames * 4;
+                write_samples(container, buffer, clip->frames, bytes);
+                audio_seconds += (double)clip->frames / sample_rate;
+                pthread_mutex_unlock(&queue_mutex);
+            } else {
+                write_wav(clip, i, buffer, bytes);
+                pthread_mutex_lock(&queue_mutex);
+                audio_seconds += (double)clip->frames / sample_rate;
+                pthread_mutex_unlock(&queue_mutex);
+            }
+        }
+        if (verbose)
+            printf("clips %lu to %lu done\n", first + 1, last);
+    }
+
+    hexter_engine_free(engine);
+    free(buffer);
+    free(bytes);
+    free(page);
+    return NULL;
+}
+
+/*
+ * open_container
+ *
+ * create the container, leaving room for its header and index
+ */
+static void
+open_container(void)
+{
+    uint8_t zeros[CONTAINER_ENTRY_SIZE];
+    unsigned long i;
+
+    if ((container = fopen(container_file, "wb")) == NULL) {
+        fprintf(stderr, "hexter_audition: could not create '%s'\n", container_file);
+        exit(1);
+    }
+    memset(zeros, 0, sizeof(zeros));
+    fwrite(zeros, 1, CONTAINER_HEADER_SIZE, container);
+    for (i = 0; i < clip_count; i++)
+        fwrite(zeros, 1, CONTAINER_ENTRY_SIZE, container);
+    container_offset = CONTAINER_HEADER_SIZE + clip_count * CONTAINER_ENTRY_SIZE;
+    for (i = 0; i < source_count; i++) {
+        fwrite(sources[i], 1, strlen(sources[i]) + 1, container);
+        container_offset += strlen(sources[i]) + 1;
+    }
+}
+
+static void
+close_container(void)
+{
+    uint8_t entry[CONTAINER_ENTRY_SIZE];
+    unsigned long i;
+    int ok;
+
+    memset(entry, 0, sizeof(entry));
+    memcpy(entry, "HXAU", 4);
+    put_le32(entry + 4, 1);
+    put_le32(entry + 8, sample_rate);
+    put_le32(entry + 12, clip_count);
+    put_le32(entry + 16, source_count);
+    put_le32(entry + 20, held_frames);
+    entry[24] = key;
+    entry[25] = velocity;
+    fseek(container, 0, SEEK_SET);
+    fwrite(entry, 1, CONTAINER_HEADER_SIZE, container);
+
+    for (i = 0; i < clip_count; i++) {
+        memset(entry, 0, sizeof(entry));
+        put_le32(entry, clips[i].offset & 0xffffffff);
+        put_le32(entry + 4, clips[i].offset >> 32);
+        put_le32(entry + 8, clips[i].frames);
+        put_le32(entry + 12, clips[i].source);
+        put_le32(entry + 16, clips[i].number);
+        memcpy(entry + 20, clips[i].name, 10);
+        fwrite(entry, 1, CONTAINER_ENTRY_SIZE, container);
+    }
+
+    ok = !ferror(container);
+    if (fclose(container) || !ok) {
+        fprintf(stderr, "hexter_audition: error writing '%s'\n", container_file);
+        exit(1);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    double wall_time;
+    pthread_t *workers;
+    unsigned long i;
+    int c;
+
+    while ((c = getopt(argc, argv, "k:V:d:t:r:j:l:o:c:v")) != -1) {
+        switch (c) {
+          case 'k':
+            key = atoi(optarg);
+            break;
+          case 'V':
+            velocity = atoi(optarg);
+            break;
+          case 'd':
+            held = atof(optarg);
+            break;
+          case 't':
+            tail = atof(optarg);
+            break;
+          case 'r':
+            sample_rate = strtoul(optarg, NULL, 10);
+            break;
+          case 'j':
+            threads = atoi(optarg);
+            break;
+          case 'l':
+            library_file = optarg;
+            break;
+          case 'o':
+            output_dir = optarg;
+            break;
+          case 'c':
+            container_file = optarg;
+            break;
+          case 'v':
+            verbose = 1;
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (!output_dir == !container_file || (optind == argc && !library_file))
+        usage(argv[0]);
+    if (key < 0 || key > 127 || velocity < 1 || velocity > 127 ||
+        held <= 0.0 || tail < 0.0 || held + tail > 60.0 ||
+        sample_rate < 8000 || sample_rate > 192000 || threads < 0) {
+        fprintf(stderr, "hexter_audition: invalid option value\n");
+        exit(1);
+    }
+    held_frames = (unsigned long)(held * (double)sample_rate);
+    max_frames = held_frames + (unsigned long)(tail * (double)sample_rate);
+
+    collect_clips(argc - optind, argv + optind);
+    if (!clip_count) {
+        fprintf(stderr, "hexter_audition: no patches found\n");
+        exit(1);
+    }
+    if (output_dir)
+        mkdir(output_dir, 0777);  /* it may already exist */
+    else
+        open_container();
+
+    if (!threads)
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1)
+        threads = 1;
+    if ((unsigned long)threads > (clip_count + 127) / 128)
+        threads = (clip_count + 127) / 128;
+    workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    if (!workers)
+        out_of_memory();
+
+    wall_time = clock_seconds(CLOCK_MONOTONIC);
+    for (c = 0; c < threads; c++)
+        if (pthread_create(&workers[c], NULL, worker, NULL)) {
+            fprintf(stderr, "hexter_audition: could not start worker thread\n");
+            exit(1);
+        }
+    for (c = 0; c < threads; c++)
+        pthread_join(workers[c], NULL);
+    wall_time = clock_seconds(CLOCK_MONOTONIC) - wall_time;
+
+    if (container)
+        close_container();
+
+    printf("rendered %lu clips, %.1f s of audio, in %.2f s on %d thread%s: "
+           "%.1f clips/s, %.1fx realtime\n",
+           clip_count, audio_seconds, wall_time, threads, threads == 1 ? "" : "s",
+           wall_time > 0.0 ? clip_count / wall_time : 0.0,
+           wall_time > 0.0 ? audio_seconds / wall_time : 0.0);
+
+    for (i = 0; i < source_count; i++)
+        free(sources[i]);
+    free(sources);
+    free(patches);
+    free(clips);
+    free(workers);
+    return 0;
+}
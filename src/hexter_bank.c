@@ -0,0 +1,410 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "hexter_types.h"
+#include "dx7_voice_data.h"
+#include "hexter_bank.h"
+
+#define BANK_SIZE     (128 * DX7_VOICE_SIZE_PACKED)
+#define SECTION_SIZE  (32 * DX7_VOICE_SIZE_PACKED)
+
+struct _hexter_bank_t
+{
+    hexter_bank_t  *next;              /* in the list of all banks */
+    int             refcount;
+    uint64_t        hash;              /* of the patches */
+    uint64_t        section_key[4];    /* hexter_bank_key() of each section's source, or 0 */
+    uint8_t         patches[BANK_SIZE];
+};
+
+/* all live banks, and the built-in bank, which is never freed */
+static pthread_mutex_t bank_mutex = PTHREAD_MUTEX_INITIALIZER;
+static hexter_bank_t  *bank_list = NULL;
+static hexter_bank_t  *bank_builtin = NULL;
+
+/*
+ * bank_hash
+ *
+ * 64-bit hash of a block of memory, taken a word at a time
+ */
+static uint64_t
+bank_hash(const uint8_t *data, size_t length)
+{
+    uint64_t hash = 14695981039346656037ULL ^ length;
+    uint64_t word;
+
+    while (length >= 8) {
+        memcpy(&word, data, 8);
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 29;
+        data += 8;
+        length -= 8;
+    }
+    if (length) {
+        word = 0;
+        memcpy(&word, data, length);
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+    }
+    hash ^= hash >> 32;
+    hash *= 0xd6e8feb86659fd93ULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/*
+ * bank_find
+ *
+ * with bank_mutex held, return the bank with the given contents, or NULL
+ */
+static hexter_bank_t *
+bank_find(uint64_t hash, const uint8_t *patches)
+{
+    hexter_bank_t *bank;
+
+    for (bank = bank_list; bank; bank = bank->next)
+        if (bank->hash == hash && !memcmp(bank->patches, patches, BANK_SIZE))
+            return bank;
+    return NULL;
+}
+
+/*
+ * bank_unlink
+ *
+ * with bank_mutex held, remove a bank from the list
+ */
+static void
+bank_unlink(hexter_bank_t *bank)
+{
+    hexter_bank_t **prev;
+
+    for (prev = &bank_list; *prev; prev = &(*prev)->next) {
+        if (*prev == bank) {
+            *prev = bank->next;
+            return;
+        }
+    }
+}
+
+/*
+ * bank_merge
+ *
+ * With bank_mutex held, resolve 'bank', which is not on the list, against
+ * the existing banks: if one has the same contents, take a reference to it,
+ * pass on the section keys, and free 'bank'; otherwise add 'bank' to the
+ * list.  Returns the bank that should be used.
+ */
+static hexter_bank_t *
+bank_merge(hexter_bank_t *bank)
+{
+    hexter_bank_t *other = bank_find(bank->hash, bank->patches);
+    int i;
+
+    if (!other) {
+        bank->next = bank_list;
+        bank_list = bank;
+        return bank;
+    }
+    for (i = 0; i < 4; i++)
+        if (!other->section_key[i])
+            other->section_key[i] = bank->section_key[i];
+    other->refcount++;
+    free(bank);
+    return other;
+}
+
+/*
+ * bank_edit
+ *
+ * With bank_mutex held, return a bank, not on the list, that may be changed
+ * in place of 'bank', taking over the caller's reference to it: 'bank'
+ * itself if the caller holds the only reference, otherwise a copy.  Returns
+ * NULL if out of memory.
+ */
+static hexter_bank_t *
+bank_edit(hexter_bank_t *bank)
+{
+    hexter_bank_t *copy;
+
+    if (bank->refcount == 1) {
+        bank_unlink(bank);
+        return bank;
+    }
+    copy = (hexter_bank_t *)malloc(sizeof(hexter_bank_t));
+    if (!copy)
+        return NULL;
+    memcpy(copy, bank, sizeof(hexter_bank_t));
+    copy->refcount = 1;
+    bank->refcount--;
+    return copy;
+}
+
+/*
+ * hexter_bank_key
+ *
+ * return the key identifying a 'patchesN' configure() value, never 0
+ */
+uint64_t
+hexter_bank_key(const char *value)
+{
+    uint64_t key = bank_hash((const uint8_t *)value, strlen(value));
+
+    return key ? key : 1;
+}
+
+/*
+ * hexter_bank_has_section
+ *
+ * return non-zero if 'bank' is known to hold the section identified by 'key'
+ */
+int
+hexter_bank_has_section(hexter_bank_t *bank, int section, uint64_t key)
+{
+    int found;
+
+    pthread_mutex_lock(&bank_mutex);
+    found = (bank->section_key[section] == key);
+    pthread_mutex_unlock(&bank_mutex);
+    return found;
+}
+
+/*
+ * hexter_bank_find_section
+ *
+ * If any bank holds the section identified by 'key', copy its 32 patches
+ * to 'patches' and return non-zero; otherwise return 0, and the caller must
+ * decode the section itself.
+ */
+int
+hexter_bank_find_section(uint64_t key, dx7_patch_t *patches)
+{
+    hexter_bank_t *bank;
+    int i;
+
+    pthread_mutex_lock(&bank_mutex);
+    for (bank = bank_list; bank; bank = bank->next) {
+        for (i = 0; i < 4; i++) {
+            if (bank->section_key[i] == key) {
+                memcpy(patches, bank->patches + i * SECTION_SIZE, SECTION_SIZE);
+                pthread_mutex_unlock(&bank_mutex);
+                return 1;
+            }
+        }
+    }
+    pthread_mutex_unlock(&bank_mutex);
+    return 0;
+}
+
+/*
+ * hexter_bank_get
+ *
+ * return a reference to the bank holding the given 128 patches, creating
+ * it if needed, or NULL if out of memory
+ */
+hexter_bank_t *
+hexter_bank_get(const dx7_patch_t *patches)
+{
+    uint64_t hash = bank_hash((const uint8_t *)patches, BANK_SIZE);
+    hexter_bank_t *bank;
+
+    pthread_mutex_lock(&bank_mutex);
+    bank = bank_find(hash, (const uint8_t *)patches);
+    if (bank) {
+        bank->refcount++;
+        pthread_mutex_unlock(&bank_mutex);
+        return bank;
+    }
+    pthread_mutex_unlock(&bank_mutex);
+
+    bank = (hexter_bank_t *)calloc(1, sizeof(hexter_bank_t));
+    if (!bank)
+        return NULL;
+    bank->refcount = 1;
+    bank->hash = hash;
+    memcpy(bank->patches, patches, BANK_SIZE);
+
+    /* another thread may have added the same bank meanwhile */
+    pthread_mutex_lock(&bank_mutex);
+    bank = bank_merge(bank);
+    pthread_mutex_unlock(&bank_mutex);
+    return bank;
+}
+
+/*
+ * hexter_bank_builtin
+ *
+ * return a reference to the bank of built-in patches, or NULL if out of
+ * memory
+ */
+hexter_bank_t *
+hexter_bank_builtin(void)
+{
+    hexter_bank_t *bank;
+
+    pthread_mutex_lock(&bank_mutex);
+    if (bank_builtin) {
+        bank_builtin->refcount++;
+        pthread_mutex_unlock(&bank_mutex);
+        return bank_builtin;
+    }
+    pthread_mutex_unlock(&bank_mutex);
+
+    bank = (hexter_bank_t *)calloc(1, sizeof(hexter_bank_t));
+    if (!bank)
+        return NULL;
+    bank->refcount = 1;
+    hexter_data_patches_init((dx7_patch_t *)bank->patches);
+    bank->hash = bank_hash(bank->patches, BANK_SIZE);
+
+    pthread_mutex_lock(&bank_mutex);
+    if (bank_builtin) {
+        free(bank);
+        bank = bank_builtin;
+        bank->refcount++;
+    } else {
+        bank = bank_merge(bank);
+        bank->refcount++;  /* the one kept here */
+        bank_builtin = bank;
+    }
+    pthread_mutex_unlock(&bank_mutex);
+    return bank;
+}
+
+/*
+ * hexter_bank_set_section
+ *
+ * Return a bank like 'bank', but with section 'section' replaced by the 32
+ * 'patches', which came from the configure() value identified by 'key' (or
+ * 0 if none).  The caller's reference to 'bank' is passed to the returned
+ * bank.  If the caller holds the only reference, 'bank' is changed in place
+ * (or freed, if another bank already has the new contents), so the caller
+ * must hold whatever lock keeps readers away from it.  Returns NULL, with
+ * 'bank' untouched, if out of memory.
+ */
+hexter_bank_t *
+hexter_bank_set_section(hexter_bank_t *bank, int section, uint64_t key,
+                        const dx7_patch_t *patches)
+{
+    hexter_bank_t *new_bank;
+
+    pthread_mutex_lock(&bank_mutex);
+
+    if (!memcmp(bank->patches + section * SECTION_SIZE, patches, SECTION_SIZE)) {
+        if (key)
+            bank->section_key[section] = key;
+        pthread_mutex_unlock(&bank_mutex);
+        return bank;
+    }
+
+    new_bank = bank_edit(bank);
+    if (!new_bank) {
+        pthread_mutex_unlock(&bank_mutex);
+        return NULL;
+    }
+    memcpy(new_bank->patches + section * SECTION_SIZE, patches, SECTION_SIZE);
+    new_bank->section_key[section] = key;
+    new_bank->hash = bank_hash(new_bank->patches, BANK_SIZE);
+    new_bank = bank_merge(new_bank);
+
+    pthread_mutex_unlock(&bank_mutex);
+    return new_bank;
+}
+
+/*
+ * hexter_bank_set_patches
+ *
+ * Like hexter_bank_set_section(), but replaces the 'count' patches numbered
+ * in 'numbers' with those in 'patches'.  Sections changed this way lose
+ * their keys.
+ */
+hexter_bank_t *
+hexter_bank_set_patches(hexter_bank_t *bank, int count, const uint8_t *numbers,
+                        const dx7_patch_t *patches)
+{
+    const uint8_t *data = (const uint8_t *)patches;
+    hexter_bank_t *new_bank;
+    int i;
+
+    pthread_mutex_lock(&bank_mutex);
+
+    for (i = 0; i < count; i++)
+        if (memcmp(bank->patches + numbers[i] * DX7_VOICE_SIZE_PACKED,
+                   data + i * DX7_VOICE_SIZE_PACKED, DX7_VOICE_SIZE_PACKED))
+            break;
+    if (i == count) {  /* no change */
+        pthread_mutex_unlock(&bank_mutex);
+        return bank;
+    }
+
+    new_bank = bank_edit(bank);
+    if (!new_bank) {
+        pthread_mutex_unlock(&bank_mutex);
+        return NULL;
+    }
+    for (i = 0; i < count; i++) {
+        memcpy(new_bank->patches + numbers[i] * DX7_VOICE_SIZE_PACKED,
+               data + i * DX7_VOICE_SIZE_PACKED, DX7_VOICE_SIZE_PACKED);
+        new_bank->section_key[numbers[i] / 32] = 0;
+    }
+    new_bank->hash = bank_hash(new_bank->patches, BANK_SIZE);
+    new_bank = bank_merge(new_bank);
+
+    pthread_mutex_unlock(&bank_mutex);
+    return new_bank;
+}
+
+/*
+ * hexter_bank_release
+ *
+ * drop a reference to a bank, freeing it when none remain
+ */
+void
+hexter_bank_release(hexter_bank_t *bank)
+{
+    if (!bank)
+        return;
+
+    pthread_mutex_lock(&bank_mutex);
+    if (--bank->refcount == 0)
+        bank_unlink(bank);
+    else
+        bank = NULL;
+    pthread_mutex_unlock(&bank_mutex);
+
+    free(bank);
+}
+
+/*
+ * hexter_bank_patches
+ *
+ * return the bank's 128 patches, which must not be written to
+ */
+dx7_patch_t *
+hexter_bank_patches(hexter_bank_t *bank)
+{
+    return (dx7_patch_t *)bank->patches;
+}
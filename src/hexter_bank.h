@@ -0,0 +1,55 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_BANK_H
+#define _HEXTER_BANK_H
+
+#include <stdint.h>
+
+#include "hexter_types.h"
+
+/* Shared patch banks: an instance's 128 patches live in a reference-counted
+ * bank, and all banks with the same contents are one object, shared by
+ * every instance in the process that uses them.  A bank is treated as
+ * immutable once it is shared; changing one section of a shared bank
+ * copies it first, while a bank held only by the instance changing it is
+ * changed in place.
+ *
+ * Each bank also remembers, for each 32-patch section, a key (the hash of
+ * the 'patchesN' configure() value it was decoded from), so that a section
+ * sent again, to this instance or any other, is found without decoding. */
+
+/* hexter_bank.c */
+uint64_t       hexter_bank_key(const char *value);
+int            hexter_bank_has_section(hexter_bank_t *bank, int section,
+                                       uint64_t key);
+int            hexter_bank_find_section(uint64_t key, dx7_patch_t *patches);
+hexter_bank_t *hexter_bank_get(const dx7_patch_t *patches);
+hexter_bank_t *hexter_bank_builtin(void);
+hexter_bank_t *hexter_bank_set_section(hexter_bank_t *bank, int section,
+                                       uint64_t key,
+                                       const dx7_patch_t *patches);
+hexter_bank_t *hexter_bank_set_patches(hexter_bank_t *bank, int count,
+                                       const uint8_t *numbers,
+                                       const dx7_patch_t *patches);
+void           hexter_bank_release(hexter_bank_t *bank);
+dx7_patch_t   *hexter_bank_patches(hexter_bank_t *bank);
+
+#endif /* _HEXTER_BANK_H */
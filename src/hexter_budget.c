@@ -0,0 +1,188 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "hexter_budget.h"
+
+typedef struct _budget_slot_t
+{
+    int             used;              /* claimed by an instance */
+    uint64_t        weakest;           /* priority of its weakest voice, lowest first to go */
+    int             debt;              /* voices other instances have charged it */
+} budget_slot_t;
+
+/* joining and leaving are serialized by budget_mutex; all else is atomic */
+static pthread_mutex_t budget_mutex = PTHREAD_MUTEX_INITIALIZER;
+static budget_slot_t   budget_slot[HEXTER_BUDGET_SLOTS];
+static int             budget_limit = 0;    /* voices allowed, across all slots */
+static int             budget_voices = 0;   /* voices playing, across all slots */
+static uint32_t        budget_clock = 0;    /* note-ons, across all slots */
+
+/*
+ * hexter_budget_join
+ *
+ * claim a slot for an instance with 'voices' voices playing, returning the
+ * slot, or -1 if all are taken
+ */
+int
+hexter_budget_join(int voices)
+{
+    int slot;
+
+    pthread_mutex_lock(&budget_mutex);
+    for (slot = 0; slot < HEXTER_BUDGET_SLOTS; slot++)
+        if (!budget_slot[slot].used)
+            break;
+    if (slot < HEXTER_BUDGET_SLOTS) {
+        __atomic_store_n(&budget_slot[slot].weakest, HEXTER_BUDGET_NONE, __ATOMIC_RELAXED);
+        __atomic_store_n(&budget_slot[slot].debt, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&budget_slot[slot].used, 1, __ATOMIC_RELEASE);
+        __atomic_add_fetch(&budget_voices, voices, __ATOMIC_RELAXED);
+    } else
+        slot = -1;
+    pthread_mutex_unlock(&budget_mutex);
+
+    return slot;
+}
+
+/*
+ * hexter_budget_leave
+ *
+ * give up a slot, along with the 'voices' voices its instance has playing
+ */
+void
+hexter_budget_leave(int slot, int voices)
+{
+    pthread_mutex_lock(&budget_mutex);
+    __atomic_store_n(&budget_slot[slot].used, 0, __ATOMIC_RELEASE);
+    __atomic_sub_fetch(&budget_voices, voices, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&budget_mutex);
+}
+
+/*
+ * hexter_budget_set_limit
+ */
+void
+hexter_budget_set_limit(int limit)
+{
+    __atomic_store_n(&budget_limit, limit, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_full
+ *
+ * true if another voice would take the instances in the budget over it
+ */
+int
+hexter_budget_full(void)
+{
+    return __atomic_load_n(&budget_voices, __ATOMIC_RELAXED) >=
+               __atomic_load_n(&budget_limit, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_count
+ *
+ * add to (or subtract from) the voices playing
+ */
+void
+hexter_budget_count(int change)
+{
+    __atomic_add_fetch(&budget_voices, change, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_stamp
+ *
+ * return the next note-on's place in the order of all of them, by which
+ * the oldest of otherwise equal voices is found
+ */
+uint32_t
+hexter_budget_stamp(void)
+{
+    return __atomic_fetch_add(&budget_clock, 1, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_publish
+ *
+ * publish the priority of the weakest voice of the instance in 'slot'
+ */
+void
+hexter_budget_publish(int slot, uint64_t weakest)
+{
+    __atomic_store_n(&budget_slot[slot].weakest, weakest, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_find_weaker
+ *
+ * return the slot, other than 'slot', whose instance has the weakest voice
+ * of all, if it is weaker than 'weakest', or else -1
+ */
+int
+hexter_budget_find_weaker(int slot, uint64_t weakest)
+{
+    uint64_t priority;
+    int i, found = -1;
+
+    for (i = 0; i < HEXTER_BUDGET_SLOTS; i++) {
+        if (i == slot || !__atomic_load_n(&budget_slot[i].used, __ATOMIC_ACQUIRE))
+            continue;
+        priority = __atomic_load_n(&budget_slot[i].weakest, __ATOMIC_RELAXED);
+        if (priority < weakest) {
+            weakest = priority;
+            found = i;
+        }
+    }
+    return found;
+}
+
+/*
+ * hexter_budget_charge
+ *
+ * ask the instance in 'slot' to give up its weakest voice
+ */
+void
+hexter_budget_charge(int slot)
+{
+    __atomic_add_fetch(&budget_slot[slot].debt, 1, __ATOMIC_RELAXED);
+    /* it is no longer the weakest until it publishes again */
+    __atomic_store_n(&budget_slot[slot].weakest, HEXTER_BUDGET_NONE, __ATOMIC_RELAXED);
+}
+
+/*
+ * hexter_budget_collect
+ *
+ * return the number of voices the instance in 'slot' has been charged
+ * since it last collected
+ */
+int
+hexter_budget_collect(int slot)
+{
+    return __atomic_exchange_n(&budget_slot[slot].debt, 0, __ATOMIC_RELAXED);
+}
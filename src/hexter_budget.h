@@ -0,0 +1,52 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+
+#ifndef _HEXTER_BUDGET_H
+#define _HEXTER_BUDGET_H
+
+#include <stdint.h>
+
+/* The global voice budget: instances that join it ('configure
+ * global_polyphony <n>') keep the number of voices playing across all of
+ * them, in the whole process, within one limit, however the host spreads
+ * notes among them.  It takes no locks on the audio threads: the count of
+ * voices playing is kept with atomic operations, and each instance
+ * publishes, at the end of each run, the priority of its weakest voice.
+ * An instance that needs a voice with the budget spent steals its own
+ * weakest, if that is the weakest anywhere, or else charges the instance
+ * that has it, which gives the voice up at the end of its next run. */
+
+#define HEXTER_BUDGET_SLOTS  64         /* instances that may join */
+#define HEXTER_BUDGET_NONE   UINT64_MAX /* published by an instance with no voices */
+
+/* hexter_budget.c */
+int      hexter_budget_join(int voices);
+void     hexter_budget_leave(int slot, int voices);
+void     hexter_budget_set_limit(int limit);
+int      hexter_budget_full(void);
+void     hexter_budget_count(int change);
+uint32_t hexter_budget_stamp(void);
+void     hexter_budget_publish(int slot, uint64_t weakest);
+int      hexter_budget_find_weaker(int slot, uint64_t weakest);
+void     hexter_budget_charge(int slot);
+int      hexter_budget_collect(int slot);
+
+#endif /* _HEXTER_BUDGET_H */
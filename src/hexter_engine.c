@@ -0,0 +1,419 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "dx7_voice.h"
+#include "dx7_voice_data.h"
+#include "hexter_engine.h"
+
+struct _hexter_engine_t
+{
+    hexter_instance_t *instance;
+    float           tuning;            /* what the plugin reads from its ports */
+    float           volume;
+    int             offline;           /* render and select programs blocking */
+};
+
+/*
+ * hexter_engine_new
+ *
+ * return a new engine, playing the built-in patches, or NULL if out of
+ * memory
+ */
+hexter_engine_t *
+hexter_engine_new(unsigned long sample_rate)
+{
+    hexter_engine_t *engine;
+
+    engine = (hexter_engine_t *)calloc(1, sizeof(hexter_engine_t));
+    if (!engine)
+        return NULL;
+    engine->instance = hexter_instance_new(sample_rate);
+    if (!engine->instance) {
+        free(engine);
+        return NULL;
+    }
+    engine->tuning = 440.0f;
+    engine->volume = 0.0f;
+    engine->instance->tuning = &engine->tuning;
+    engine->instance->volume = &engine->volume;
+    dx7_lfo_reset(engine->instance);  /* as the plugin's activate() does */
+
+    return engine;
+}
+
+/*
+ * hexter_engine_free
+ */
+void
+hexter_engine_free(hexter_engine_t *engine)
+{
+    if (engine) {
+        hexter_instance_free(engine->instance);
+        free(engine);
+    }
+}
+
+/*
+ * hexter_engine_set_sample_rate
+ *
+ * change the sample rate, silencing all voices
+ */
+void
+hexter_engine_set_sample_rate(hexter_engine_t *engine, unsigned long sample_rate)
+{
+    hexter_instance_set_sample_rate(engine->instance, sample_rate);
+}
+
+/*
+ * hexter_engine_set_tuning
+ *
+ * set the tuning, in Hz for A-above-middle-C (default 440)
+ */
+void
+hexter_engine_set_tuning(hexter_engine_t *engine, float tuning)
+{
+    engine->tuning = tuning;
+}
+
+/*
+ * hexter_engine_set_volume
+ *
+ * set the output volume, in dB relative to the nominal level (default 0)
+ */
+void
+hexter_engine_set_volume(hexter_engine_t *engine, float volume)
+{
+    engine->volume = volume;
+}
+
+/*
+ * hexter_engine_set_offline
+ *
+ * When 'offline' is non-zero, hexter_engine_render() and
+ * hexter_engine_select_program() wait for any other thread using the
+ * engine, rather than rendering silence or deferring the change, so that
+ * no block is ever dropped.  For rendering faster than realtime, where
+ * nothing is lost by waiting.
+ */
+void
+hexter_engine_set_offline(hexter_engine_t *engine, int offline)
+{
+    engine->offline = offline;
+}
+
+/*
+ * hexter_engine_reset
+ *
+ * Stop all sounds immediately, as the plugin's activate() does, and also
+ * restart the control-rate nugget and return every voice to the state of
+ * a new one, forgetting free-running oscillator phases and the rest, so
+ * that the engine then renders exactly as a new one with the same
+ * settings would.
+ */
+void
+hexter_engine_reset(hexter_engine_t *engine)
+{
+    hexter_instance_t *instance = engine->instance;
+    int i;
+
+    dssp_voicelist_mutex_lock(instance);
+
+    hexter_instance_all_voices_off(instance);
+    instance->current_voices = 0;
+    instance->nugget_remains = 0;
+    hexter_resampler_reset(&instance->resampler);
+    dx7_lfo_reset(instance);
+    hexter_instance_reset_parts(instance);
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++)
+        instance->part[i]->last_key = 0;
+
+    for (i = 0; i < HEXTER_MAX_POLYPHONY; i++)
+        if (instance->voice[i]) {  /* as dx7_voice_new() leaves it */
+            memset(instance->voice[i], 0, sizeof(dx7_voice_t));
+            instance->voice[i]->status = DX7_VOICE_OFF;
+        }
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++)
+        if (instance->ghost[i]) {
+            memset(instance->ghost[i], 0, sizeof(dx7_voice_t));
+            instance->ghost[i]->status = DX7_VOICE_OFF;
+        }
+    instance->note_id = 0;
+    instance->last_key = 0;
+
+    dssp_voicelist_mutex_unlock(instance);
+}
+
+/*
+ * hexter_engine_handle_event
+ */
+static inline void
+hexter_engine_handle_event(hexter_instance_t *instance,
+                           const hexter_engine_event_t *event)
+{
+    unsigned char data1 = event->data1 & 0x7f,
+                  data2 = event->data2 & 0x7f;
+
+    /* while multitimbral, each channel goes to its own part */
+    instance = HEXTER_INSTANCE_PART(instance, event->status);
+
+    switch (event->status & 0xf0) {
+      case 0x80:  /* note off */
+        hexter_instance_note_off(instance, data1, data2);
+        break;
+      case 0x90:  /* note on */
+        if (data2 > 0)
+            hexter_instance_note_on(instance, data1, data2);
+        else
+            hexter_instance_note_off(instance, data1, 64);
+        break;
+      case 0xa0:  /* key pressure */
+        hexter_instance_key_pressure(instance, data1, data2);
+        break;
+      case 0xb0:  /* control change */
+        hexter_instance_control_change(instance, data1, data2);
+        break;
+      case 0xc0:  /* program change, for a part other than the engine's own */
+        if (instance != instance->pool)
+            hexter_instance_try_select_program(instance,
+                                               instance->cc[MIDI_CTL_MSB_BANK] * 128 +
+                                                   instance->cc[MIDI_CTL_LSB_BANK],
+                                               data1);
+        break;
+      case 0xd0:  /* channel pressure */
+        hexter_instance_channel_pressure(instance, data1);
+        break;
+      case 0xe0:  /* pitch bend */
+        hexter_instance_pitch_bend(instance, ((data2 << 7) | data1) - 8192);
+        break;
+      /* the engine's own program changes are made with
+       * hexter_engine_select_program() */
+      default:
+        break;
+    }
+}
+
+/*
+ * hexter_engine_render
+ *
+ * Render 'frames' frames into 'output', handling each of the events at its
+ * frame offset.  Events at or past the end of the block are ignored.
+ */
+void
+hexter_engine_render(hexter_engine_t *engine, float *output,
+                     unsigned long frames, const hexter_engine_event_t *events,
+                     unsigned long event_count)
+{
+    hexter_instance_t *instance = engine->instance;
+    unsigned long frames_done = 0;
+    unsigned long event_index = 0;
+    unsigned long burst_size;
+    struct timespec start, end;
+
+    memset(output, 0, sizeof(float) * frames);
+    instance->output = output;
+
+    if (engine->offline)
+        dssp_voicelist_mutex_lock(instance);
+    /* return only silence if the voices are being reconfigured */
+    else if (dssp_voicelist_mutex_trylock(instance))
+        return;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    if (instance->pending_program_change > -1 || HEXTER_INSTANCE_MULTITIMBRAL(instance))
+        hexter_instance_handle_pending_program_change(instance);
+
+    while (frames_done < frames) {
+
+        if (!instance->nugget_remains)
+            instance->nugget_remains = instance->nugget_frames;
+
+        /* process any ready events */
+        while (event_index < event_count
+               && events[event_index].frame <= frames_done) {
+            hexter_engine_handle_event(instance, &events[event_index]);
+            event_index++;
+        }
+
+        /* render up to the end of the nugget, the next event, or the
+         * block, whichever comes first, as hexter_run_synth() does */
+        burst_size = instance->nugget_frames;
+        if (instance->nugget_remains < burst_size)
+            burst_size = instance->nugget_remains;
+        if (event_index < event_count
+            && events[event_index].frame - frames_done < burst_size)
+            burst_size = events[event_index].frame - frames_done;
+        if (frames - frames_done < burst_size)
+            burst_size = frames - frames_done;
+
+        hexter_instance_render_voices(instance, frames_done, burst_size,
+                                      (burst_size == instance->nugget_remains));
+        frames_done += burst_size;
+        instance->nugget_remains -= burst_size;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    hexter_instance_update_load(instance, frames,
+                                (double)(end.tv_sec - start.tv_sec) +
+                                (double)(end.tv_nsec - start.tv_nsec) / 1000000000.0);
+
+    dssp_voicelist_mutex_unlock(instance);
+}
+
+/*
+ * hexter_engine_set_patches
+ *
+ * replace the 128 patches of bank 0 with the given packed DX7 voices,
+ * returning 0 if out of memory
+ */
+int
+hexter_engine_set_patches(hexter_engine_t *engine, const uint8_t *patches)
+{
+    return hexter_instance_set_patches(engine->instance,
+                                       (const dx7_patch_t *)patches);
+}
+
+/*
+ * hexter_engine_load_bank
+ *
+ * Load the patches of bank 0 from a patch bank file, of any format the
+ * plugin's GUI reads; patches past the end of a short file are left as
+ * they were.  Returns 0, with '*errmsg' set to a malloc'd message, if the
+ * file could not be loaded.
+ */
+int
+hexter_engine_load_bank(hexter_engine_t *engine, const char *filename,
+                        char **errmsg)
+{
+    hexter_instance_t *instance = engine->instance;
+    dx7_patch_t *patches;
+    int loaded;
+
+    patches = (dx7_patch_t *)malloc(128 * DX7_VOICE_SIZE_PACKED);
+    if (!patches) {
+        if (errmsg) *errmsg = strdup("out of memory");
+        return 0;
+    }
+    pthread_mutex_lock(&instance->patches_mutex);
+    memcpy(patches, instance->patches, 128 * DX7_VOICE_SIZE_PACKED);
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    loaded = dx7_patchbank_load(filename, patches, 128, errmsg);
+    if (loaded && !hexter_instance_set_patches(instance, patches)) {
+        if (errmsg) *errmsg = strdup("out of memory");
+        loaded = 0;
+    }
+
+    free(patches);
+    return loaded != 0;
+}
+
+/*
+ * hexter_engine_read_patches
+ *
+ * Read up to 'max_patches' packed DX7 voices from a patch bank file, of
+ * any format the plugin's GUI reads, into 'patches', without needing an
+ * engine.  Returns the number read, or 0, with '*errmsg' set to a
+ * malloc'd message, if there were none.
+ */
+unsigned long
+hexter_engine_read_patches(const char *filename, uint8_t *patches,
+                           unsigned long max_patches, char **errmsg)
+{
+    if (max_patches > INT_MAX)
+        max_patches = INT_MAX;
+
+    return dx7_patchbank_load(filename, (dx7_patch_t *)patches,
+                              (int)max_patches, errmsg);
+}
+
+/*
+ * hexter_engine_select_program
+ *
+ * Select program 'program' (0 to 127) of bank 'bank' (0, or a library
+ * bank).  Returns 0 if the patches were busy, in which case the change is
+ * made at the start of the next block; an offline engine waits for them
+ * instead.
+ */
+int
+hexter_engine_select_program(hexter_engine_t *engine, unsigned long bank,
+                             unsigned long program)
+{
+    hexter_instance_t *instance = engine->instance;
+
+    if (program >= 128)
+        return 1;  /* ignored, as by the plugin */
+
+    if (!engine->offline)
+        return hexter_instance_try_select_program(instance, bank, program);
+
+    pthread_mutex_lock(&instance->patches_mutex);
+    hexter_instance_select_program(instance, bank, program);
+    instance->pending_program_change = -1;
+    pthread_mutex_unlock(&instance->patches_mutex);
+    return 1;
+}
+
+/*
+ * hexter_engine_patch_name
+ *
+ * copy the name of a program to 'name', which must have room for 11
+ * characters, returning 0 if there is no such program
+ */
+int
+hexter_engine_patch_name(hexter_engine_t *engine, unsigned long bank,
+                         unsigned long program, char *name)
+{
+    hexter_instance_t *instance = engine->instance;
+    int found;
+
+    pthread_mutex_lock(&instance->patches_mutex);
+    found = hexter_instance_patch_name(instance, bank, program, name);
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    return found;
+}
+
+/*
+ * hexter_engine_configure
+ *
+ * Handle one of the plugin's configure() keys ('patches0' to 'patches3',
+ * 'edit_buffer', 'performance', 'polyphony', 'snapshot' and so on),
+ * returning NULL on success or else a malloc'd error message.
+ */
+char *
+hexter_engine_configure(hexter_engine_t *engine, const char *key,
+                        const char *value)
+{
+    return hexter_instance_configure(engine->instance, key, value);
+}
@@ -0,0 +1,88 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_ENGINE_H
+#define _HEXTER_ENGINE_H
+
+#include <stdint.h>
+
+/* The hexter synthesis engine, as built into libhexter-engine, for hosts
+ * that embed it directly rather than loading the DSSI plugin.  It depends
+ * on neither DSSI, LADSPA, ALSA nor liblo: events are raw MIDI channel
+ * messages with frame offsets, and output is rendered into the caller's
+ * buffer.
+ *
+ * An engine behaves exactly as a plugin instance does.  It renders on one
+ * thread; it may be configured, and have patches loaded or selected, from
+ * any other, and hexter_engine_render() then never blocks: a block
+ * rendered while another thread is reconfiguring the voices is left
+ * silent, and a program selected while the patches are busy takes effect
+ * at the next block.  An engine set offline waits instead, for rendering
+ * faster than realtime.
+ *
+ * After hexter_engine_configure(engine, "multitimbral", "on"), each MIDI
+ * channel plays a part of its own, from the engine's one pool of voices.
+ * hexter_engine_select_program() then selects channel 1's program, and
+ * program change events (with bank select controllers) the others'. */
+
+typedef struct _hexter_engine_t hexter_engine_t;
+
+/*
+ * hexter_engine_event_t
+ *
+ * a MIDI channel message, to be handled 'frame' frames into a block
+ */
+typedef struct _hexter_engine_event_t
+{
+    uint32_t        frame;             /* events must be in frame order */
+    uint8_t         status;            /* MIDI status byte, channel ignored unless multitimbral */
+    uint8_t         data1;
+    uint8_t         data2;
+} hexter_engine_event_t;
+
+/* hexter_engine.c */
+hexter_engine_t *hexter_engine_new(unsigned long sample_rate);
+void  hexter_engine_free(hexter_engine_t *engine);
+void  hexter_engine_set_sample_rate(hexter_engine_t *engine,
+                                    unsigned long sample_rate);
+void  hexter_engine_set_tuning(hexter_engine_t *engine, float tuning);
+void  hexter_engine_set_volume(hexter_engine_t *engine, float volume);
+void  hexter_engine_set_offline(hexter_engine_t *engine, int offline);
+void  hexter_engine_reset(hexter_engine_t *engine);
+void  hexter_engine_render(hexter_engine_t *engine, float *output,
+                           unsigned long frames,
+                           const hexter_engine_event_t *events,
+                           unsigned long event_count);
+int   hexter_engine_set_patches(hexter_engine_t *engine,
+                                const uint8_t *patches);
+int   hexter_engine_load_bank(hexter_engine_t *engine, const char *filename,
+                              char **errmsg);
+unsigned long hexter_engine_read_patches(const char *filename,
+                                        uint8_t *patches,
+                                        unsigned long max_patches,
+                                        char **errmsg);
+int   hexter_engine_select_program(hexter_engine_t *engine,
+                                   unsigned long bank, unsigned long program);
+int   hexter_engine_patch_name(hexter_engine_t *engine, unsigned long bank,
+                               unsigned long program, char *name);
+char *hexter_engine_configure(hexter_engine_t *engine, const char *key,
+                              const char *value);
+
+#endif /* _HEXTER_ENGINE_H */
@@ -0,0 +1,225 @@
+/* hexter patch library indexer
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Scans directory trees for DX7 patch bank files, and writes every
+ * distinct patch found to a hexter patch library (see hexter_library.h),
+ * which the plugin can then use with 'configure library <file>' or
+ * HEXTER_LIBRARY_PATH.  Files and directories are visited in sorted order,
+ * so the same tree always gives the same bank numbering.
+ *
+ * usage: hexter_index [-v] <library file> <directory or bank file> ...
+ */
+
+#define _GNU_SOURCE 1
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "hexter_types.h"
+#include "dx7_voice.h"
+#include "dx7_voice_data.h"
+#include "hexter_library.h"
+
+#define READ_SIZE  65536
+
+static const char *bank_extensions[] = {
+    ".syx", ".dx7", ".mid", ".tx7", ".snd", ".bnk", ".dx2", NULL
+};
+
+static hexter_library_builder_t *builder;
+static dx7_patchbank_parser_t parser;
+static uint8_t *read_buffer;
+static int verbose = 0;
+static unsigned long files_scanned, files_loaded, patches_found;
+
+static int
+is_bank_file(const char *filename)
+{
+    const char *ext = strrchr(filename, '.');
+    int i;
+
+    if (!ext)
+        return 0;
+    for (i = 0; bank_extensions[i]; i++)
+        if (!strcasecmp(ext, bank_extensions[i]))
+            return 1;
+    return 0;
+}
+
+static int
+add_patches(void)
+{
+    dx7_patch_t patch;
+    int added = 0, rc;
+
+    while (dx7_patchbank_parser_pull(&parser, &patch)) {
+        patches_found++;
+        rc = hexter_library_builder_add(builder, &patch);
+        if (rc < 0) {
+            fprintf(stderr, "hexter_index: out of memory\n");
+            exit(1);
+        }
+        added += rc;
+    }
+    return added;
+}
+
+static void
+index_file(const char *filename, off_t length)
+{
+    FILE *fp;
+    size_t count, done;
+    unsigned long found = patches_found;
+    int added = 0;
+
+    files_scanned++;
+    if ((fp = fopen(filename, "rb")) == NULL) {
+        fprintf(stderr, "hexter_index: could not open '%s'\n", filename);
+        return;
+    }
+    /* parse the file as it is read, so no file is too large */
+    dx7_patchbank_parser_init(&parser, filename, (long)length);
+    while (!parser.complete &&
+           (count = fread(read_buffer, 1, READ_SIZE, fp)) > 0) {
+        for (done = 0; done < count; ) {
+            done += dx7_patchbank_parser_push(&parser, read_buffer + done, count - done);
+            added += add_patches();
+        }
+    }
+    if (ferror(fp))
+        fprintf(stderr, "hexter_index: error reading '%s'\n", filename);
+    fclose(fp);
+    dx7_patchbank_parser_finish(&parser);
+    added += add_patches();
+
+    if (patches_found == found) {
+        if (verbose)
+            fprintf(stderr, "hexter_index: skipping '%s': no patches found\n", filename);
+        return;
+    }
+    files_loaded++;
+    if (added)
+        hexter_library_builder_add_source(builder);
+    if (verbose)
+        printf("%s: %lu patches, %d new\n", filename, patches_found - found, added);
+}
+
+static void
+index_tree(const char *path)
+{
+    struct dirent **entries;
+    struct stat st;
+    int count, i;
+
+    if (stat(path, &st) < 0) {
+        fprintf(stderr, "hexter_index: could not stat '%s'\n", path);
+        return;
+    }
+    if (S_ISREG(st.st_mode)) {
+        index_file(path, st.st_size);
+        return;
+    }
+    if (!S_ISDIR(st.st_mode))
+        return;
+
+    if ((count = scandir(path, &entries, NULL, alphasort)) < 0) {
+        fprintf(stderr, "hexter_index: could not read directory '%s'\n", path);
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        const char *name = entries[i]->d_name;
+        char *child;
+
+        if (name[0] == '.') {  /* '.', '..', and hidden files */
+            free(entries[i]);
+            continue;
+        }
+        child = (char *)malloc(strlen(path) + strlen(name) + 2);
+        if (!child) {
+            fprintf(stderr, "hexter_index: out of memory\n");
+            exit(1);
+        }
+        sprintf(child, "%s/%s", path, name);
+        if (stat(child, &st) == 0) {
+            if (S_ISDIR(st.st_mode))
+                index_tree(child);
+            else if (S_ISREG(st.st_mode) && is_bank_file(name))
+                index_file(child, st.st_size);
+        }
+        free(child);
+        free(entries[i]);
+    }
+    free(entries);
+}
+
+int
+main(int argc, char **argv)
+{
+    char *errmsg = NULL;
+    uint32_t count;
+    int c, i;
+
+    while ((c = getopt(argc, argv, "v")) != -1) {
+        switch (c) {
+          case 'v':
+            verbose = 1;
+            break;
+          default:
+            fprintf(stderr, "usage: %s [-v] <library file> <directory or bank file> ...\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (argc - optind < 2) {
+        fprintf(stderr, "usage: %s [-v] <library file> <directory or bank file> ...\n", argv[0]);
+        exit(1);
+    }
+
+    builder = hexter_library_builder_new();
+    read_buffer = (uint8_t *)malloc(READ_SIZE);
+    if (!builder || !read_buffer) {
+        fprintf(stderr, "hexter_index: out of memory\n");
+        exit(1);
+    }
+
+    for (i = optind + 1; i < argc; i++)
+        index_tree(argv[i]);
+
+    count = hexter_library_builder_count(builder);
+    if (!hexter_library_builder_write(builder, argv[optind], &errmsg)) {
+        fprintf(stderr, "hexter_index: %s\n", errmsg);
+        exit(1);
+    }
+    printf("%s: %lu files scanned, %lu loaded, %lu patches, %u unique, %u banks\n",
+           argv[optind], files_scanned, files_loaded, patches_found, count,
+           (count + 127) / 128);
+
+    hexter_library_builder_free(builder);
+    free(read_buffer);
+    return 0;
+}
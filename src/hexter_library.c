@@ -0,0 +1,478 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "hexter_types.h"
+#include "dx7_voice_data.h"
+#include "hexter_library.h"
+
+#define NAME_OFFSET  118  /* of the patch name within a packed patch */
+#define NAME_LENGTH  10
+
+struct _hexter_library_builder_t
+{
+    uint8_t        *patches;           /* count packed patches */
+    uint32_t        count;
+    uint32_t        allocated;
+    uint32_t        source_count;
+    uint32_t       *table;             /* open-addressed hash table of patch number + 1 */
+    uint32_t        table_size;        /* a power of two */
+};
+
+/*
+ * hexter_library_hash
+ *
+ * 64-bit FNV-1a hash of a packed patch
+ */
+uint64_t
+hexter_library_hash(const dx7_patch_t *patch)
+{
+    const uint8_t *data = (const uint8_t *)patch;
+    uint64_t hash = 14695981039346656037ULL;
+    int i;
+
+    for (i = 0; i < DX7_VOICE_SIZE_PACKED; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/*
+ * library_section_fits
+ *
+ * returns true if 'count' items of 'item_size' bytes at 'offset' lie
+ * within a file of 'file_size' bytes, without overflowing
+ */
+static int
+library_section_fits(uint64_t offset, uint64_t count, uint64_t item_size,
+                     uint64_t file_size)
+{
+    return offset <= file_size &&
+           count <= (file_size - offset) / item_size;
+}
+
+/*
+ * hexter_library_open
+ *
+ * map a library file into memory; on failure returns NULL and, if errmsg
+ * is not NULL, sets it to a malloc'd error message
+ */
+hexter_library_t *
+hexter_library_open(const char *filename, char **errmsg)
+{
+    hexter_library_t *library;
+    const hexter_library_header_t *header;
+    const hexter_library_entry_t *hash_index;
+    const uint32_t *name_index;
+    struct stat st;
+    void *map;
+    uint64_t count, i;
+    int fd, flags = MAP_SHARED;
+
+    if ((fd = open(filename, O_RDONLY)) < 0) {
+        if (errmsg) *errmsg = dssp_error_message("could not open library '%s': %s", filename, strerror(errno));
+        return NULL;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(hexter_library_header_t)) {
+        if (errmsg) *errmsg = dssp_error_message("'%s' is not a hexter patch library", filename);
+        close(fd);
+        return NULL;
+    }
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;  /* read it all in now, not on the audio thread */
+#endif
+    map = mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        if (errmsg) *errmsg = dssp_error_message("could not map library '%s': %s", filename, strerror(errno));
+        return NULL;
+    }
+    /* Program changes read patches from the map on the audio thread, so
+     * keep it resident if allowed, or at least ask for it to be read in.
+     * A library of even 100,000 patches is only 12MB. */
+    if (mlock(map, st.st_size) < 0)
+        madvise(map, st.st_size, MADV_WILLNEED);
+
+    header = (const hexter_library_header_t *)map;
+    count = header->patch_count;
+    if (memcmp(header->magic, HEXTER_LIBRARY_MAGIC, 8) ||
+        header->version != HEXTER_LIBRARY_VERSION ||
+        header->byte_order != HEXTER_LIBRARY_BYTE_ORDER ||
+        !library_section_fits(header->patches_offset, count,
+                              DX7_VOICE_SIZE_PACKED, st.st_size) ||
+        (header->hash_index_offset & 7) ||
+        !library_section_fits(header->hash_index_offset, count,
+                              sizeof(hexter_library_entry_t), st.st_size) ||
+        (header->name_index_offset & 3) ||
+        !library_section_fits(header->name_index_offset, count,
+                              sizeof(uint32_t), st.st_size))
+        goto damaged;
+
+    /* the indices' patch numbers are used unchecked by the lookups */
+    hash_index = (const hexter_library_entry_t *)((const char *)map + header->hash_index_offset);
+    name_index = (const uint32_t *)((const char *)map + header->name_index_offset);
+    for (i = 0; i < count; i++)
+        if (hash_index[i].patch >= count || name_index[i] >= count)
+            goto damaged;
+
+    if (!(library = (hexter_library_t *)malloc(sizeof(hexter_library_t)))) {
+        if (errmsg) *errmsg = strdup("out of memory");
+        munmap(map, st.st_size);
+        return NULL;
+    }
+    library->map = map;
+    library->map_size = st.st_size;
+    library->patch_count = header->patch_count;
+    library->patches = (const dx7_patch_t *)((const char *)map + header->patches_offset);
+    library->hash_index = hash_index;
+    library->name_index = name_index;
+
+    return library;
+
+  damaged:
+    if (errmsg) *errmsg = dssp_error_message("'%s' is not a hexter patch library, or is damaged", filename);
+    munmap(map, st.st_size);
+    return NULL;
+}
+
+/*
+ * hexter_library_close
+ */
+void
+hexter_library_close(hexter_library_t *library)
+{
+    if (library) {
+        munmap(library->map, library->map_size);
+        free(library);
+    }
+}
+
+/*
+ * hexter_library_find_hash
+ *
+ * returns the number of the patch with the given hash, or -1
+ */
+long
+hexter_library_find_hash(hexter_library_t *library, uint64_t hash)
+{
+    long low = 0, high = library->patch_count, mid;
+
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (library->hash_index[mid].hash < hash)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low < library->patch_count && library->hash_index[low].hash == hash)
+        return library->hash_index[low].patch;
+    return -1;
+}
+
+/*
+ * hexter_library_find_name
+ *
+ * returns the number of the first patch, in name order, whose name begins
+ * with the given string, or -1
+ */
+long
+hexter_library_find_name(hexter_library_t *library, const char *name)
+{
+    long low = 0, high = library->patch_count, mid;
+    size_t length = strlen(name);
+    const uint8_t *patch;
+
+    if (length > NAME_LENGTH)
+        length = NAME_LENGTH;
+    while (low < high) {
+        mid = (low + high) / 2;
+        patch = (const uint8_t *)hexter_library_patch(library, library->name_index[mid]);
+        if (memcmp(patch + NAME_OFFSET, name, length) < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low < library->patch_count) {
+        patch = (const uint8_t *)hexter_library_patch(library, library->name_index[low]);
+        if (!memcmp(patch + NAME_OFFSET, name, length))
+            return library->name_index[low];
+    }
+    return -1;
+}
+
+/* ==== library building, for hexter_index ==== */
+
+/*
+ * hexter_library_builder_new
+ */
+hexter_library_builder_t *
+hexter_library_builder_new(void)
+{
+    hexter_library_builder_t *builder;
+
+    builder = (hexter_library_builder_t *)calloc(1, sizeof(hexter_library_builder_t));
+    if (!builder)
+        return NULL;
+    builder->table_size = 4096;
+    builder->table = (uint32_t *)calloc(builder->table_size, sizeof(uint32_t));
+    if (!builder->table) {
+        free(builder);
+        return NULL;
+    }
+    return builder;
+}
+
+/*
+ * hexter_library_builder_free
+ */
+void
+hexter_library_builder_free(hexter_library_builder_t *builder)
+{
+    if (builder) {
+        free(builder->patches);
+        free(builder->table);
+        free(builder);
+    }
+}
+
+static inline uint8_t *
+builder_patch(hexter_library_builder_t *builder, uint32_t number)
+{
+    return builder->patches + (size_t)number * DX7_VOICE_SIZE_PACKED;
+}
+
+/* returns the table slot holding the patch, or the empty slot where it
+ * belongs */
+static uint32_t
+builder_lookup(hexter_library_builder_t *builder, const dx7_patch_t *patch,
+               uint64_t hash)
+{
+    uint32_t mask = builder->table_size - 1,
+             slot = (uint32_t)hash & mask;
+
+    while (builder->table[slot]) {
+        if (!memcmp(builder_patch(builder, builder->table[slot] - 1), patch,
+                    DX7_VOICE_SIZE_PACKED))
+            break;
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static int
+builder_grow_table(hexter_library_builder_t *builder)
+{
+    uint32_t *old_table = builder->table,
+              old_size = builder->table_size, i, slot;
+
+    builder->table_size *= 2;
+    builder->table = (uint32_t *)calloc(builder->table_size, sizeof(uint32_t));
+    if (!builder->table) {
+        builder->table = old_table;
+        builder->table_size = old_size;
+        return 0;
+    }
+    for (i = 0; i < old_size; i++) {
+        if (old_table[i]) {
+            const dx7_patch_t *patch = (const dx7_patch_t *)builder_patch(builder, old_table[i] - 1);
+
+            slot = builder_lookup(builder, patch, hexter_library_hash(patch));
+            builder->table[slot] = old_table[i];
+        }
+    }
+    free(old_table);
+    return 1;
+}
+
+/*
+ * hexter_library_builder_add
+ *
+ * add a patch unless an identical one is already present.  Returns 1 if
+ * it was added, 0 if it was a duplicate, or -1 if out of memory.
+ */
+int
+hexter_library_builder_add(hexter_library_builder_t *builder,
+                           const dx7_patch_t *patch)
+{
+    uint32_t slot;
+
+    slot = builder_lookup(builder, patch, hexter_library_hash(patch));
+    if (builder->table[slot])
+        return 0;
+
+    if (builder->count == builder->allocated) {
+        uint32_t allocated = builder->allocated ? builder->allocated * 2 : 4096;
+        uint8_t *patches = (uint8_t *)realloc(builder->patches,
+                                              (size_t)allocated * DX7_VOICE_SIZE_PACKED);
+        if (!patches)
+            return -1;
+        builder->patches = patches;
+        builder->allocated = allocated;
+    }
+    memcpy(builder_patch(builder, builder->count), patch, DX7_VOICE_SIZE_PACKED);
+    builder->table[slot] = ++builder->count;
+
+    if (builder->count * 2 > builder->table_size && !builder_grow_table(builder))
+        return -1;
+
+    return 1;
+}
+
+/*
+ * hexter_library_builder_add_source
+ *
+ * count a bank file as having contributed to the library
+ */
+void
+hexter_library_builder_add_source(hexter_library_builder_t *builder)
+{
+    builder->source_count++;
+}
+
+/*
+ * hexter_library_builder_count
+ */
+uint32_t
+hexter_library_builder_count(hexter_library_builder_t *builder)
+{
+    return builder->count;
+}
+
+/* qsort() has no context argument, so the name comparison gets the patches
+ * from here; building is not thread-safe */
+static hexter_library_builder_t *sorting_builder;
+
+static int
+compare_entries(const void *a, const void *b)
+{
+    const hexter_library_entry_t *ea = (const hexter_library_entry_t *)a,
+                                 *eb = (const hexter_library_entry_t *)b;
+
+    if (ea->hash != eb->hash)
+        return (ea->hash < eb->hash ? -1 : 1);
+    return (ea->patch < eb->patch ? -1 : ea->patch > eb->patch);
+}
+
+static int
+compare_names(const void *a, const void *b)
+{
+    uint32_t pa = *(const uint32_t *)a,
+             pb = *(const uint32_t *)b;
+    int rc;
+
+    rc = memcmp(builder_patch(sorting_builder, pa) + NAME_OFFSET,
+                builder_patch(sorting_builder, pb) + NAME_OFFSET, NAME_LENGTH);
+    if (rc)
+        return rc;
+    return (pa < pb ? -1 : pa > pb);
+}
+
+/*
+ * hexter_library_builder_write
+ *
+ * write the library to a temporary file, then rename it into place, so a
+ * plugin never maps a partly written library.  Returns 1 on success, or
+ * 0 and sets errmsg.
+ */
+int
+hexter_library_builder_write(hexter_library_builder_t *builder,
+                             const char *filename, char **errmsg)
+{
+    hexter_library_header_t header;
+    hexter_library_entry_t *entries;
+    uint32_t *names, i;
+    char *tmpname;
+    FILE *fp;
+    int ok;
+
+    entries = (hexter_library_entry_t *)malloc((builder->count + 1) * sizeof(hexter_library_entry_t));
+    names = (uint32_t *)malloc((builder->count + 1) * sizeof(uint32_t));
+    tmpname = (char *)malloc(strlen(filename) + 5);
+    if (!entries || !names || !tmpname) {
+        free(entries);
+        free(names);
+        free(tmpname);
+        *errmsg = strdup("out of memory");
+        return 0;
+    }
+
+    for (i = 0; i < builder->count; i++) {
+        entries[i].hash = hexter_library_hash((const dx7_patch_t *)builder_patch(builder, i));
+        entries[i].patch = i;
+        entries[i].reserved = 0;
+        names[i] = i;
+    }
+    qsort(entries, builder->count, sizeof(hexter_library_entry_t), compare_entries);
+    sorting_builder = builder;
+    qsort(names, builder->count, sizeof(uint32_t), compare_names);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HEXTER_LIBRARY_MAGIC, 8);
+    header.version = HEXTER_LIBRARY_VERSION;
+    header.byte_order = HEXTER_LIBRARY_BYTE_ORDER;
+    header.patch_count = builder->count;
+    header.source_count = builder->source_count;
+    header.patches_offset = sizeof(header);
+    header.hash_index_offset = header.patches_offset +
+                                   (uint64_t)builder->count * DX7_VOICE_SIZE_PACKED;
+    header.name_index_offset = header.hash_index_offset +
+                                   (uint64_t)builder->count * sizeof(hexter_library_entry_t);
+
+    sprintf(tmpname, "%s.tmp", filename);
+    if ((fp = fopen(tmpname, "wb")) == NULL) {
+        *errmsg = dssp_error_message("could not open '%s' for writing: %s", tmpname, strerror(errno));
+        free(entries);
+        free(names);
+        free(tmpname);
+        return 0;
+    }
+    ok = (fwrite(&header, sizeof(header), 1, fp) == 1 &&
+          fwrite(builder->patches, DX7_VOICE_SIZE_PACKED, builder->count, fp) == builder->count &&
+          fwrite(entries, sizeof(hexter_library_entry_t), builder->count, fp) == builder->count &&
+          fwrite(names, sizeof(uint32_t), builder->count, fp) == builder->count);
+    if (fclose(fp))
+        ok = 0;
+    if (ok && rename(tmpname, filename)) {
+        *errmsg = dssp_error_message("could not rename '%s' to '%s': %s", tmpname, filename, strerror(errno));
+        unlink(tmpname);
+        ok = 0;
+    } else if (!ok) {
+        *errmsg = dssp_error_message("error writing '%s': %s", tmpname, strerror(errno));
+        unlink(tmpname);
+    }
+
+    free(entries);
+    free(names);
+    free(tmpname);
+    return ok;
+}
@@ -0,0 +1,111 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_LIBRARY_H
+#define _HEXTER_LIBRARY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hexter_types.h"
+
+/* Patch library: a single file holding any number of deduplicated DX7
+ * patches, written by hexter_index from a tree of patch bank files, and
+ * memory-mapped read-only by the plugin.  Each run of 128 patches is one
+ * MIDI bank; library bank n is selected as DSSI bank n + 1, since bank 0
+ * remains the instance's own 128 patches.
+ *
+ * A library file is laid out as:
+ *   hexter_library_header_t
+ *   patch_count packed patches, in the order first found
+ *   patch_count hexter_library_entry_t, sorted by hash
+ *   patch_count uint32_t patch numbers, sorted by patch name
+ * with each section starting at the offset given in the header. */
+
+#define HEXTER_LIBRARY_MAGIC       "hexterPL"
+#define HEXTER_LIBRARY_VERSION     1
+#define HEXTER_LIBRARY_BYTE_ORDER  0x01020304
+
+typedef struct _hexter_library_header_t  hexter_library_header_t;
+typedef struct _hexter_library_entry_t   hexter_library_entry_t;
+typedef struct _hexter_library_builder_t hexter_library_builder_t;
+
+struct _hexter_library_header_t
+{
+    char            magic[8];
+    uint32_t        version;
+    uint32_t        byte_order;
+    uint32_t        patch_count;
+    uint32_t        source_count;      /* bank files the patches were found in */
+    uint64_t        patches_offset;
+    uint64_t        hash_index_offset;
+    uint64_t        name_index_offset;
+};
+
+struct _hexter_library_entry_t
+{
+    uint64_t        hash;              /* hexter_library_hash() of the packed patch */
+    uint32_t        patch;             /* patch number */
+    uint32_t        reserved;
+};
+
+struct _hexter_library_t
+{
+    void                         *map;
+    size_t                        map_size;
+    uint32_t                      patch_count;
+    const dx7_patch_t            *patches;
+    const hexter_library_entry_t *hash_index;
+    const uint32_t               *name_index;
+};
+
+/* hexter_library.c */
+uint64_t          hexter_library_hash(const dx7_patch_t *patch);
+hexter_library_t *hexter_library_open(const char *filename, char **errmsg);
+void              hexter_library_close(hexter_library_t *library);
+long              hexter_library_find_hash(hexter_library_t *library,
+                                           uint64_t hash);
+long              hexter_library_find_name(hexter_library_t *library,
+                                           const char *name);
+
+hexter_library_builder_t *hexter_library_builder_new(void);
+void     hexter_library_builder_free(hexter_library_builder_t *builder);
+int      hexter_library_builder_add(hexter_library_builder_t *builder,
+                                    const dx7_patch_t *patch);
+void     hexter_library_builder_add_source(hexter_library_builder_t *builder);
+uint32_t hexter_library_builder_count(hexter_library_builder_t *builder);
+int      hexter_library_builder_write(hexter_library_builder_t *builder,
+                                      const char *filename, char **errmsg);
+
+/*
+ * hexter_library_patch
+ *
+ * O(1) lookup of a library patch by number, or NULL if out of range
+ */
+static inline const dx7_patch_t *
+hexter_library_patch(hexter_library_t *library, unsigned long number)
+{
+    if (!library || number >= library->patch_count)
+        return NULL;
+    return (const dx7_patch_t *)((const uint8_t *)library->patches +
+                                 number * DX7_VOICE_SIZE_PACKED);
+}
+
+#endif /* _HEXTER_LIBRARY_H */
@@ -0,0 +1,276 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef HAVE_SYS_INOTIFY_H
+#include <errno.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_synth.h"
+#include "dx7_voice.h"
+#include "dx7_voice_data.h"
+#include "hexter_loader.h"
+#include "hexter_bank.h"
+
+struct _hexter_loader_t
+{
+    hexter_instance_t    *instance;
+    char                 *filename;
+    int                   load;        /* load the file once at start */
+    int                   watch;       /* reload it whenever it changes */
+    int                   stop_pipe[2];
+    pthread_t             thread;
+    dx7_patch_t          *patches;
+};
+
+/*
+ * hexter_loader_load
+ *
+ * load the bank file and publish it to the instance, unless the host has
+ * sent patches of its own
+ */
+static void
+hexter_loader_load(hexter_loader_t *loader)
+{
+    hexter_instance_t *instance = loader->instance;
+    hexter_bank_t *bank, *old_bank;
+    char *errmsg = NULL;
+    int count;
+
+    /* patches missing from a short file stay as the built-in ones */
+    hexter_data_patches_init(loader->patches);
+    count = dx7_patchbank_load(loader->filename, loader->patches, 128, &errmsg);
+    if (!count) {
+        DEBUG_MESSAGE(DB_DATA, " hexter_loader_load: could not load '%s': %s\n",
+                      loader->filename, errmsg);
+        free(errmsg);
+        return;
+    }
+
+    bank = hexter_bank_get(loader->patches);
+    if (!bank) {
+        DEBUG_MESSAGE(-1, " hexter_loader_load: out of memory!\n");
+        return;
+    }
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    if (instance->patches_configured) {
+        /* the host's patches take precedence over the default bank, both
+         * initially and on reloads, which the host would not hear of */
+        pthread_mutex_unlock(&instance->patches_mutex);
+        hexter_bank_release(bank);
+        DEBUG_MESSAGE(DB_DATA, " hexter_loader_load: host sent patches, ignoring '%s'\n",
+                      loader->filename);
+        return;
+    }
+
+    old_bank = instance->bank;
+    instance->bank = bank;
+    instance->patches = hexter_bank_patches(bank);
+    if (instance->current_bank == 0 &&
+        instance->current_program != instance->overlay_program)
+        dx7_patch_unpack(instance->patches, instance->current_program,
+                         instance->current_patch_buffer);
+    hexter_instance_update_parts(instance);
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    hexter_bank_release(old_bank);
+
+    DEBUG_MESSAGE(DB_DATA, " hexter_loader_load: loaded %d patches from '%s'\n",
+                  count, loader->filename);
+}
+
+#ifdef HAVE_SYS_INOTIFY_H
+/*
+ * hexter_loader_watch
+ *
+ * Watch the directory holding the bank file, since editors and librarians
+ * often replace a file rather than rewrite it, and reload the file each
+ * time it is closed after writing or moved into place.  Returns when
+ * hexter_loader_stop() writes to the stop pipe.
+ */
+static void
+hexter_loader_watch(hexter_loader_t *loader)
+{
+    char *path, *slash;
+    const char *directory, *name;
+    char events[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    struct pollfd fds[2];
+    ssize_t length;
+    int fd, changed;
+    char *p;
+
+    path = strdup(loader->filename);
+    if (!path)
+        return;
+    slash = strrchr(path, '/');
+    if (!slash) {
+        directory = ".";
+        name = path;
+    } else if (slash == path) {
+        directory = "/";
+        name = path + 1;
+    } else {
+        *slash = 0;
+        directory = path;
+        name = slash + 1;
+    }
+
+    fd = inotify_init();
+    if (fd < 0 || inotify_add_watch(fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        DEBUG_MESSAGE(DB_DATA, " hexter_loader_watch: could not watch '%s': %s\n",
+                      directory, strerror(errno));
+        if (fd >= 0)
+            close(fd);
+        free(path);
+        return;
+    }
+
+    fds[0].fd = fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = loader->stop_pipe[0];
+    fds[1].events = POLLIN;
+    for (;;) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (fds[1].revents)
+            break;
+        if (!(fds[0].revents & POLLIN))
+            continue;
+        length = read(fd, events, sizeof(events));
+        if (length <= 0)
+            continue;
+        changed = 0;
+        for (p = events; p < events + length; ) {
+            struct inotify_event *event = (struct inotify_event *)p;
+
+            if (event->len && !strcmp(event->name, name))
+                changed = 1;
+            p += sizeof(struct inotify_event) + event->len;
+        }
+        if (changed)
+            hexter_loader_load(loader);
+    }
+
+    close(fd);
+    free(path);
+}
+#endif /* HAVE_SYS_INOTIFY_H */
+
+static void *
+hexter_loader_thread(void *arg)
+{
+    hexter_loader_t *loader = (hexter_loader_t *)arg;
+
+    if (loader->load)
+        hexter_loader_load(loader);
+#ifdef HAVE_SYS_INOTIFY_H
+    if (loader->watch)
+        hexter_loader_watch(loader);
+#endif
+    return NULL;
+}
+
+/*
+ * hexter_loader_start
+ *
+ * Start loading 'filename' into the instance's patches (if 'load' is
+ * non-zero) and watching it for changes (if 'watch' is non-zero), and
+ * return the loader, or NULL if it could not be started.
+ */
+hexter_loader_t *
+hexter_loader_start(hexter_instance_t *instance, const char *filename,
+                    int load, int watch)
+{
+    hexter_loader_t *loader;
+
+#ifndef HAVE_SYS_INOTIFY_H
+    if (watch) {
+        DEBUG_MESSAGE(-1, " hexter_loader_start: bank file watching not supported on this system\n");
+        watch = 0;
+    }
+#endif
+    if (!load && !watch)
+        return NULL;
+
+    loader = (hexter_loader_t *)calloc(1, sizeof(hexter_loader_t));
+    if (!loader)
+        return NULL;
+    loader->instance = instance;
+    loader->load = load;
+    loader->watch = watch;
+    loader->filename = strdup(filename);
+    loader->patches = (dx7_patch_t *)malloc(128 * DX7_VOICE_SIZE_PACKED);
+    if (!loader->filename || !loader->patches || pipe(loader->stop_pipe)) {
+        free(loader->filename);
+        free(loader->patches);
+        free(loader);
+        return NULL;
+    }
+    if (pthread_create(&loader->thread, NULL, hexter_loader_thread, loader)) {
+        close(loader->stop_pipe[0]);
+        close(loader->stop_pipe[1]);
+        free(loader->filename);
+        free(loader->patches);
+        free(loader);
+        return NULL;
+    }
+
+    return loader;
+}
+
+/*
+ * hexter_loader_stop
+ *
+ * stop watching, wait for any load in progress to finish, and free the loader
+ */
+void
+hexter_loader_stop(hexter_loader_t *loader)
+{
+    if (!loader)
+        return;
+
+    if (write(loader->stop_pipe[1], "", 1) < 0)
+        DEBUG_MESSAGE(-1, " hexter_loader_stop: could not signal loader thread\n");
+    pthread_join(loader->thread, NULL);
+
+    close(loader->stop_pipe[0]);
+    close(loader->stop_pipe[1]);
+    free(loader->filename);
+    free(loader->patches);
+    free(loader);
+}
@@ -0,0 +1,41 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_LOADER_H
+#define _HEXTER_LOADER_H
+
+#include "hexter_types.h"
+
+/* Default bank loader: reads the bank file named by HEXTER_DEFAULT_BANK_PATH
+ * on a background thread, so instantiate() doesn't wait on the disk, and
+ * then swaps it in as the instance's patches under patches_mutex.  Until
+ * then the instance plays the built-in patches.  If the host has already
+ * sent patches of its own (e.g. restoring a project), the load is dropped.
+ * When asked to watch, and inotify is available, the loader then reloads
+ * the file each time it is rewritten or replaced, until the host sends
+ * patches. */
+
+/* hexter_loader.c */
+hexter_loader_t *hexter_loader_start(hexter_instance_t *instance,
+                                     const char *filename, int load,
+                                     int watch);
+void             hexter_loader_stop(hexter_loader_t *loader);
+
+#endif /* _HEXTER_LOADER_H */
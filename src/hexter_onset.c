@@ -0,0 +1,195 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hexter.h"
+#include "hexter_onset.h"
+
+#define HASH_PRIME1  UINT64_C(0x9e3779b185ebca87)
+#define HASH_PRIME2  UINT64_C(0xc2b2ae3d27d4eb4f)
+#define HASH_PRIME3  UINT64_C(0x165667b19e3779f9)
+#define HASH_ROTL(x, r)  (((x) << (r)) | ((x) >> (64 - (r))))
+
+/*
+ * hexter_onset_cache_new
+ *
+ * return a new, empty cache of 'entries' onsets, each of 'length'
+ * samples and the voice states, of 'state_size' bytes, to go with them,
+ * or NULL if out of memory
+ */
+hexter_onset_cache_t *
+hexter_onset_cache_new(int entries, unsigned long length, size_t state_size)
+{
+    hexter_onset_cache_t *cache;
+    int i;
+
+    cache = (hexter_onset_cache_t *)calloc(1, sizeof(hexter_onset_cache_t));
+    if (!cache)
+        return NULL;
+    cache->entries = entries;
+    /* a burst per nugget, and a few more for nuggets split by events */
+    cache->max_records = length / HEXTER_NUGGET_SIZE + 8;
+    cache->length = length;
+    cache->state_size = state_size;
+    cache->clock = 2;  /* so a new entry is not taken for one being recorded */
+    cache->entry = (hexter_onset_entry_t *)calloc(entries, sizeof(hexter_onset_entry_t));
+    if (!cache->entry)
+        goto out_of_memory;
+
+    for (i = 0; i < entries; i++) {
+        hexter_onset_entry_t *entry = &cache->entry[i];
+
+        entry->complete = 1;
+        entry->record = (hexter_onset_record_t *)malloc(cache->max_records *
+                                                        sizeof(hexter_onset_record_t));
+        entry->states = (unsigned char *)malloc(cache->max_records * state_size);
+        entry->samples = (float *)malloc(length * sizeof(float));
+        if (!entry->record || !entry->states || !entry->samples)
+            goto out_of_memory;
+    }
+    return cache;
+
+  out_of_memory:
+    hexter_onset_cache_free(cache);
+    return NULL;
+}
+
+/*
+ * hexter_onset_cache_free
+ */
+void
+hexter_onset_cache_free(hexter_onset_cache_t *cache)
+{
+    int i;
+
+    if (!cache)
+        return;
+    if (cache->entry) {
+        for (i = 0; i < cache->entries; i++) {
+            free(cache->entry[i].record);
+            free(cache->entry[i].states);
+            free(cache->entry[i].samples);
+        }
+        free(cache->entry);
+    }
+    free(cache);
+}
+
+/*
+ * hexter_onset_hash
+ *
+ * return 'hash' updated with 'size' bytes of 'data', a word at a time.
+ * This runs for each voice burst while the cache is on, so it only needs
+ * to be quick, and to tell apart states that differ at all.
+ */
+uint64_t
+hexter_onset_hash(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t word;
+
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), p += sizeof(uint64_t)) {
+        memcpy(&word, p, sizeof(uint64_t));
+        word *= HASH_PRIME2;
+        hash ^= HASH_ROTL(word, 31) * HASH_PRIME1;
+        hash = HASH_ROTL(hash, 27) * HASH_PRIME1 + HASH_PRIME3;
+    }
+    for (; size; size--, p++) {
+        hash ^= (uint64_t)*p * HASH_PRIME3;
+        hash = HASH_ROTL(hash, 11) * HASH_PRIME1;
+    }
+    return hash;
+}
+
+/*
+ * hexter_onset_recording
+ *
+ * return true if 'entry' is still being recorded: it is incomplete, and
+ * its voice recorded a burst within the last nugget (one that stopped
+ * short, e.g. by being stolen, leaves it incomplete)
+ */
+static inline int
+hexter_onset_recording(hexter_onset_cache_t *cache, hexter_onset_entry_t *entry)
+{
+    return !entry->complete && entry->stamp + 1 >= cache->clock;
+}
+
+/*
+ * hexter_onset_find
+ *
+ * return the entry whose first burst started from a voice state with
+ * 'hash', or NULL if there is none.  An entry still being recorded will
+ * do, since its voice is ahead of the one that would play it.
+ */
+hexter_onset_entry_t *
+hexter_onset_find(hexter_onset_cache_t *cache, uint64_t hash)
+{
+    hexter_onset_entry_t *entry, *found = NULL;
+    int i;
+
+    for (i = 0; i < cache->entries; i++) {
+        entry = &cache->entry[i];
+        if (entry->records && entry->record[0].hash == hash &&
+            (!found || entry->records > found->records))
+            found = entry;
+    }
+    if (found)
+        found->stamp = cache->clock;
+    return found;
+}
+
+/*
+ * hexter_onset_record
+ *
+ * return an emptied entry for a voice to record its onset into -- a free
+ * one, or else the least recently used -- or NULL if all are still being
+ * recorded
+ */
+hexter_onset_entry_t *
+hexter_onset_record(hexter_onset_cache_t *cache)
+{
+    hexter_onset_entry_t *entry, *oldest = NULL;
+    int i;
+
+    for (i = 0; i < cache->entries; i++) {
+        entry = &cache->entry[i];
+        if (hexter_onset_recording(cache, entry))
+            continue;
+        if (!entry->records) {
+            oldest = entry;
+            break;
+        }
+        if (!oldest || entry->stamp < oldest->stamp)
+            oldest = entry;
+    }
+    if (oldest) {
+        oldest->generation++;  /* voices still playing it go back to their operators */
+        oldest->stamp = cache->clock;
+        oldest->complete = 0;
+        oldest->records = 0;
+    }
+    return oldest;
+}
@@ -0,0 +1,92 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_ONSET_H
+#define _HEXTER_ONSET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hexter_types.h"
+
+/* The note-onset cache ('configure onset_cache <entries> <ms>'): sequenced
+ * parts play the same patch, key and velocity over and over, and with the
+ * oscillators keyed in sync, each note starts from the same voice state.
+ * The first time, the voice records its first <ms> milliseconds, burst by
+ * burst, into an entry: each burst's output, the hash of the voice state
+ * (and of the LFO state it reads) it started from, and the voice state it
+ * ended in.  A later note whose first burst starts from a state with the
+ * same hash plays the entry back, copying in each burst's output and end
+ * state, for as long as each burst starts from the state recorded.  Since
+ * that state includes everything the voice was set up from -- the patch,
+ * key, velocity, tuning and controllers -- the key of an entry is the
+ * voice state itself, and a note whose controllers move, or whose bursts
+ * are split differently, goes back to its operators from the exact state
+ * they would have reached.  The cache holds a fixed number of entries,
+ * and reuses the least recently used. */
+
+#define HEXTER_ONSET_MAX_ENTRIES  128
+#define HEXTER_ONSET_MAX_TIME     250   /* milliseconds */
+
+struct _hexter_onset_record_t   /* one burst of an onset */
+{
+    unsigned long   start;             /* samples into the note */
+    unsigned long   count;
+    uint64_t        hash;              /* of the state it started from, and its length */
+};
+
+struct _hexter_onset_entry_t
+{
+    unsigned int    generation;        /* changed each time the entry is recorded anew */
+    unsigned long   stamp;             /* cache clock when last recorded or played */
+    int             complete;          /* false while being recorded */
+    int             records;           /* bursts recorded */
+    hexter_onset_record_t *record;
+    unsigned char  *states;            /* voice state at the end of each burst */
+    float          *samples;           /* the onset's output, by sample into the note */
+};
+
+struct _hexter_onset_cache_t
+{
+    int             entries;
+    int             max_records;       /* per entry */
+    unsigned long   length;            /* samples per onset */
+    size_t          state_size;        /* bytes of voice state per record */
+    unsigned long   clock;             /* nuggets rendered */
+    hexter_onset_entry_t *entry;
+};
+
+/* hexter_onset.c */
+hexter_onset_cache_t *hexter_onset_cache_new(int entries, unsigned long length,
+                                             size_t state_size);
+void     hexter_onset_cache_free(hexter_onset_cache_t *cache);
+uint64_t hexter_onset_hash(uint64_t hash, const void *data, size_t size);
+hexter_onset_entry_t *hexter_onset_find(hexter_onset_cache_t *cache,
+                                        uint64_t hash);
+hexter_onset_entry_t *hexter_onset_record(hexter_onset_cache_t *cache);
+
+static inline unsigned char *
+hexter_onset_state(hexter_onset_cache_t *cache, hexter_onset_entry_t *entry,
+                   int record)
+{
+    return entry->states + (size_t)record * cache->state_size;
+}
+
+#endif /* _HEXTER_ONSET_H */
@@ -0,0 +1,494 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#define _GNU_SOURCE 1
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <ladspa.h>
+#include <alsa/seq_event.h>
+
+#include "hexter_types.h"
+#include "hexter.h"
+#include "hexter_record.h"
+
+#define HEXTER_RECORD_RING_SIZE       16384  /* records, must be a power of two */
+#define HEXTER_RECORD_WRITE_INTERVAL  20000  /* microseconds between writer thread passes */
+
+typedef struct _hexter_record_node_t hexter_record_node_t;
+
+/* control-thread records wait in a mutex-protected list */
+struct _hexter_record_node_t
+{
+    hexter_record_node_t *next;
+    hexter_record_t       record;
+    char                  payload[1];  /* record.length bytes */
+};
+
+struct _hexter_recorder_t
+{
+    FILE                 *fp;
+    struct timespec       start;
+    uint64_t              sequence;    /* next sequence number, atomic */
+
+    /* audio thread ring: single producer (audio thread), single consumer
+     * (writer thread) */
+    hexter_record_t      *ring;
+    unsigned int          ring_head;   /* written by producer only */
+    unsigned int          ring_tail;   /* written by consumer only */
+    uint64_t              lost;        /* records dropped on overflow, atomic */
+    uint64_t              lost_reported;
+
+    pthread_mutex_t       control_mutex;
+    hexter_record_node_t *control_head;
+    hexter_record_node_t *control_tail;
+
+    pthread_t             writer;
+    int                   quit;
+};
+
+static int hexter_recorder_serial = 0;
+
+/*
+ * hexter_record_timestamp
+ */
+static inline uint64_t
+hexter_record_timestamp(hexter_recorder_t *recorder)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - recorder->start.tv_sec) * 1000000000ULL +
+           (int64_t)(now.tv_nsec - recorder->start.tv_nsec);
+}
+
+/*
+ * hexter_record_hash
+ *
+ * FNV-1a hash of a buffer of output samples, used to check that a replay
+ * renders exactly what was heard during the recorded session.
+ */
+uint32_t
+hexter_record_hash(const LADSPA_Data *buffer, unsigned long count)
+{
+    const unsigned char *p = (const unsigned char *)buffer;
+    const unsigned char *end = p + count * sizeof(LADSPA_Data);
+    uint32_t hash = 2166136261U;
+
+    while (p < end) {
+        hash ^= *p++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * hexter_record_to_event
+ *
+ * Rebuild an ALSA sequencer event from an EVENT record.
+ */
+void
+hexter_record_to_event(hexter_record_t *record, snd_seq_event_t *event)
+{
+    memset(event, 0, sizeof(snd_seq_event_t));
+    event->type = record->u.event.type;
+    event->time.tick = record->u.event.tick;
+    switch (event->type) {
+      case SND_SEQ_EVENT_NOTEON:
+      case SND_SEQ_EVENT_NOTEOFF:
+      case SND_SEQ_EVENT_KEYPRESS:
+        event->data.note.channel  = record->u.event.channel;
+        event->data.note.note     = record->u.event.note;
+        event->data.note.velocity = record->u.event.velocity;
+        break;
+      default:
+        event->data.control.channel = record->u.event.channel;
+        event->data.control.param   = record->u.event.param;
+        event->data.control.value   = record->u.event.value;
+        break;
+    }
+}
+
+/* ---- control thread side ---- */
+
+/*
+ * hexter_record_queue
+ */
+static void
+hexter_record_queue(hexter_recorder_t *recorder, uint32_t type,
+                    hexter_record_t *record, const void *payload,
+                    size_t length)
+{
+    hexter_record_node_t *node;
+
+    node = (hexter_record_node_t *)malloc(sizeof(hexter_record_node_t) + length);
+    if (!node) {
+        __atomic_add_fetch(&recorder->lost, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    if (record)
+        node->record = *record;
+    else
+        memset(&node->record, 0, sizeof(hexter_record_t));
+    node->record.type = type;
+    node->record.length = length;
+    node->record.sequence = __atomic_fetch_add(&recorder->sequence, 1, __ATOMIC_RELAXED);
+    node->record.timestamp = hexter_record_timestamp(recorder);
+    if (length)
+        memcpy(node->payload, payload, length);
+    node->next = NULL;
+
+    pthread_mutex_lock(&recorder->control_mutex);
+    if (recorder->control_tail)
+        recorder->control_tail->next = node;
+    else
+        recorder->control_head = node;
+    recorder->control_tail = node;
+    pthread_mutex_unlock(&recorder->control_mutex);
+}
+
+/*
+ * hexter_record_patches
+ */
+void
+hexter_record_patches(hexter_recorder_t *recorder, dx7_patch_t *patches)
+{
+    hexter_record_queue(recorder, HEXTER_RECORD_PATCHES, NULL, patches,
+                        128 * DX7_VOICE_SIZE_PACKED);
+}
+
+/*
+ * hexter_record_control
+ */
+void
+hexter_record_control(hexter_recorder_t *recorder, uint32_t type)
+{
+    hexter_record_queue(recorder, type, NULL, NULL, 0);
+}
+
+/*
+ * hexter_record_configure
+ */
+void
+hexter_record_configure(hexter_recorder_t *recorder, const char *key,
+                        const char *value)
+{
+    size_t key_length = strlen(key) + 1,
+           value_length = strlen(value) + 1;
+    char *payload = (char *)malloc(key_length + value_length);
+
+    if (!payload) {
+        __atomic_add_fetch(&recorder->lost, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    memcpy(payload, key, key_length);
+    memcpy(payload + key_length, value, value_length);
+    hexter_record_queue(recorder, HEXTER_RECORD_CONFIGURE, NULL, payload,
+                        key_length + value_length);
+    free(payload);
+}
+
+/* ---- audio thread side ---- */
+
+/*
+ * hexter_record_ring_space, _slot, _commit
+ *
+ * The producer checks for space, fills slots beyond the current head, then
+ * publishes them all at once by advancing the head.  If there isn't room,
+ * the records are counted as lost rather than blocking the audio thread.
+ */
+static inline unsigned int
+hexter_record_ring_space(hexter_recorder_t *recorder)
+{
+    unsigned int tail = __atomic_load_n(&recorder->ring_tail, __ATOMIC_ACQUIRE);
+
+    return HEXTER_RECORD_RING_SIZE - (recorder->ring_head - tail);
+}
+
+static inline hexter_record_t *
+hexter_record_ring_slot(hexter_recorder_t *recorder, unsigned int i)
+{
+    return &recorder->ring[(recorder->ring_head + i) & (HEXTER_RECORD_RING_SIZE - 1)];
+}
+
+static inline void
+hexter_record_ring_commit(hexter_recorder_t *recorder, unsigned int count)
+{
+    __atomic_store_n(&recorder->ring_head, recorder->ring_head + count,
+                     __ATOMIC_RELEASE);
+}
+
+/*
+ * hexter_record_select_program
+ */
+void
+hexter_record_select_program(hexter_recorder_t *recorder, unsigned long bank,
+                             unsigned long program, uint32_t flags)
+{
+    hexter_record_t *record;
+
+    if (hexter_record_ring_space(recorder) < 1) {
+        __atomic_add_fetch(&recorder->lost, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    record = hexter_record_ring_slot(recorder, 0);
+    record->type = HEXTER_RECORD_SELECT_PROGRAM;
+    record->length = 0;
+    record->sequence = __atomic_fetch_add(&recorder->sequence, 1, __ATOMIC_RELAXED);
+    record->timestamp = hexter_record_timestamp(recorder);
+    record->u.program.bank = bank;
+    record->u.program.program = program;
+    record->u.program.flags = flags;
+    hexter_record_ring_commit(recorder, 1);
+}
+
+/*
+ * hexter_record_run
+ *
+ * Called at the end of run_synth(), once the output has been rendered.
+ */
+void
+hexter_record_run(hexter_recorder_t *recorder, unsigned long sample_count,
+                  snd_seq_event_t *events, unsigned long event_count,
+                  LADSPA_Data *output, float tuning, float volume,
+                  uint32_t flags)
+{
+    hexter_record_t *record;
+    uint64_t sequence, timestamp;
+    unsigned long i;
+
+    if (hexter_record_ring_space(recorder) < 1 + event_count) {
+        __atomic_add_fetch(&recorder->lost, 1 + event_count, __ATOMIC_RELAXED);
+        return;
+    }
+    /* reserve a block of sequence numbers so the events stay attached to
+     * their run record after sorting */
+    sequence = __atomic_fetch_add(&recorder->sequence, 1 + event_count, __ATOMIC_RELAXED);
+    timestamp = hexter_record_timestamp(recorder);
+
+    record = hexter_record_ring_slot(recorder, 0);
+    record->type = HEXTER_RECORD_RUN;
+    record->length = 0;
+    record->sequence = sequence;
+    record->timestamp = timestamp;
+    record->u.run.frames = sample_count;
+    record->u.run.event_count = event_count;
+    record->u.run.flags = flags;
+    record->u.run.output_hash = hexter_record_hash(output, sample_count);
+    record->u.run.tuning = tuning;
+    record->u.run.volume = volume;
+
+    for (i = 0; i < event_count; i++) {
+        snd_seq_event_t *event = &events[i];
+
+        record = hexter_record_ring_slot(recorder, 1 + i);
+        record->type = HEXTER_RECORD_EVENT;
+        record->length = 0;
+        record->sequence = sequence + 1 + i;
+        record->timestamp = timestamp;
+        record->u.event.tick = event->time.tick;
+        record->u.event.type = event->type;
+        switch (event->type) {
+          case SND_SEQ_EVENT_NOTEON:
+          case SND_SEQ_EVENT_NOTEOFF:
+          case SND_SEQ_EVENT_KEYPRESS:
+            record->u.event.channel  = event->data.note.channel;
+            record->u.event.note     = event->data.note.note;
+            record->u.event.velocity = event->data.note.velocity;
+            record->u.event.param = 0;
+            record->u.event.value = 0;
+            break;
+          default:
+            record->u.event.channel = event->data.control.channel;
+            record->u.event.note = 0;
+            record->u.event.velocity = 0;
+            record->u.event.param = event->data.control.param;
+            record->u.event.value = event->data.control.value;
+            break;
+        }
+    }
+    hexter_record_ring_commit(recorder, 1 + event_count);
+}
+
+/* ---- writer thread ---- */
+
+/*
+ * hexter_recorder_drain
+ */
+static void
+hexter_recorder_drain(hexter_recorder_t *recorder)
+{
+    hexter_record_node_t *node, *next;
+    unsigned int head, tail;
+    uint64_t lost;
+
+    /* control thread records */
+    pthread_mutex_lock(&recorder->control_mutex);
+    node = recorder->control_head;
+    recorder->control_head = recorder->control_tail = NULL;
+    pthread_mutex_unlock(&recorder->control_mutex);
+    while (node) {
+        next = node->next;
+        fwrite(&node->record, sizeof(hexter_record_t), 1, recorder->fp);
+        if (node->record.length)
+            fwrite(node->payload, 1, node->record.length, recorder->fp);
+        free(node);
+        node = next;
+    }
+
+    /* audio thread records */
+    head = __atomic_load_n(&recorder->ring_head, __ATOMIC_ACQUIRE);
+    tail = recorder->ring_tail;
+    while (tail != head) {
+        unsigned int start = tail & (HEXTER_RECORD_RING_SIZE - 1),
+                     count = head - tail;
+
+        if (count > HEXTER_RECORD_RING_SIZE - start)
+            count = HEXTER_RECORD_RING_SIZE - start;
+        fwrite(&recorder->ring[start], sizeof(hexter_record_t), count, recorder->fp);
+        tail += count;
+    }
+    __atomic_store_n(&recorder->ring_tail, tail, __ATOMIC_RELEASE);
+
+    /* note any overflow, so replay can warn that it may diverge */
+    lost = __atomic_load_n(&recorder->lost, __ATOMIC_RELAXED);
+    if (lost != recorder->lost_reported) {
+        hexter_record_t record;
+
+        memset(&record, 0, sizeof(hexter_record_t));
+        record.type = HEXTER_RECORD_LOST;
+        record.sequence = __atomic_fetch_add(&recorder->sequence, 1, __ATOMIC_RELAXED);
+        record.timestamp = hexter_record_timestamp(recorder);
+        record.u.lost.count = lost - recorder->lost_reported;
+        fwrite(&record, sizeof(hexter_record_t), 1, recorder->fp);
+        recorder->lost_reported = lost;
+    }
+
+    fflush(recorder->fp);
+}
+
+/*
+ * hexter_recorder_thread
+ */
+static void *
+hexter_recorder_thread(void *arg)
+{
+    hexter_recorder_t *recorder = (hexter_recorder_t *)arg;
+
+    while (!__atomic_load_n(&recorder->quit, __ATOMIC_ACQUIRE)) {
+        hexter_recorder_drain(recorder);
+        usleep(HEXTER_RECORD_WRITE_INTERVAL);
+    }
+    hexter_recorder_drain(recorder);
+    return NULL;
+}
+
+/*
+ * hexter_recorder_new
+ *
+ * Open a new session log and start its writer thread.  Returns NULL (and
+ * the instance simply runs without recording) on any failure.
+ */
+hexter_recorder_t *
+hexter_recorder_new(const char *path, unsigned long sample_rate)
+{
+    hexter_recorder_t *recorder;
+    hexter_record_header_t header;
+    hexter_record_t record;
+    char *filename;
+
+    recorder = (hexter_recorder_t *)calloc(1, sizeof(hexter_recorder_t));
+    if (!recorder)
+        return NULL;
+    recorder->ring = (hexter_record_t *)calloc(HEXTER_RECORD_RING_SIZE,
+                                               sizeof(hexter_record_t));
+    if (!recorder->ring) {
+        free(recorder);
+        return NULL;
+    }
+
+    if (asprintf(&filename, "%s-%d-%d.hxr", path, (int)getpid(),
+                 __atomic_fetch_add(&hexter_recorder_serial, 1, __ATOMIC_RELAXED)) < 0) {
+        free(recorder->ring);
+        free(recorder);
+        return NULL;
+    }
+    recorder->fp = fopen(filename, "wb");
+    if (!recorder->fp) {
+        DEBUG_MESSAGE(-1, " hexter_recorder_new: could not open '%s' for writing\n", filename);
+        free(filename);
+        free(recorder->ring);
+        free(recorder);
+        return NULL;
+    }
+    DEBUG_MESSAGE(DB_DSSI, " hexter_recorder_new: recording session to '%s'\n", filename);
+    free(filename);
+
+    memset(&header, 0, sizeof(hexter_record_header_t));
+    memcpy(header.magic, HEXTER_RECORD_MAGIC, 8);
+    header.version = HEXTER_RECORD_VERSION;
+    header.byte_order = HEXTER_RECORD_BYTE_ORDER;
+    header.record_size = sizeof(hexter_record_t);
+    strncpy(header.hexter_version, VERSION, sizeof(header.hexter_version) - 1);
+    fwrite(&header, sizeof(hexter_record_header_t), 1, recorder->fp);
+
+    clock_gettime(CLOCK_MONOTONIC, &recorder->start);
+    pthread_mutex_init(&recorder->control_mutex, NULL);
+
+    memset(&record, 0, sizeof(hexter_record_t));
+    record.u.instantiate.sample_rate = sample_rate;
+    hexter_record_queue(recorder, HEXTER_RECORD_INSTANTIATE, &record, NULL, 0);
+
+    if (pthread_create(&recorder->writer, NULL, hexter_recorder_thread, recorder)) {
+        hexter_recorder_drain(recorder);
+        fclose(recorder->fp);
+        pthread_mutex_destroy(&recorder->control_mutex);
+        free(recorder->ring);
+        free(recorder);
+        return NULL;
+    }
+
+    return recorder;
+}
+
+/*
+ * hexter_recorder_free
+ *
+ * Stop the writer thread, flushing any remaining records, and close the log.
+ */
+void
+hexter_recorder_free(hexter_recorder_t *recorder)
+{
+    __atomic_store_n(&recorder->quit, 1, __ATOMIC_RELEASE);
+    pthread_join(recorder->writer, NULL);
+    fclose(recorder->fp);
+    pthread_mutex_destroy(&recorder->control_mutex);
+    free(recorder->ring);
+    free(recorder);
+}
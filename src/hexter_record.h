@@ -0,0 +1,135 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_RECORD_H
+#define _HEXTER_RECORD_H
+
+#include <stdint.h>
+
+#include <ladspa.h>
+#include <alsa/seq_event.h>
+
+#include "hexter_types.h"
+
+/* Session recording: when the environment variable HEXTER_RECORD_PATH is
+ * set, each plugin instance logs everything the host does to it (run_synth
+ * frame counts and port values, MIDI events, configure() and
+ * select_program() calls) to a binary file named
+ * '$HEXTER_RECORD_PATH-<pid>-<n>.hxr'.  The audio thread only pushes
+ * fixed-size records into a lock-free ring; a background thread does the
+ * file writing.  fptest/replay feeds such a log back through the engine.
+ *
+ * A log is a hexter_record_header_t followed by hexter_record_t records,
+ * each followed by 'length' bytes of payload.  Records from the audio and
+ * control threads may be interleaved out of order in the file; readers
+ * must sort them by 'sequence' before use. */
+
+#define HEXTER_RECORD_MAGIC       "hexterRL"
+#define HEXTER_RECORD_VERSION     1
+#define HEXTER_RECORD_BYTE_ORDER  0x01020304
+
+/* record types */
+#define HEXTER_RECORD_INSTANTIATE     1  /* u.instantiate */
+#define HEXTER_RECORD_PATCHES         2  /* payload: 128 packed patches, as loaded at instantiation */
+#define HEXTER_RECORD_ACTIVATE        3
+#define HEXTER_RECORD_DEACTIVATE      4
+#define HEXTER_RECORD_CONFIGURE       5  /* payload: key, NUL, value, NUL */
+#define HEXTER_RECORD_SELECT_PROGRAM  6  /* u.program */
+#define HEXTER_RECORD_RUN             7  /* u.run, followed by u.run.event_count EVENT records */
+#define HEXTER_RECORD_EVENT           8  /* u.event */
+#define HEXTER_RECORD_LOST            9  /* u.lost: audio thread records dropped on ring overflow */
+
+/* run and select_program flags */
+#define HEXTER_RECORD_FLAG_VOICELIST_BUSY  1  /* voicelist mutex trylock failed */
+#define HEXTER_RECORD_FLAG_PATCHES_BUSY    2  /* patches mutex trylock failed */
+
+typedef struct _hexter_record_header_t hexter_record_header_t;
+typedef struct _hexter_record_t        hexter_record_t;
+
+struct _hexter_record_header_t
+{
+    char            magic[8];
+    uint32_t        version;
+    uint32_t        byte_order;
+    uint32_t        record_size;       /* sizeof(hexter_record_t) */
+    uint32_t        reserved;
+    char            hexter_version[32];
+};
+
+struct _hexter_record_t
+{
+    uint32_t        type;
+    uint32_t        length;            /* bytes of payload following this record */
+    uint64_t        sequence;          /* total order across all threads */
+    uint64_t        timestamp;         /* nanoseconds since recording began */
+    union {
+        struct {
+            uint32_t    sample_rate;
+        } instantiate;
+        struct {
+            uint32_t    bank;
+            uint32_t    program;
+            uint32_t    flags;
+        } program;
+        struct {
+            uint32_t    frames;
+            uint32_t    event_count;
+            uint32_t    flags;
+            uint32_t    output_hash;   /* hexter_record_hash() of the rendered output */
+            float       tuning;
+            float       volume;
+        } run;
+        struct {
+            uint32_t    tick;
+            uint8_t     type;
+            uint8_t     channel;
+            uint8_t     note;
+            uint8_t     velocity;
+            uint32_t    param;
+            int32_t     value;
+        } event;
+        struct {
+            uint64_t    count;
+        } lost;
+    } u;
+};
+
+/* hexter_record.c */
+hexter_recorder_t *hexter_recorder_new(const char *path,
+                                       unsigned long sample_rate);
+void     hexter_recorder_free(hexter_recorder_t *recorder);
+void     hexter_record_patches(hexter_recorder_t *recorder,
+                               dx7_patch_t *patches);
+void     hexter_record_control(hexter_recorder_t *recorder, uint32_t type);
+void     hexter_record_configure(hexter_recorder_t *recorder,
+                                 const char *key, const char *value);
+void     hexter_record_select_program(hexter_recorder_t *recorder,
+                                      unsigned long bank,
+                                      unsigned long program, uint32_t flags);
+void     hexter_record_run(hexter_recorder_t *recorder,
+                           unsigned long sample_count,
+                           snd_seq_event_t *events, unsigned long event_count,
+                           LADSPA_Data *output, float tuning, float volume,
+                           uint32_t flags);
+uint32_t hexter_record_hash(const LADSPA_Data *buffer, unsigned long count);
+void     hexter_record_to_event(hexter_record_t *record,
+                                snd_seq_event_t *event);
+
+#endif /* _HEXTER_RECORD_H */
@@ -0,0 +1,736 @@
+/* hexter offline MIDI file renderer
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+/* Renders a Standard MIDI File through libhexter-engine, as fast as the
+ * machine allows, to a mono 32-bit float WAV file, or to raw native-endian
+ * floats if the output file name ends in '.raw'.  Each MIDI channel used
+ * gets its own engine, playing the patches of the -b bank file (or the
+ * built-in patches); the channel's program changes and bank selects are
+ * followed, unless -p fixes its program.  The channels are rendered in
+ * parallel, a large block at a time, on -j threads (default: one per
+ * processor), then mixed, or with -s written to a stem file per channel,
+ * named for the output file plus '-chNN'.  The output is the same whatever
+ * the number of threads.
+ *
+ * usage: hexter_render [-b <bank file>] [-l <library>] [-p <channel>:<program>] ...
+ *                      [-r <sample rate>] [-P <polyphony>] [-j <threads>]
+ *                      [-t <tail seconds>] [-s] [-v] <MIDI file> <output file>
+ */
+
+#define _GNU_SOURCE 1
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "hexter_engine.h"
+
+#define RENDER_BLOCK  65536    /* frames rendered at a time, per channel */
+
+typedef struct _midi_event_t
+{
+    unsigned long   time;      /* in ticks, then in frames once timed */
+    unsigned long   order;     /* file order, to keep sorting stable */
+    unsigned long   tempo;     /* microseconds per quarter note, for tempo events */
+    uint8_t         status;    /* 0xff for tempo events */
+    uint8_t         data1;
+    uint8_t         data2;
+} midi_event_t;
+
+typedef struct _part_t
+{
+    int             channel;
+    hexter_engine_t *engine;
+    midi_event_t   *events;
+    unsigned long   event_count;
+    unsigned long   next_event;
+    hexter_engine_event_t *block_events;
+    float          *buffer;
+    int             fixed_program;  /* -1, or the program -p set */
+    unsigned long   bank_msb;
+    unsigned long   bank_lsb;
+    FILE           *stem;
+} part_t;
+
+static const char *bank_file = NULL;
+static const char *library_file = NULL;
+static unsigned long sample_rate = 44100;
+static int polyphony = 0;
+static int threads = 0;
+static double tail = 3.0;
+static int stems = 0;
+static int verbose = 0;
+static int fixed_programs[16];
+
+static midi_event_t *events;
+static unsigned long event_count, events_allocated;
+static unsigned int division;
+
+static part_t parts[16];
+static int part_count;
+
+/* the work queue: each block, every part is rendered by one worker */
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  work_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  work_done = PTHREAD_COND_INITIALIZER;
+static unsigned long   block_number;
+static unsigned long   block_start, block_frames;
+static int             next_part, parts_done;
+static int             quitting;
+
+static void
+usage(const char *program_name)
+{
+    fprintf(stderr, "usage: %s [-b <bank file>] [-l <library>] [-p <channel>:<program>] ...\n"
+                    "          [-r <sample rate>] [-P <polyphony>] [-j <threads>]\n"
+                    "          [-t <tail seconds>] [-s] [-v] <MIDI file> <output file>\n",
+            program_name);
+    exit(1);
+}
+
+static void
+out_of_memory(void)
+{
+    fprintf(stderr, "hexter_render: out of memory\n");
+    exit(1);
+}
+
+static double
+clock_seconds(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+/* ==== Standard MIDI File parsing ==== */
+
+static void
+add_event(unsigned long tick, uint8_t status, uint8_t data1, uint8_t data2,
+          unsigned long tempo)
+{
+    if (event_count == events_allocated) {
+        events_allocated = events_allocated ? events_allocated * 2 : 4096;
+        events = (midi_event_t *)realloc(events, events_allocated * sizeof(midi_event_t));
+        if (!events)
+            out_of_memory();
+    }
+    events[event_count].time = tick;
+    events[event_count].order = event_count;
+    events[event_count].tempo = tempo;
+    events[event_count].status = status;
+    events[event_count].data1 = data1;
+    events[event_count].data2 = data2;
+    event_count++;
+}
+
+/*
+ * read_varlen
+ *
+ * read a variable-length quantity, returning 0 if it runs past 'end'
+ */
+static int
+read_varlen(const uint8_t **p, const uint8_t *end, unsigned long *value)
+{
+    int i;
+
+    *value = 0;
+    for (i = 0; i < 4; i++) {
+        if (*p >= end)
+            return 0;
+        *value = (*value << 7) | (**p & 0x7f);
+        if (!(*(*p)++ & 0x80))
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * parse_track
+ *
+ * add the channel and tempo events of one MTrk chunk, returning 0 if it is
+ * malformed
+ */
+static int
+parse_track(const uint8_t *p, const uint8_t *end)
+{
+    unsigned long tick = 0, delta, length;
+    uint8_t status = 0, type, data1, data2;
+
+    while (p < end) {
+        if (!read_varlen(&p, end, &delta) || p >= end)
+            return 0;
+        tick += delta;
+
+        if (*p & 0x80)
+            status = *p++;
+        else if (!status)  /* running status with no status */
+            return 0;
+
+        if (status == 0xff) {  /* meta event */
+            if (p >= end)
+                return 0;
+            type = *p++;
+            if (!read_varlen(&p, end, &length) || length > (unsigned long)(end - p))
+                return 0;
+            if (type == 0x51 && length == 3)
+                add_event(tick, 0xff, 0, 0, (p[0] << 16) | (p[1] << 8) | p[2]);
+            else if (type == 0x2f)
+                return 1;
+            p += length;
+            status = 0;
+        } else if (status == 0xf0 || status == 0xf7) {  /* sys-ex, ignored */
+            if (!read_varlen(&p, end, &length) || length > (unsigned long)(end - p))
+                return 0;
+            p += length;
+            status = 0;
+        } else if (status >= 0xf0) {  /* not allowed in a file */
+            return 0;
+        } else {
+            if (p >= end)
+                return 0;
+            data1 = *p++ & 0x7f;
+            data2 = 0;
+            if ((status & 0xe0) != 0xc0) {  /* all but program change and channel pressure */
+                if (p >= end)
+                    return 0;
+                data2 = *p++ & 0x7f;
+            }
+            add_event(tick, status, data1, data2, 0);
+        }
+    }
+    return 1;
+}
+
+static int
+event_compare(const void *a, const void *b)
+{
+    const midi_event_t *ea = (const midi_event_t *)a,
+                       *eb = (const midi_event_t *)b;
+
+    if (ea->time != eb->time)
+        return ea->time < eb->time ? -1 : 1;
+    return ea->order < eb->order ? -1 : ea->order > eb->order;
+}
+
+/*
+ * load_midi_file
+ *
+ * read all the tracks' events into 'events', in time order, with their
+ * times in frames
+ */
+static void
+load_midi_file(const char *filename)
+{
+    FILE *fp;
+    struct stat st;
+    uint8_t *data;
+    const uint8_t *p, *end;
+    unsigned long length, i, tick, tempo;
+    unsigned int tracks, track;
+    double seconds, seconds_per_tick;
+
+    if (stat(filename, &st) < 0 || (fp = fopen(filename, "rb")) == NULL) {
+        fprintf(stderr, "hexter_render: could not open '%s'\n", filename);
+        exit(1);
+    }
+    data = (uint8_t *)malloc(st.st_size);
+    if (!data)
+        out_of_memory();
+    if (fread(data, 1, st.st_size, fp) != (size_t)st.st_size) {
+        fprintf(stderr, "hexter_render: error reading '%s'\n", filename);
+        exit(1);
+    }
+    fclose(fp);
+
+    p = data;
+    end = data + st.st_size;
+    if (st.st_size < 14 || memcmp(p, "MThd", 4) ||
+        (length = (p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7]) < 6) {
+        fprintf(stderr, "hexter_render: '%s' is not a standard MIDI file\n", filename);
+        exit(1);
+    }
+    tracks = (p[10] << 8) | p[11];
+    division = (p[12] << 8) | p[13];
+    if (division == 0) {
+        fprintf(stderr, "hexter_render: '%s' has an invalid time division\n", filename);
+        exit(1);
+    }
+    p += 8 + length;
+
+    for (track = 0; track < tracks && end - p >= 8; ) {
+        length = (p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7];
+        if (length > (unsigned long)(end - p - 8)) {
+            fprintf(stderr, "hexter_render: '%s' is truncated\n", filename);
+            exit(1);
+        }
+        if (!memcmp(p, "MTrk", 4)) {  /* other chunk types are skipped */
+            if (!parse_track(p + 8, p + 8 + length)) {
+                fprintf(stderr, "hexter_render: track %u of '%s' is malformed\n",
+                        track + 1, filename);
+                exit(1);
+            }
+            track++;
+        }
+        p += 8 + length;
+    }
+    free(data);
+
+    qsort(events, event_count, sizeof(midi_event_t), event_compare);
+
+    /* convert times to frames, following the tempo map */
+    if (division & 0x8000) {  /* SMPTE frames per second, and ticks per frame */
+        int fps = 256 - (division >> 8);
+
+        seconds_per_tick = 1.0 / ((fps == 29 ? 29.97 : (double)fps) * (division & 0xff));
+    } else
+        seconds_per_tick = 500000.0 / 1000000.0 / division;
+    seconds = 0.0;
+    tick = 0;
+    for (i = 0; i < event_count; i++) {
+        seconds += (double)(events[i].time - tick) * seconds_per_tick;
+        tick = events[i].time;
+        events[i].time = (unsigned long)(seconds * (double)sample_rate + 0.5);
+        if (events[i].status == 0xff && !(division & 0x8000)) {
+            tempo = events[i].tempo ? events[i].tempo : 1;
+            seconds_per_tick = (double)tempo / 1000000.0 / division;
+        }
+    }
+}
+
+/* ==== rendering ==== */
+
+static FILE *
+open_output(const char *filename, int wav)
+{
+    FILE *fp = fopen(filename, "wb");
+
+    if (!fp) {
+        fprintf(stderr, "hexter_render: could not create '%s'\n", filename);
+        exit(1);
+    }
+    if (wav) {  /* room for the header, written once the length is known */
+        static const uint8_t zeros[58];
+        fwrite(zeros, 1, sizeof(zeros), fp);
+    }
+    return fp;
+}
+
+static void
+put_le32(uint8_t *p, uint32_t value)
+{
+    p[0] = value & 0xff;
+    p[1] = (value >> 8) & 0xff;
+    p[2] = (value >> 16) & 0xff;
+    p[3] = value >> 24;
+}
+
+static void
+write_samples(FILE *fp, const float *samples, unsigned long count, int wav)
+{
+    static uint8_t bytes[RENDER_BLOCK * 4];
+    unsigned long i;
+    uint32_t bits;
+
+    if (!wav) {
+        fwrite(samples, sizeof(float), count, fp);
+        return;
+    }
+    for (i = 0; i < count; i++) {  /* WAV data is little-endian */
+        memcpy(&bits, &samples[i], 4);
+        put_le32(bytes + i * 4, bits);
+    }
+    fwrite(bytes, 4, count, fp);
+}
+
+/*
+ * close_output
+ *
+ * write a WAVE_FORMAT_IEEE_FLOAT header for 'frames' mono frames, and close
+ */
+static void
+close_output(FILE *fp, const char *filename, unsigned long frames, int wav)
+{
+    uint8_t header[58];
+
+    if (wav) {
+        memcpy(header, "RIFF", 4);
+        put_le32(header + 4, 50 + frames * 4);
+        memcpy(header + 8, "WAVEfmt ", 8);
+        put_le32(header + 16, 18);
+        put_le32(header + 20, 3 | (1 << 16));        /* format 3, 1 channel */
+        put_le32(header + 24, sample_rate);
+        put_le32(header + 28, sample_rate * 4);      /* bytes per second */
+        put_le32(header + 32, 4 | (32 << 16));       /* block align, bits */
+        header[36] = header[37] = 0;                 /* no extension */
+        memcpy(header + 38, "fact", 4);
+        put_le32(header + 42, 4);
+        put_le32(header + 46, frames);
+        memcpy(header + 50, "data", 4);
+        put_le32(header + 54, frames * 4);
+        fseek(fp, 0, SEEK_SET);
+        fwrite(header, 1, sizeof(header), fp);
+    }
+    if (ferror(fp) | fclose(fp)) {
+        fprintf(stderr, "hexter_render: error writing '%s'\n", filename);
+        exit(1);
+    }
+}
+
+static char *
+stem_filename(const char *output, int channel)
+{
+    const char *ext = strrchr(output, '.');
+    char *name;
+    int base;
+
+    if (!ext || strchr(ext, '/'))
+        ext = output + strlen(output);
+    base = ext - output;
+    name = (char *)malloc(strlen(output) + 6);
+    if (!name)
+        out_of_memory();
+    sprintf(name, "%.*s-ch%02d%s", base, output, channel + 1, ext);
+    return name;
+}
+
+/*
+ * setup_parts
+ *
+ * give each channel with events its own engine and events
+ */
+static void
+setup_parts(void)
+{
+    unsigned long i, count[16];
+    part_t *part;
+    char buffer[16], *errmsg;
+    int channel;
+
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < event_count; i++)
+        if (events[i].status < 0xf0)
+            count[events[i].status & 0x0f]++;
+
+    for (channel = 0; channel < 16; channel++) {
+        if (!count[channel])
+            continue;
+        part = &parts[part_count++];
+        part->channel = channel;
+        part->events = (midi_event_t *)malloc(count[channel] * sizeof(midi_event_t));
+        part->block_events = (hexter_engine_event_t *)malloc(count[channel] *
+                                                             sizeof(hexter_engine_event_t));
+        part->buffer = (float *)malloc(RENDER_BLOCK * sizeof(float));
+        part->engine = hexter_engine_new(sample_rate);
+        if (!part->events || !part->block_events || !part->buffer || !part->engine)
+            out_of_memory();
+        for (i = 0; i < event_count; i++)
+            if (events[i].status < 0xf0 && (events[i].status & 0x0f) == channel)
+                part->events[part->event_count++] = events[i];
+
+        /* render every block, however busy the machine */
+        hexter_engine_set_offline(part->engine, 1);
+        if (bank_file && !hexter_engine_load_bank(part->engine, bank_file, &errmsg)) {
+            fprintf(stderr, "hexter_render: could not load '%s': %s\n", bank_file, errmsg);
+            exit(1);
+        }
+        if (library_file &&
+            (errmsg = hexter_engine_configure(part->engine, "library", library_file))) {
+            fprintf(stderr, "hexter_render: could not open library '%s': %s\n",
+                    library_file, errmsg);
+            exit(1);
+        }
+        if (polyphony) {
+            snprintf(buffer, sizeof(buffer), "%d", polyphony);
+            if ((errmsg = hexter_engine_configure(part->engine, "polyphony", buffer))) {
+                fprintf(stderr, "hexter_render: %s\n", errmsg);
+                exit(1);
+            }
+        }
+        part->fixed_program = fixed_programs[channel];
+        hexter_engine_select_program(part->engine, 0,
+                                     part->fixed_program >= 0 ? part->fixed_program : 0);
+    }
+}
+
+/*
+ * render_part
+ *
+ * Render 'frames' frames of a part, starting at frame 'start', into its
+ * buffer.  A program change takes effect before anything else at its
+ * frame, so the block is rendered in spans between them.
+ */
+static void
+render_part(part_t *part, unsigned long start, unsigned long frames)
+{
+    unsigned long done = 0, span_end, i, count;
+    midi_event_t *event;
+    char name[11];
+
+    while (done < frames) {
+
+        /* apply the program changes at this frame */
+        span_end = frames;
+        for (i = part->next_event; i < part->event_count; i++) {
+            event = &part->events[i];
+            if (event->time >= start + frames)
+                break;
+            if ((event->status & 0xf0) == 0xb0) {
+                if (event->data1 == 0)
+                    part->bank_msb = event->data2;
+                else if (event->data1 == 32)
+                    part->bank_lsb = event->data2;
+            } else if ((event->status & 0xf0) == 0xc0) {
+                if (event->time > start + done) {
+                    span_end = event->time - start;
+                    break;
+                }
+                if (part->fixed_program < 0) {
+                    hexter_engine_select_program(part->engine,
+                                                 part->bank_msb * 128 + part->bank_lsb,
+                                                 event->data1);
+                    if (verbose && hexter_engine_patch_name(part->engine,
+                                                            part->bank_msb * 128 + part->bank_lsb,
+                                                            event->data1, name))
+                        printf("channel %d: program %lu:%d '%s' at %.3f s\n",
+                               part->channel + 1, part->bank_msb * 128 + part->bank_lsb,
+                               event->data1, name, (double)event->time / sample_rate);
+                }
+            }
+        }
+
+        /* then render up to the next one */
+        for (count = 0; part->next_event < part->event_count; part->next_event++) {
+            event = &part->events[part->next_event];
+            if (event->time >= start + span_end)
+                break;
+            if ((event->status & 0xf0) == 0xc0)
+                continue;
+            part->block_events[count].frame = event->time - (start + done);
+            part->block_events[count].status = event->status;
+            part->block_events[count].data1 = event->data1;
+            part->block_events[count].data2 = event->data2;
+            count++;
+        }
+        hexter_engine_render(part->engine, part->buffer + done, span_end - done,
+                             part->block_events, count);
+        done = span_end;
+    }
+}
+
+static void *
+worker(void *arg)
+{
+    unsigned long seen = 0;
+    int p;
+
+    pthread_mutex_lock(&queue_mutex);
+    for (;;) {
+        while (block_number == seen && !quitting)
+            pthread_cond_wait(&work_ready, &queue_mutex);
+        if (quitting)
+            break;
+        seen = block_number;
+        while (next_part < part_count) {
+            p = next_part++;
+            pthread_mutex_unlock(&queue_mutex);
+            render_part(&parts[p], block_start, block_frames);
+            pthread_mutex_lock(&queue_mutex);
+            if (++parts_done == part_count)
+                pthread_cond_signal(&work_done);
+        }
+    }
+    pthread_mutex_unlock(&queue_mutex);
+    return NULL;
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *output_file;
+    unsigned long frames, position, i;
+    double wall_time, cpu_time;
+    pthread_t *workers;
+    float *mix = NULL;
+    FILE *output = NULL;
+    char *stem_file;
+    int c, p, channel, program, wav;
+
+    for (c = 0; c < 16; c++)
+        fixed_programs[c] = -1;
+
+    while ((c = getopt(argc, argv, "b:l:p:r:P:j:t:sv")) != -1) {
+        switch (c) {
+          case 'b':
+            bank_file = optarg;
+            break;
+          case 'l':
+            library_file = optarg;
+            break;
+          case 'p':
+            if (sscanf(optarg, "%d:%d", &channel, &program) != 2 ||
+                channel < 1 || channel > 16 || program < 0 || program > 127) {
+                fprintf(stderr, "hexter_render: -p takes <channel 1-16>:<program 0-127>\n");
+                exit(1);
+            }
+            fixed_programs[channel - 1] = program;
+            break;
+          case 'r':
+            sample_rate = strtoul(optarg, NULL, 10);
+            break;
+          case 'P':
+            polyphony = atoi(optarg);
+            break;
+          case 'j':
+            threads = atoi(optarg);
+            break;
+          case 't':
+            tail = atof(optarg);
+            break;
+          case 's':
+            stems = 1;
+            break;
+          case 'v':
+            verbose = 1;
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (argc - optind != 2)
+        usage(argv[0]);
+    if (sample_rate < 8000 || sample_rate > 192000 || tail < 0.0 || threads < 0) {
+        fprintf(stderr, "hexter_render: invalid option value\n");
+        exit(1);
+    }
+    output_file = argv[optind + 1];
+    i = strlen(output_file);
+    wav = !(i > 4 && !strcmp(output_file + i - 4, ".raw"));
+
+    load_midi_file(argv[optind]);
+    setup_parts();
+    if (!part_count) {
+        fprintf(stderr, "hexter_render: no channel events in '%s'\n", argv[optind]);
+        exit(1);
+    }
+    frames = (event_count ? events[event_count - 1].time : 0) +
+             (unsigned long)(tail * (double)sample_rate);
+
+    if (stems) {
+        for (p = 0; p < part_count; p++) {
+            stem_file = stem_filename(output_file, parts[p].channel);
+            parts[p].stem = open_output(stem_file, wav);
+            free(stem_file);
+        }
+    } else {
+        mix = (float *)malloc(RENDER_BLOCK * sizeof(float));
+        if (!mix)
+            out_of_memory();
+        output = open_output(output_file, wav);
+    }
+
+    if (!threads)
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1)
+        threads = 1;
+    if (threads > part_count)
+        threads = part_count;
+    workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    if (!workers)
+        out_of_memory();
+    for (c = 0; c < threads; c++)
+        if (pthread_create(&workers[c], NULL, worker, NULL)) {
+            fprintf(stderr, "hexter_render: could not start worker thread\n");
+            exit(1);
+        }
+
+    wall_time = clock_seconds(CLOCK_MONOTONIC);
+    cpu_time = clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
+
+    for (position = 0; position < frames; position += RENDER_BLOCK) {
+
+        pthread_mutex_lock(&queue_mutex);
+        block_start = position;
+        block_frames = (frames - position < RENDER_BLOCK ? frames - position : RENDER_BLOCK);
+        next_part = 0;
+        parts_done = 0;
+        block_number++;
+        pthread_cond_broadcast(&work_ready);
+        while (parts_done < part_count)
+            pthread_cond_wait(&work_done, &queue_mutex);
+        pthread_mutex_unlock(&queue_mutex);
+
+        if (stems) {
+            for (p = 0; p < part_count; p++)
+                write_samples(parts[p].stem, parts[p].buffer, block_frames, wav);
+        } else {
+            memcpy(mix, parts[0].buffer, block_frames * sizeof(float));
+            for (p = 1; p < part_count; p++)
+                for (i = 0; i < block_frames; i++)
+                    mix[i] += parts[p].buffer[i];
+            write_samples(output, mix, block_frames, wav);
+        }
+    }
+
+    wall_time = clock_seconds(CLOCK_MONOTONIC) - wall_time;
+    cpu_time = clock_seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_time;
+
+    pthread_mutex_lock(&queue_mutex);
+    quitting = 1;
+    pthread_cond_broadcast(&work_ready);
+    pthread_mutex_unlock(&queue_mutex);
+    for (c = 0; c < threads; c++)
+        pthread_join(workers[c], NULL);
+
+    if (stems) {
+        for (p = 0; p < part_count; p++) {
+            stem_file = stem_filename(output_file, parts[p].channel);
+            close_output(parts[p].stem, stem_file, frames, wav);
+            free(stem_file);
+        }
+    } else
+        close_output(output, output_file, frames, wav);
+
+    printf("rendered %.1f s of %d channel%s in %.2f s on %d thread%s: "
+           "%.1fx realtime, %.2f s CPU\n",
+           (double)frames / sample_rate, part_count, part_count == 1 ? "" : "s",
+           wall_time, threads, threads == 1 ? "" : "s",
+           wall_time > 0.0 ? (double)frames / sample_rate / wall_time : 0.0, cpu_time);
+
+    for (p = 0; p < part_count; p++) {
+        hexter_engine_free(parts[p].engine);
+        free(parts[p].events);
+        free(parts[p].block_events);
+        free(parts[p].buffer);
+    }
+    free(mix);
+    free(workers);
+    free(events);
+    return 0;
+}
@@ -0,0 +1,164 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <math.h>
+
+#include "hexter_resample.h"
+
+#define KAISER_BETA  8.0   /* about 80dB of image rejection */
+
+/*
+ * bessel_i0
+ *
+ * the zeroth order modified Bessel function of the first kind, for the
+ * Kaiser window
+ */
+static double
+bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+
+    for (k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+    return sum;
+}
+
+/*
+ * hexter_resampler_init
+ *
+ * set up 'resampler' to interpolate by 'factor', which must be between 1
+ * and HEXTER_RESAMPLE_MAX_FACTOR, designing the filter, and clear it.
+ * The prototype filter is HEXTER_RESAMPLE_TAPS * factor taps long, with
+ * its cutoff at the input's Nyquist frequency; each phase is normalized
+ * to unity gain, so a constant input comes out unchanged.
+ */
+void
+hexter_resampler_init(hexter_resampler_t *resampler, int factor)
+{
+    int length = HEXTER_RESAMPLE_TAPS * factor;
+    double center = (double)(length - 1) / 2.0;
+    double h[HEXTER_RESAMPLE_TAPS * HEXTER_RESAMPLE_MAX_FACTOR];
+    double x, w, sum;
+    int i, p, u;
+
+    resampler->factor = factor;
+    for (i = 0; i < length; i++) {
+        x = ((double)i - center) / (double)factor;
+        h[i] = (fabs(x) < 1e-9 ? 1.0 : sin(M_PI * x) / (M_PI * x));
+        w = ((double)i - center) / (center + 1.0);
+        h[i] *= bessel_i0(KAISER_BETA * sqrt(1.0 - w * w)) / bessel_i0(KAISER_BETA);
+    }
+
+    /* output phase p takes prototype taps p, p + factor, ..., the first
+     * of them applying to the newest input, so store them reversed */
+    for (p = 0; p < factor; p++) {
+        sum = 0.0;
+        for (u = 0; u < HEXTER_RESAMPLE_TAPS; u++)
+            sum += h[p + u * factor];
+        for (u = 0; u < HEXTER_RESAMPLE_TAPS; u++)
+            resampler->coeff[p][HEXTER_RESAMPLE_TAPS - 1 - u] =
+                (float)(h[p + u * factor] / sum);
+    }
+
+    hexter_resampler_reset(resampler);
+}
+
+/*
+ * hexter_resampler_reset
+ *
+ * forget all past input
+ */
+void
+hexter_resampler_reset(hexter_resampler_t *resampler)
+{
+    resampler->phase = 0;
+    memset(resampler->history, 0, sizeof(resampler->history));
+}
+
+/*
+ * hexter_resampler_inputs
+ *
+ * return the number of new input samples needed to produce the next
+ * 'frames' output frames, at most HEXTER_NUGGET_SIZE for up to
+ * HEXTER_NUGGET_SIZE * factor frames
+ */
+unsigned long
+hexter_resampler_inputs(hexter_resampler_t *resampler, unsigned long frames)
+{
+    unsigned long first = (resampler->factor - resampler->phase) % resampler->factor;
+
+    return (first < frames ? (frames - first - 1) / resampler->factor + 1 : 0);
+}
+
+/*
+ * hexter_resampler_input
+ *
+ * return where the new input samples for the next hexter_resampler_run()
+ * call go
+ */
+float *
+hexter_resampler_input(hexter_resampler_t *resampler)
+{
+    return resampler->history + HEXTER_RESAMPLE_TAPS;
+}
+
+/*
+ * hexter_resampler_run
+ *
+ * add 'frames' frames of output to 'out', from the 'inputs' new input
+ * samples that hexter_resampler_inputs() asked for
+ */
+void
+hexter_resampler_run(hexter_resampler_t *resampler, unsigned long inputs,
+                     float *out, unsigned long frames)
+{
+    float *in = resampler->history;  /* the oldest of the taps for the newest input */
+    const float *c;
+    float sum;
+    unsigned long i;
+    int phase = resampler->phase, u;
+
+    for (i = 0; i < frames; i++) {
+        if (phase == 0)
+            in++;  /* the next input sample is due */
+        c = resampler->coeff[phase];
+        sum = 0.0f;
+        for (u = 0; u < HEXTER_RESAMPLE_TAPS; u++)
+            sum += c[u] * in[u];
+        out[i] += sum;
+        if (++phase == resampler->factor)
+            phase = 0;
+    }
+    resampler->phase = phase;
+
+    /* keep the newest HEXTER_RESAMPLE_TAPS samples */
+    memmove(resampler->history, resampler->history + inputs,
+            sizeof(float) * HEXTER_RESAMPLE_TAPS);
+}
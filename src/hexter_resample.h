@@ -0,0 +1,55 @@
+/* hexter DSSI software synthesizer plugin
+ *
+ * Copyright (C) 2018 Sean Bolton and others.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _HEXTER_RESAMPLE_H
+#define _HEXTER_RESAMPLE_H
+
+#include "hexter_types.h"
+#include "hexter.h"
+
+/* The output resampler: with 'configure internal_rate', an instance's
+ * voices render at the host rate divided by a factor of 2 or 4, and this
+ * interpolates their mix up to the host rate, once per instance.  It is a
+ * polyphase windowed-sinc filter: each output frame is one contiguous dot
+ * product of HEXTER_RESAMPLE_TAPS input samples with the coefficients for
+ * its phase, a loop the compiler can vectorize.  The filter delays the
+ * output by about HEXTER_RESAMPLE_TAPS / 2 internal samples. */
+
+#define HEXTER_RESAMPLE_MAX_FACTOR  4
+#define HEXTER_RESAMPLE_TAPS       32   /* per phase */
+
+struct _hexter_resampler_t
+{
+    int             factor;            /* host frames per input sample, 1 when not resampling */
+    int             phase;             /* of the next output frame, 0 to factor - 1 */
+    float           coeff[HEXTER_RESAMPLE_MAX_FACTOR][HEXTER_RESAMPLE_TAPS];  /* per phase, oldest input first */
+    float           history[HEXTER_RESAMPLE_TAPS + HEXTER_NUGGET_SIZE];  /* last input samples, then new ones */
+};
+
+/* hexter_resample.c */
+void   hexter_resampler_init(hexter_resampler_t *resampler, int factor);
+void   hexter_resampler_reset(hexter_resampler_t *resampler);
+unsigned long hexter_resampler_inputs(hexter_resampler_t *resampler,
+                                      unsigned long frames);
+float *hexter_resampler_input(hexter_resampler_t *resampler);
+void   hexter_resampler_run(hexter_resampler_t *resampler, unsigned long inputs,
+                            float *out, unsigned long frames);
+
+#endif /* _HEXTER_RESAMPLE_H */
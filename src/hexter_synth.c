@@ -25,9 +25,11 @@
 #include <config.h>
 #endif
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include <pthread.h>
 
 #include "hexter.h"
@@ -35,6 +37,51 @@
 #include "hexter_synth.h"
 #include "dx7_voice_data.h"
 #include "dx7_voice.h"
+#include "hexter_library.h"
+#include "hexter_bank.h"
+#include "hexter_budget.h"
+#include "hexter_onset.h"
+
+/* ---- mutual exclusion ---- */
+
+/*
+ * dssp_voicelist_mutex_trylock
+ *
+ * for the audio thread: returns non-zero if the voice list is busy, in
+ * which case all voices are turned off once it is next free
+ */
+int
+dssp_voicelist_mutex_trylock(hexter_instance_t *instance)
+{
+    int rc;
+
+    /* Attempt the mutex lock */
+    rc = pthread_mutex_trylock(&instance->voicelist_mutex);
+    if (rc) {
+        instance->voicelist_mutex_grab_failed = 1;
+        return rc;
+    }
+    /* Clean up if a previous mutex grab failed */
+    if (instance->voicelist_mutex_grab_failed) {
+        hexter_instance_all_voices_off(instance);
+        instance->voicelist_mutex_grab_failed = 0;
+    }
+    return 0;
+}
+
+int
+dssp_voicelist_mutex_lock(hexter_instance_t *instance)
+{
+    return pthread_mutex_lock(&instance->voicelist_mutex);
+}
+
+int
+dssp_voicelist_mutex_unlock(hexter_instance_t *instance)
+{
+    return pthread_mutex_unlock(&instance->voicelist_mutex);
+}
+
+/* ---- instances ---- */
 
 /*
  * dx7_voice_off
@@ -48,6 +95,10 @@ dx7_voice_off(dx7_voice_t* voice)
     if (voice->instance->monophonic)
         voice->instance->mono_voice = NULL;
     voice->instance->current_voices--;
+    if (voice->instance->pool != voice->instance)  /* a part's voice */
+        voice->instance->pool->current_voices--;
+    if (voice->instance->pool->budget_slot >= 0)
+        hexter_budget_count(-1);
 }
 
 /*
@@ -58,6 +109,45 @@ dx7_voice_start_voice(dx7_voice_t *voice)
 {
     voice->status = DX7_VOICE_ON;
     voice->instance->current_voices++;
+    if (voice->instance->pool != voice->instance)
+        voice->instance->pool->current_voices++;
+    if (voice->instance->pool->budget_slot >= 0)
+        hexter_budget_count(1);
+}
+
+/*
+ * hexter_synth_ghost_voice
+ *
+ * hand a voice that is about to be stolen to a 'ghost', which continues it
+ * from its current state, with no control updates, while ramping its volume
+ * to zero over the de-click time
+ */
+static inline void
+hexter_synth_ghost_voice(hexter_instance_t *instance, dx7_voice_t *voice)
+{
+    int i, g = 0;
+    dx7_voice_t *ghost;
+
+    /* use a free ghost, or else the one furthest into its fade */
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        if (!instance->ghost[i]->volume_duration) {
+            g = i;
+            break;
+        }
+        if (instance->ghost[i]->volume_duration < instance->ghost[g]->volume_duration)
+            g = i;
+    }
+    ghost = instance->ghost[g];
+
+    /* the voice's wavetable matters only if it is playing it */
+    memcpy(ghost, voice, (voice->wavetable.state == DX7_WAVETABLE_PLAYING ?
+                              sizeof(dx7_voice_t) :
+                              offsetof(dx7_voice_t, wavetable.table)));
+    ghost->onset.state = DX7_ONSET_NONE;  /* the voice may go on recording */
+    ghost->volume_target = 0.0f;
+    ghost->volume_duration = instance->declick_frames;
+    ghost->volume_increment = -ghost->volume_value / (float)instance->declick_frames;
+    instance->stats.declicks++;
 }
 
 /*
@@ -99,7 +189,8 @@ hexter_instance_remove_held_key(hexter_instance_t *instance, unsigned char key)
 /*
  * hexter_instance_all_voices_off
  *
- * stop processing all notes within instance immediately
+ * stop processing all notes within instance immediately, including those of
+ * all its parts if it is multitimbral
  */
 void
 hexter_instance_all_voices_off(hexter_instance_t *instance)
@@ -113,6 +204,38 @@ hexter_instance_all_voices_off(hexter_instance_t *instance)
             dx7_voice_off(voice);
         }
     }
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        if (instance->ghost[i])
+            instance->ghost[i]->volume_duration = 0;
+    }
+    hexter_instance_clear_held_keys(instance);
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++)
+        hexter_instance_clear_held_keys(instance->part[i]);
+}
+
+/*
+ * hexter_instance_part_voices_off
+ *
+ * stop the notes of one part (or of a whole instance that is not
+ * multitimbral) immediately, for an 'all sounds off' controller
+ */
+static void
+hexter_instance_part_voices_off(hexter_instance_t *instance)
+{
+    hexter_instance_t *pool = instance->pool;
+    int i;
+    dx7_voice_t *voice;
+
+    for (i = 0; i < pool->polyphony; i++) {
+        voice = pool->voice[i];
+        if (_PLAYING(voice) && voice->instance == instance) {
+            dx7_voice_off(voice);
+        }
+    }
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        if (pool->ghost[i] && pool->ghost[i]->instance == instance)
+            pool->ghost[i]->volume_duration = 0;
+    }
     hexter_instance_clear_held_keys(instance);
 }
 
@@ -125,13 +248,16 @@ void
 hexter_instance_note_off(hexter_instance_t *instance, unsigned char key,
                          unsigned char rvelocity)
 {
+    hexter_instance_t *pool = instance->pool;
     int i;
     dx7_voice_t *voice;
 
     hexter_instance_remove_held_key(instance, key);
 
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
+    for (i = 0; i < pool->max_voices; i++) {
+        voice = pool->voice[i];
+        if (voice->instance != instance)
+            continue;  /* another part's */
         if (instance->monophonic ? (_PLAYING(voice)) :
                                    (_ON(voice) && (voice->key == key))) {
             DEBUG_MESSAGE(DB_NOTE, " hexter_instance_note_off: key %d rvel %d voice %d note id %d\n", key, rvelocity, i, voice->note_id);
@@ -148,19 +274,34 @@ hexter_instance_note_off(hexter_instance_t *instance, unsigned char key,
 void
 hexter_instance_all_notes_off(hexter_instance_t* instance)
 {
+    hexter_instance_t *pool = instance->pool;
     int i;
     dx7_voice_t *voice;
 
     /* reset the sustain controller */
     instance->cc[MIDI_CTL_SUSTAIN] = 0;
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
-        if (_ON(voice) || _SUSTAINED(voice)) {
+    for (i = 0; i < pool->max_voices; i++) {
+        voice = pool->voice[i];
+        if (voice->instance == instance && (_ON(voice) || _SUSTAINED(voice))) {
             dx7_voice_release_note(instance, voice);
         }
     }
 }
 
+/*
+ * hexter_instance_voice_limit
+ *
+ * the number of voices new notes may bring the instance up to: max_voices,
+ * or less while the governor is shedding load
+ */
+static inline int
+hexter_instance_voice_limit(hexter_instance_t *instance)
+{
+    if (instance->governor && instance->voice_limit < instance->max_voices)
+        return instance->voice_limit;
+    return instance->max_voices;
+}
+
 /*
  * hexter_synth_free_voice_by_kill
  *
@@ -175,13 +316,25 @@ hexter_synth_free_voice_by_kill(hexter_instance_t *instance)
     int this_voice_prio;
     dx7_voice_t *voice;
     int best_voice_index = -1;
+    int voice_limit = hexter_instance_voice_limit(instance);
+    float loudest = 0.0f;
+
+    for (i = 0; i < instance->max_voices; i++) {
+        voice = instance->voice[i];
+        if (_PLAYING(voice) && voice->level > loudest)
+            loudest = voice->level;
+    }
 
     for (i = 0; i < instance->max_voices; i++) {
         voice = instance->voice[i];
 
-        /* safeguard against an available voice. */
-        if (_AVAILABLE(voice))
-            return voice;
+        /* safeguard against an available voice, unless the governor has
+         * the instance at or over its limit. */
+        if (_AVAILABLE(voice)) {
+            if (instance->current_voices < voice_limit)
+                return voice;
+            continue;
+        }
 
         /* Determine, how 'important' a voice is.
          * Start with an arbitrary number */
@@ -209,12 +362,16 @@ hexter_synth_free_voice_by_kill(hexter_instance_t *instance)
          * important than a younger voice. */
         this_voice_prio -= (instance->note_id - voice->note_id);
 
-        /* -FIX- not yet implemented:
-         * /= take a rough estimate of loudness into account. Louder voices are more important. =/
-         * if (voice->volenv_section != FLUID_VOICE_ENVATTACK){
-         *     this_voice_prio += voice->volenv_val*1000.;
-         * };
-         */
+        /* Take a rough estimate of loudness into account. Louder voices are
+         * more important. The level is taken in dB relative to the loudest
+         * voice, down to -60dB, so that a voice which has decayed to near
+         * silence goes before an audible one, even if it is still held. */
+        if (loudest > 0.0f) {
+            if (voice->level > loudest * 0.001f)
+                this_voice_prio += (int)(40.0f * 20.0f * log10f(voice->level / loudest));
+            else
+                this_voice_prio -= 40 * 60;
+        }
 
         /* check if this voice has less priority than the previous candidate. */
         if (this_voice_prio < best_prio)
@@ -227,46 +384,134 @@ hexter_synth_free_voice_by_kill(hexter_instance_t *instance)
 
     voice = instance->voice[best_voice_index];
     DEBUG_MESSAGE(DB_NOTE, " hexter_synth_free_voice_by_kill: no available voices, killing voice %d note id %d\n", best_voice_index, voice->note_id);
+    if (instance->declick)
+        hexter_synth_ghost_voice(instance, voice);
     dx7_voice_off(voice);
     return voice;
 }
 
+/*
+ * hexter_synth_budget_priority
+ *
+ * a voice's priority under the global voice budget, lowest first to go:
+ * released voices go first, then the quietest, then the oldest
+ */
+static inline uint64_t
+hexter_synth_budget_priority(dx7_voice_t *voice)
+{
+    uint64_t state, level = 0;
+
+    state = (_RELEASED(voice) ? 0 : _SUSTAINED(voice) ? 1 : 2);
+    if (voice->level > 0.000001f) {  /* in eighths of a dB above -120dB */
+        level = (uint64_t)lrintf((20.0f * log10f(voice->level) + 120.0f) * 8.0f);
+        if (level > 4095)
+            level = 4095;
+    }
+    return (state << 62) | (level << 32) | voice->budget_stamp;
+}
+
+/*
+ * hexter_synth_budget_weakest
+ *
+ * return the instance's voice that is first to go under the global voice
+ * budget, with its priority in '*priority', or NULL if none is playing
+ */
+static dx7_voice_t *
+hexter_synth_budget_weakest(hexter_instance_t *instance, uint64_t *priority)
+{
+    int i;
+    dx7_voice_t *voice, *weakest = NULL;
+    uint64_t this_priority;
+
+    *priority = HEXTER_BUDGET_NONE;
+    for (i = 0; i < instance->max_voices; i++) {
+        voice = instance->voice[i];
+        if (_PLAYING(voice)) {
+            this_priority = hexter_synth_budget_priority(voice);
+            if (this_priority < *priority) {
+                *priority = this_priority;
+                weakest = voice;
+            }
+        }
+    }
+    return weakest;
+}
+
+/*
+ * hexter_synth_budget_kill
+ */
+static void
+hexter_synth_budget_kill(hexter_instance_t *instance, dx7_voice_t *voice)
+{
+    DEBUG_MESSAGE(DB_NOTE, " hexter_synth_budget_kill: over global budget, killing voice note id %d\n", voice->note_id);
+    if (instance->declick)
+        hexter_synth_ghost_voice(instance, voice);
+    dx7_voice_off(voice);
+    instance->stats.budget_steals++;
+}
+
 /*
  * hexter_synth_alloc_voice
  */
 static dx7_voice_t *
 hexter_synth_alloc_voice(hexter_instance_t* instance, unsigned char key)
 {
+    hexter_instance_t *pool = instance->pool;
     int i;
     dx7_voice_t* voice;
 
     /* If there is another voice on the same key, advance it
      * to the release phase. Note that a DX7 doesn't do this,
      * but we do it here to keep our CPU usage low. */
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
-        if (voice->key == key && (_ON(voice) || _SUSTAINED(voice))) {
+    for (i = 0; i < pool->max_voices; i++) {
+        voice = pool->voice[i];
+        if (voice->instance == instance && voice->key == key &&
+            (_ON(voice) || _SUSTAINED(voice))) {
             dx7_voice_release_note(instance, voice);
         }
     }
 
     voice = NULL;
 
-    if (instance->current_voices < instance->max_voices) {
+    if (pool->budget_slot >= 0 && hexter_budget_full()) {
+        uint64_t priority;
+        int other;
+
+        /* The global voice budget is spent, so the weakest voice of all
+         * the instances in it goes: this one's own, or else another's,
+         * which it gives up at the end of its next run. */
+        voice = hexter_synth_budget_weakest(pool, &priority);
+        other = hexter_budget_find_weaker(pool->budget_slot, priority);
+        if (other >= 0) {
+            hexter_budget_charge(other);
+            voice = NULL;
+        } else if (voice) {
+            hexter_synth_budget_kill(pool, voice);
+            return voice;
+        }
+    }
+
+    /* parts share the pool's voices, and steal from each other as any
+     * voice would from another */
+    if (pool->current_voices < hexter_instance_voice_limit(pool)) {
         /* check if there's an available voice */
-        for (i = 0; i < instance->max_voices; i++) {
-            if (_AVAILABLE(instance->voice[i])) {
-                voice = instance->voice[i];
+        for (i = 0; i < pool->max_voices; i++) {
+            if (_AVAILABLE(pool->voice[i])) {
+                voice = pool->voice[i];
                 break;
             }
         }
 
         /* if not, then stop a running voice. */
         if (voice == NULL) {
-            voice = hexter_synth_free_voice_by_kill(instance);
+            voice = hexter_synth_free_voice_by_kill(pool);
+            if (voice)
+                pool->stats.steals++;
         }
-    } else {  /* at instance polyphony limit */
-        voice = hexter_synth_free_voice_by_kill(instance);
+    } else {  /* at instance polyphony (or governor) limit */
+        voice = hexter_synth_free_voice_by_kill(pool);
+        if (voice)
+            pool->stats.steals++;
     }
 
     if (voice == NULL) {
@@ -311,7 +556,9 @@ hexter_instance_note_on(hexter_instance_t *instance, unsigned char key,
     }
 
     voice->instance = instance;
-    voice->note_id = instance->note_id++;
+    voice->note_id = instance->pool->note_id++;
+    if (instance->pool->budget_slot >= 0)
+        voice->budget_stamp = hexter_budget_stamp();
 
     dx7_voice_note_on(instance, voice, key, velocity);
 }
@@ -333,9 +580,9 @@ hexter_instance_key_pressure(hexter_instance_t *instance, unsigned char key,
     instance->key_pressure[key] = pressure;
 
     /* flag any playing voices as needing updating */
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
-        if (_PLAYING(voice) && voice->key == key) {
+    for (i = 0; i < instance->pool->max_voices; i++) {
+        voice = instance->pool->voice[i];
+        if (_PLAYING(voice) && voice->instance == instance && voice->key == key) {
             voice->mods_serial--;
         }
     }
@@ -353,9 +600,9 @@ hexter_instance_damp_voices(hexter_instance_t* instance)
     int i;
     dx7_voice_t* voice;
 
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
-        if (_SUSTAINED(voice)) {
+    for (i = 0; i < instance->pool->max_voices; i++) {
+        voice = instance->pool->voice[i];
+        if (_SUSTAINED(voice) && voice->instance == instance) {
             /* this assumes the caller has cleared the sustain controller */
             dx7_voice_release_note(instance, voice);
         }
@@ -472,12 +719,12 @@ hexter_instance_update_op_param(hexter_instance_t *instance, int opnum,
     }
 
     /* update edit buffer */
-    if (!pthread_mutex_trylock(&instance->patches_mutex)) {
+    if (!pthread_mutex_trylock(&instance->pool->patches_mutex)) {
 
         instance->current_patch_buffer[((5 - opnum) * 21) + param] =
             value;
 
-        pthread_mutex_unlock(&instance->patches_mutex);
+        pthread_mutex_unlock(&instance->pool->patches_mutex);
     } else {
         /* In the unlikely event that we get here, it means another thread is
          * currently updating the current patch buffer. We could do something
@@ -486,9 +733,9 @@ hexter_instance_update_op_param(hexter_instance_t *instance, int opnum,
     }
 
     /* check if any playing voices need updating */
-    for (i = 0; i < instance->max_voices; i++) {
-        voice = instance->voice[i];
-        if (_PLAYING(voice)) {
+    for (i = 0; i < instance->pool->max_voices; i++) {
+        voice = instance->pool->voice[i];
+        if (_PLAYING(voice) && voice->instance == instance) {
             dx7_op_t *op = &voice->op[opnum];
 
             /* set values */
@@ -628,7 +875,7 @@ hexter_instance_control_change(hexter_instance_t *instance, unsigned int param,
 
       case MIDI_CTL_ALL_SOUNDS_OFF:
         instance->cc[param] = value;
-        hexter_instance_all_voices_off(instance);
+        hexter_instance_part_voices_off(instance);
         return;
 
       case MIDI_CTL_RESET_CONTROLLERS:
@@ -838,203 +1085,928 @@ void
 hexter_instance_select_program(hexter_instance_t *instance, unsigned long bank,
                                unsigned long program)
 {
-    /* no support for banks, so we just ignore the bank number */
+    const dx7_patch_t *patch;
+
     if (program >= 128) return;
+
+    /* a part plays from its pool's patches and library */
+    if (bank) {  /* patch library bank */
+        patch = hexter_library_patch(instance->pool->library, (bank - 1) * 128 + program);
+        if (!patch) return;
+        instance->current_bank = bank;
+        instance->current_program = program;
+        dx7_patch_unpack((dx7_patch_t *)patch, 0, instance->current_patch_buffer);
+        return;
+    }
+
+    instance->current_bank = 0;
     instance->current_program = program;
     if (instance->overlay_program == program) { /* edit buffer applies */
         memcpy(instance->current_patch_buffer, instance->overlay_patch_buffer, DX7_VOICE_SIZE_UNPACKED);
     } else {
-        dx7_patch_unpack(instance->patches, program, instance->current_patch_buffer);
+        dx7_patch_unpack(instance->pool->patches, program, instance->current_patch_buffer);
     }
 }
 
 /*
- * hexter_instance_set_program_descriptor
+ * hexter_instance_update_parts
+ *
+ * Called with the patches mutex held, after a multitimbral instance's
+ * patches or library have changed, to reload each of its parts' current
+ * patches from them.
  */
-int
-hexter_instance_set_program_descriptor(hexter_instance_t *instance,
-                                       DSSI_Program_Descriptor *pd,
-                                       unsigned long bank,
-                                       unsigned long program)
+void
+hexter_instance_update_parts(hexter_instance_t *instance)
 {
-    static char name[11];
+    hexter_instance_t *part;
+    int i;
 
-    /* no support for banks, so we just ignore the bank number */
-    if (program >= 128) {
-        return 0;
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        part = instance->part[i];
+        if (part->current_bank) {
+            if (!hexter_library_patch(instance->library, (part->current_bank - 1) * 128 +
+                                                             part->current_program))
+                part->current_bank = 0;  /* current patch buffer stays as it is */
+        } else
+            dx7_patch_unpack(instance->patches, part->current_program,
+                             part->current_patch_buffer);
     }
-    pd->Bank = bank;
-    pd->Program = program;
-    /* -FIX- some character set conversion would be appropriate here, but to what? */
-    dx7_voice_copy_name(name, &instance->patches[program]);
-    pd->Name = name;
-    return 1;
 }
 
 /*
- * hexter_instance_handle_patches
+ * hexter_instance_set_patches
+ *
+ * replace all 128 of the instance's patches, sharing the bank with any
+ * other instance that has the same ones; returns 0 if out of memory
  */
-char *
-hexter_instance_handle_patches(hexter_instance_t *instance, const char *key,
-                               const char *value)
+int
+hexter_instance_set_patches(hexter_instance_t *instance,
+                            const dx7_patch_t *patches)
 {
-    int section;
-
-    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_patches: received new '%s'\n", key);
+    hexter_bank_t *bank = hexter_bank_get(patches),
+                  *old_bank;
 
-    section = key[7] - '0';
-    if (section < 0 || section > 3)
-        return dssp_error_message("patch configuration failed: invalid section '%c'", key[7]);
+    if (!bank)
+        return 0;
 
     pthread_mutex_lock(&instance->patches_mutex);
 
-    if (!decode_7in6(value, 32 * sizeof(dx7_patch_t),
-                     (uint8_t *)&instance->patches[section * 32])) {
-        pthread_mutex_unlock(&instance->patches_mutex);
-        return dssp_error_message("patch configuration failed: corrupt data");
-    }
-
-    if ((instance->current_program / 32) == section &&
+    old_bank = instance->bank;
+    instance->bank = bank;
+    instance->patches = hexter_bank_patches(bank);
+    if (instance->current_bank == 0 &&
         instance->current_program != instance->overlay_program)
         dx7_patch_unpack(instance->patches, instance->current_program,
                          instance->current_patch_buffer);
+    hexter_instance_update_parts(instance);
 
     pthread_mutex_unlock(&instance->patches_mutex);
 
-    return NULL; /* success */
+    hexter_bank_release(old_bank);
+    return 1;
 }
 
 /*
- * hexter_instance_handle_edit_buffer
+ * hexter_instance_try_select_program
+ *
+ * Select a program from the audio thread, or any other that must not
+ * block: if the patches are busy, the change is left pending for the next
+ * run, and 0 is returned.
  */
-char *
-hexter_instance_handle_edit_buffer(hexter_instance_t *instance,
-                                   const char *value)
+int
+hexter_instance_try_select_program(hexter_instance_t *instance,
+                                   unsigned long bank, unsigned long program)
 {
-    struct {
-        int     program;
-        uint8_t buffer[DX7_VOICE_SIZE_UNPACKED];
-    } edit_buffer;
-
-    pthread_mutex_lock(&instance->patches_mutex);
-
-    if (!strcmp(value, "off")) {
+    /* Attempt the patch mutex, return if lock fails. */
+    if (pthread_mutex_trylock(&instance->pool->patches_mutex)) {
+        instance->pending_bank_change = bank;
+        instance->pending_program_change = program;
+        return 0;
+    }
 
-        DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_edit_buffer: cancelled\n");
-        if (instance->current_program == instance->overlay_program) {
-            dx7_patch_unpack(instance->patches, instance->current_program, instance->current_patch_buffer);
-        }
-        instance->overlay_program = -1;
+    hexter_instance_select_program(instance, bank, program);
 
-    } else {
+    pthread_mutex_unlock(&instance->pool->patches_mutex);
+    return 1;
+}
 
-        DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_edit_buffer: received new overlay\n");
+/*
+ * hexter_instance_handle_pending_program_change
+ *
+ * make the program change left pending by hexter_instance_try_select_program(),
+ * if any, and any of a multitimbral instance's parts
+ */
+void
+hexter_instance_handle_pending_program_change(hexter_instance_t *instance)
+{
+    hexter_instance_t *part;
+    int i;
 
-        if (!decode_7in6(value, sizeof(edit_buffer), (uint8_t *)&edit_buffer)) {
-            pthread_mutex_unlock(&instance->patches_mutex);
-            return dssp_error_message("patch edit failed: corrupt data");
-        }
+    /* Attempt the patch mutex, return if lock fails. */
+    if (pthread_mutex_trylock(&instance->patches_mutex))
+        return;
 
-        instance->overlay_program = edit_buffer.program;
-        memcpy(instance->overlay_patch_buffer, edit_buffer.buffer, DX7_VOICE_SIZE_UNPACKED);
-        if (instance->current_program == instance->overlay_program) { /* applies to current patch also */
-            memcpy(instance->current_patch_buffer, instance->overlay_patch_buffer, DX7_VOICE_SIZE_UNPACKED);
+    if (instance->pending_program_change > -1) {
+        hexter_instance_select_program(instance, instance->pending_bank_change,
+                                       instance->pending_program_change);
+        instance->pending_program_change = -1;
+    }
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        part = instance->part[i];
+        if (part->pending_program_change > -1) {
+            hexter_instance_select_program(part, part->pending_bank_change,
+                                           part->pending_program_change);
+            part->pending_program_change = -1;
         }
     }
 
     pthread_mutex_unlock(&instance->patches_mutex);
-
-    return NULL; /* success */
 }
 
-char *
-hexter_instance_handle_performance(hexter_instance_t *instance,
-                                   const char *value)
+/*
+ * hexter_instance_patch_name
+ *
+ * copy the name of a program to 'name', which must have room for 11
+ * characters, returning 0 if there is no such program.  Called with the
+ * pool's patches_mutex held, since a reload or configure() may free the
+ * bank.
+ */
+int
+hexter_instance_patch_name(hexter_instance_t *instance, unsigned long bank,
+                           unsigned long program, char *name)
 {
-    pthread_mutex_lock(&instance->patches_mutex);
-
-    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_performance: received new global performance parameters\n");
+    const dx7_patch_t *patch;
 
-    if (!decode_7in6(value, DX7_PERFORMANCE_SIZE, instance->performance_buffer)) {
-        pthread_mutex_unlock(&instance->patches_mutex);
-        return dssp_error_message("performance edit failed: corrupt data");
+    if (program >= 128) {
+        return 0;
     }
-
-    hexter_instance_set_performance_data(instance);
-
-    pthread_mutex_unlock(&instance->patches_mutex);
-
-    /* we eventually may want to update playing voices here */
-
-    return NULL; /* success */
+    if (bank) {
+        patch = hexter_library_patch(instance->pool->library, (bank - 1) * 128 + program);
+        if (!patch)
+            return 0;
+    } else
+        patch = &instance->pool->patches[program];
+    /* -FIX- some character set conversion would be appropriate here, but to what? */
+    dx7_voice_copy_name(name, (dx7_patch_t *)patch);
+    return 1;
 }
 
 /*
- * hexter_instance_handle_monophonic
+ * hexter_instance_configure
+ *
+ * handle one of the configure() keys understood by the engine, returning
+ * NULL on success or else a malloc'd error message
  */
 char *
-hexter_instance_handle_monophonic(hexter_instance_t *instance, const char *value)
+hexter_instance_configure(hexter_instance_t *instance, const char *key,
+                          const char *value)
 {
-    int mode = -1;
+    if (strlen(key) == 8 && !strncmp(key, "patches", 7)) {
 
-    if (!strcmp(value, "on")) mode = DSSP_MONO_MODE_ON;
-    else if (!strcmp(value, "once")) mode = DSSP_MONO_MODE_ONCE;
-    else if (!strcmp(value, "both")) mode = DSSP_MONO_MODE_BOTH;
-    else if (!strcmp(value, "off"))  mode = DSSP_MONO_MODE_OFF;
+        return hexter_instance_handle_patches(instance, key, value);
 
-    if (mode == -1) {
-        return dssp_error_message("error: monophonic value not recognized");
-    }
+    } else if (!strcmp(key, "patch_delta")) {
 
-    if (mode == DSSP_MONO_MODE_OFF) {  /* polyphonic mode */
+        return hexter_instance_handle_patch_delta(instance, value);
 
-        instance->monophonic = 0;
-        instance->max_voices = instance->polyphony;
+    } else if (!strcmp(key, "snapshot")) {  /* whole instance state */
 
-    } else {  /* one of the monophonic modes */
+        return hexter_instance_handle_snapshot(instance, value);
 
-        if (!instance->monophonic) {
+    } else if (!strcmp(key, "edit_buffer")) {
 
-            dssp_voicelist_mutex_lock(instance);
+        return hexter_instance_handle_edit_buffer(instance, value);
 
-            hexter_instance_all_voices_off(instance);
-            instance->max_voices = 1;
-            instance->mono_voice = NULL;
-            hexter_instance_clear_held_keys(instance);
-            dssp_voicelist_mutex_unlock(instance);
-        }
-        instance->monophonic = mode;
-    }
+    } else if (!strcmp(key, "performance")) {  /* global performance parameters */
 
-    return NULL; /* success */
-}
+        return hexter_instance_handle_performance(instance, value);
 
-/*
- * hexter_instance_handle_polyphony
- */
-char *
-hexter_instance_handle_polyphony(hexter_instance_t *instance, const char *value)
-{
-    int polyphony = atoi(value);
-    int i;
-    dx7_voice_t *voice;
+    } else if (!strcmp(key, "monophonic")) {
 
-    if (polyphony < 1 || polyphony > HEXTER_MAX_POLYPHONY) {
-        return dssp_error_message("error: polyphony value out of range");
-    }
-    /* set the new limit */
-    instance->polyphony = polyphony;
+        return hexter_instance_handle_monophonic(instance, value);
 
-    if (!instance->monophonic) {
+    } else if (!strcmp(key, "polyphony")) {
 
-        dssp_voicelist_mutex_lock(instance);
+        return hexter_instance_handle_polyphony(instance, value);
 
-        instance->max_voices = polyphony;
+    } else if (!strcmp(key, "governor")) {
 
-        /* turn off any voices above the new limit */
+        return hexter_instance_handle_governor(instance, value);
+
+    } else if (!strcmp(key, "declick")) {
+
+        return hexter_instance_handle_declick(instance, value);
+
+    } else if (!strcmp(key, "quality")) {
+
+        return hexter_instance_handle_quality(instance, value);
+
+    } else if (!strcmp(key, "lod")) {
+
+        return hexter_instance_handle_lod(instance, value);
+
+    } else if (!strcmp(key, "wavetable")) {
+
+        return hexter_instance_handle_wavetable(instance, value);
+
+    } else if (!strcmp(key, "onset_cache")) {
+
+        return hexter_instance_handle_onset_cache(instance, value);
+
+    } else if (!strcmp(key, "internal_rate")) {
+
+        return hexter_instance_handle_internal_rate(instance, value);
+
+    } else if (!strcmp(key, "library")) {
+
+        return hexter_instance_handle_library(instance, value);
+
+    } else if (!strcmp(key, "multitimbral")) {
+
+        return hexter_instance_handle_multitimbral(instance, value);
+
+    } else if (!strcmp(key, "global_polyphony")) {
+
+        return hexter_instance_handle_global_polyphony(instance, value);
+
+    }
+    return strdup("error: unrecognized configure key");
+}
+
+/*
+ * hexter_instance_patch_delta_covers
+ *
+ * return true if the last patch delta holds any patches of 'section'
+ */
+static int
+hexter_instance_patch_delta_covers(hexter_instance_t *instance, int section)
+{
+    int i;
+
+    for (i = 0; i < instance->patch_delta_count; i++)
+        if (instance->patch_delta_numbers[i] / 32 == section)
+            return 1;
+    return 0;
+}
+
+/*
+ * hexter_instance_merge_patch_delta
+ *
+ * reapply the last patch delta's patches of 'section' over the 32 patches
+ * just received for it, keeping those they replace, and return the number
+ * of patches changed.  Called with patches_mutex held.
+ */
+static int
+hexter_instance_merge_patch_delta(hexter_instance_t *instance, int section,
+                                  uint8_t *patches)
+{
+    int i, changed = 0;
+    uint8_t *patch;
+
+    for (i = 0; i < instance->patch_delta_count; i++) {
+        if (instance->patch_delta_numbers[i] / 32 != section)
+            continue;
+        patch = patches + (instance->patch_delta_numbers[i] % 32) * DX7_VOICE_SIZE_PACKED;
+        memcpy(instance->patch_delta_section_patches + i * DX7_VOICE_SIZE_PACKED,
+               patch, DX7_VOICE_SIZE_PACKED);
+        instance->patch_delta_superseded[i] = 1;
+        if (memcmp(patch, instance->patch_delta_patches + i * DX7_VOICE_SIZE_PACKED,
+                   DX7_VOICE_SIZE_PACKED)) {
+            memcpy(patch, instance->patch_delta_patches + i * DX7_VOICE_SIZE_PACKED,
+                   DX7_VOICE_SIZE_PACKED);
+            changed++;
+        }
+    }
+    return changed;
+}
+
+/*
+ * hexter_instance_handle_patches
+ */
+char *
+hexter_instance_handle_patches(hexter_instance_t *instance, const char *key,
+                               const char *value)
+{
+    int section;
+    uint64_t value_key;
+    uint8_t decoded[32 * DX7_VOICE_SIZE_PACKED];
+    hexter_bank_t *bank;
+
+    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_patches: received new '%s'\n", key);
+
+    section = key[7] - '0';
+    if (section < 0 || section > 3)
+        return dssp_error_message("patch configuration failed: invalid section '%c'", key[7]);
+
+    /* the section this instance already has costs nothing, and one that
+     * any instance has already decoded costs only a copy */
+    value_key = hexter_bank_key(value);
+    pthread_mutex_lock(&instance->patches_mutex);
+    if (!hexter_instance_patch_delta_covers(instance, section) &&
+        hexter_bank_has_section(instance->bank, section, value_key)) {
+        instance->patches_configured = 1;
+        pthread_mutex_unlock(&instance->patches_mutex);
+        return NULL;
+    }
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    if (!hexter_bank_find_section(value_key, (dx7_patch_t *)decoded) &&
+        !decode_7in6(value, sizeof(decoded), decoded))
+        return dssp_error_message("patch configuration failed: corrupt data");
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    /* patches edited since this section was saved come after it */
+    if (hexter_instance_merge_patch_delta(instance, section, decoded))
+        value_key = 0;  /* no longer what 'value' decodes to */
+    bank = hexter_bank_set_section(instance->bank, section, value_key,
+                                   (dx7_patch_t *)decoded);
+    if (!bank) {
+        pthread_mutex_unlock(&instance->patches_mutex);
+        return dssp_error_message("patch configuration failed: out of memory");
+    }
+    instance->bank = bank;
+    instance->patches = hexter_bank_patches(bank);
+    instance->patches_configured = 1;
+
+    if (instance->current_bank == 0 &&
+        (instance->current_program / 32) == section &&
+        instance->current_program != instance->overlay_program)
+        dx7_patch_unpack(instance->patches, instance->current_program,
+                         instance->current_patch_buffer);
+    hexter_instance_update_parts(instance);
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_patch_delta
+ */
+char *
+hexter_instance_handle_patch_delta(hexter_instance_t *instance,
+                                   const char *value)
+{
+    unsigned long version;
+    uint8_t numbers[2 * PATCH_DELTA_MAX];
+    uint8_t decoded[2 * PATCH_DELTA_MAX * DX7_VOICE_SIZE_PACKED];
+    hexter_bank_t *bank;
+    int count, changed, i;
+
+    /* a host restoring a session may send the delta already applied */
+    if (strtoul(value, NULL, 10) == instance->patch_delta_version &&
+        instance->patch_delta_version != 0)
+        return NULL;
+
+    count = decode_patch_delta(value, &version, numbers, (dx7_patch_t *)decoded);
+    if (count < 0)
+        return dssp_error_message("patch delta failed: corrupt data");
+
+    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_patch_delta: version %lu, %d patches\n",
+                  version, count);
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    /* patches the last delta held but this one drops have had their
+     * sections sent in full since, and those sections' copies take over */
+    changed = count;
+    for (i = 0; i < instance->patch_delta_count; i++) {
+        if (!instance->patch_delta_superseded[i] ||
+            memchr(numbers, instance->patch_delta_numbers[i], count))
+            continue;
+        numbers[changed] = instance->patch_delta_numbers[i];
+        memcpy(decoded + changed * DX7_VOICE_SIZE_PACKED,
+               instance->patch_delta_section_patches + i * DX7_VOICE_SIZE_PACKED,
+               DX7_VOICE_SIZE_PACKED);
+        changed++;
+    }
+
+    bank = hexter_bank_set_patches(instance->bank, changed, numbers,
+                                   (dx7_patch_t *)decoded);
+    if (!bank) {
+        pthread_mutex_unlock(&instance->patches_mutex);
+        return dssp_error_message("patch delta failed: out of memory");
+    }
+    instance->bank = bank;
+    instance->patches = hexter_bank_patches(bank);
+    instance->patch_delta_version = version;
+    instance->patch_delta_count = count;
+    memcpy(instance->patch_delta_numbers, numbers, count);
+    memcpy(instance->patch_delta_patches, decoded, count * DX7_VOICE_SIZE_PACKED);
+    memset(instance->patch_delta_superseded, 0, PATCH_DELTA_MAX);
+    if (count)
+        instance->patches_configured = 1;
+
+    if (instance->current_bank == 0 &&
+        instance->current_program != instance->overlay_program) {
+        for (i = 0; i < changed; i++) {
+            if (numbers[i] == instance->current_program) {
+                dx7_patch_unpack(instance->patches, instance->current_program,
+                                 instance->current_patch_buffer);
+                break;
+            }
+        }
+    }
+    if (changed)
+        hexter_instance_update_parts(instance);
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_edit_buffer
+ */
+char *
+hexter_instance_handle_edit_buffer(hexter_instance_t *instance,
+                                   const char *value)
+{
+    struct {
+        int     program;
+        uint8_t buffer[DX7_VOICE_SIZE_UNPACKED];
+    } edit_buffer;
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    if (!strcmp(value, "off")) {
+
+        DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_edit_buffer: cancelled\n");
+        if (instance->current_bank == 0 &&
+            instance->current_program == instance->overlay_program) {
+            dx7_patch_unpack(instance->patches, instance->current_program, instance->current_patch_buffer);
+        }
+        instance->overlay_program = -1;
+
+    } else {
+
+        DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_edit_buffer: received new overlay\n");
+
+        if (!decode_7in6(value, sizeof(edit_buffer), (uint8_t *)&edit_buffer)) {
+            pthread_mutex_unlock(&instance->patches_mutex);
+            return dssp_error_message("patch edit failed: corrupt data");
+        }
+
+        instance->overlay_program = edit_buffer.program;
+        memcpy(instance->overlay_patch_buffer, edit_buffer.buffer, DX7_VOICE_SIZE_UNPACKED);
+        if (instance->current_bank == 0 &&
+            instance->current_program == instance->overlay_program) { /* applies to current patch also */
+            memcpy(instance->current_patch_buffer, instance->overlay_patch_buffer, DX7_VOICE_SIZE_UNPACKED);
+        }
+    }
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_library
+ *
+ * 'configure library <file>' maps a patch library (see hexter_library.h)
+ * as banks 1 and up; an empty value unmaps it.  Selecting a library patch
+ * then takes no file I/O.
+ */
+char *
+hexter_instance_handle_library(hexter_instance_t *instance, const char *value)
+{
+    hexter_library_t *library = NULL, *old_library;
+    char *errmsg = NULL;
+
+    if (*value) {
+        library = hexter_library_open(value, &errmsg);
+        if (!library)
+            return errmsg;
+    }
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    old_library = instance->library;
+    instance->library = library;
+    if (instance->current_bank &&
+        !hexter_library_patch(library, (instance->current_bank - 1) * 128 +
+                                           instance->current_program))
+        instance->current_bank = 0;  /* current patch buffer stays as it is */
+    hexter_instance_update_parts(instance);
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    hexter_library_close(old_library);
+
+    return NULL; /* success */
+}
+
+char *
+hexter_instance_handle_performance(hexter_instance_t *instance,
+                                   const char *value)
+{
+    int i;
+
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_performance: received new global performance parameters\n");
+
+    if (!decode_7in6(value, DX7_PERFORMANCE_SIZE, instance->performance_buffer)) {
+        pthread_mutex_unlock(&instance->patches_mutex);
+        return dssp_error_message("performance edit failed: corrupt data");
+    }
+
+    hexter_instance_set_performance_data(instance);
+    /* the GUI edits one set of performance parameters, for all parts */
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        memcpy(instance->part[i]->performance_buffer, instance->performance_buffer,
+               DX7_PERFORMANCE_SIZE);
+        hexter_instance_set_performance_data(instance->part[i]);
+    }
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    /* we eventually may want to update playing voices here */
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_monophonic
+ */
+char *
+hexter_instance_handle_monophonic(hexter_instance_t *instance, const char *value)
+{
+    int mode = -1;
+
+    if (!strcmp(value, "on")) mode = DSSP_MONO_MODE_ON;
+    else if (!strcmp(value, "once")) mode = DSSP_MONO_MODE_ONCE;
+    else if (!strcmp(value, "both")) mode = DSSP_MONO_MODE_BOTH;
+    else if (!strcmp(value, "off"))  mode = DSSP_MONO_MODE_OFF;
+
+    if (mode == -1) {
+        return dssp_error_message("error: monophonic value not recognized");
+    }
+    if (mode != DSSP_MONO_MODE_OFF && HEXTER_INSTANCE_MULTITIMBRAL(instance)) {
+        return dssp_error_message("error: monophonic mode is not available while multitimbral");
+    }
+
+    if (mode == DSSP_MONO_MODE_OFF) {  /* polyphonic mode */
+
+        instance->monophonic = 0;
+        instance->max_voices = instance->polyphony;
+
+    } else {  /* one of the monophonic modes */
+
+        if (!instance->monophonic) {
+
+            dssp_voicelist_mutex_lock(instance);
+
+            hexter_instance_all_voices_off(instance);
+            instance->max_voices = 1;
+            instance->mono_voice = NULL;
+            hexter_instance_clear_held_keys(instance);
+            dssp_voicelist_mutex_unlock(instance);
+        }
+        instance->monophonic = mode;
+    }
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_allocate_voices
+ *
+ * Make sure the first 'count' voices exist, returning 0 if they could not
+ * all be allocated.  This is only called from non-real-time threads, and
+ * voices are not freed until cleanup, so a voice below max_voices is
+ * always in place for the audio thread.
+ */
+int
+hexter_instance_allocate_voices(hexter_instance_t *instance, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (!instance->voice[i]) {
+            instance->voice[i] = dx7_voice_new();
+            if (!instance->voice[i])
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * hexter_instance_rate_factor
+ *
+ * return the factor by which the instance's 'configure internal_rate'
+ * setting divides host rate 'host_rate'
+ */
+static int
+hexter_instance_rate_factor(hexter_instance_t *instance, float host_rate)
+{
+    int factor;
+
+    if (instance->rate_divisor)
+        return instance->rate_divisor;
+
+    factor = HEXTER_RESAMPLE_MAX_FACTOR;
+    while (factor > 1 && host_rate / (float)factor < HEXTER_INTERNAL_RATE_MIN)
+        factor /= 2;
+    return factor;
+}
+
+/*
+ * hexter_instance_init_rate
+ *
+ * set everything that depends on the sample rate, for voices rendering at
+ * host rate 'host_rate' divided by 'factor'
+ */
+static void
+hexter_instance_init_rate(hexter_instance_t *instance, float host_rate,
+                          int factor)
+{
+    instance->host_rate = host_rate;
+    instance->sample_rate = host_rate / (float)factor;
+    instance->nugget_frames = HEXTER_NUGGET_SIZE * factor;
+    hexter_resampler_init(&instance->resampler, factor);
+    dx7_eg_init_constants(instance);
+    instance->declick_frames = lrintf(HEXTER_DECLICK_TIME * instance->sample_rate);
+    if (instance->declick_frames < 1)
+        instance->declick_frames = 1;
+}
+
+/*
+ * hexter_instance_new
+ *
+ * return a new instance, playing the built-in patches at the given sample
+ * rate, or NULL if out of memory
+ */
+hexter_instance_t *
+hexter_instance_new(unsigned long sample_rate)
+{
+    hexter_instance_t *instance;
+    int i;
+
+    instance = (hexter_instance_t *)calloc(1, sizeof(hexter_instance_t));
+    if (!instance) {
+        return NULL;
+    }
+
+    /* voices beyond the default polyphony are allocated when the
+     * polyphony is raised */
+    if (!hexter_instance_allocate_voices(instance, HEXTER_DEFAULT_POLYPHONY))
+        goto out_of_memory;
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        instance->ghost[i] = dx7_voice_new();
+        if (!instance->ghost[i])
+            goto out_of_memory;
+    }
+    /* start with the built-in patches, which all instances share */
+    if (!(instance->bank = hexter_bank_builtin()))
+        goto out_of_memory;
+    instance->patches = hexter_bank_patches(instance->bank);
+
+    instance->rate_divisor = 1;
+    hexter_instance_init_rate(instance, (float)sample_rate, 1);
+    instance->nugget_remains = 0;
+    instance->pool = instance;
+
+    instance->note_id = 0;
+    instance->polyphony = HEXTER_DEFAULT_POLYPHONY;
+    instance->monophonic = DSSP_MONO_MODE_OFF;
+    instance->max_voices = instance->polyphony;
+    instance->current_voices = 0;
+    instance->last_key = 0;
+    instance->budget_slot = -1;
+    instance->declick = 1;
+    instance->quality = DX7_QUALITY_STANDARD;
+    pthread_mutex_init(&instance->voicelist_mutex, NULL);
+    instance->voicelist_mutex_grab_failed = 0;
+    pthread_mutex_init(&instance->patches_mutex, NULL);
+    instance->pending_program_change = -1;
+    instance->pending_bank_change = 0;
+    instance->current_bank = 0;
+    instance->current_program = 0;
+    instance->overlay_program = -1;
+    hexter_data_performance_init(instance->performance_buffer);
+
+    hexter_instance_select_program(instance, 0, 0);
+    hexter_instance_init_controls(instance);
+
+    return instance;
+
+  out_of_memory:
+    DEBUG_MESSAGE(-1, " hexter_instance_new: out of memory!\n");
+    hexter_instance_free(instance);
+    return NULL;
+}
+
+/*
+ * hexter_instance_free
+ */
+void
+hexter_instance_free(hexter_instance_t *instance)
+{
+    int i;
+
+    if (instance->budget_slot >= 0)
+        hexter_budget_leave(instance->budget_slot, instance->current_voices);
+    for (i = 1; i < HEXTER_PARTS; i++)
+        free(instance->part[i]);
+    hexter_bank_release(instance->bank);
+    hexter_library_close(instance->library);
+    hexter_onset_cache_free(instance->onset_cache);
+    for (i = 0; i < HEXTER_MAX_POLYPHONY; i++) {
+        if (instance->voice[i]) {
+            free(instance->voice[i]);
+            instance->voice[i] = NULL;
+        }
+    }
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        if (instance->ghost[i]) {
+            free(instance->ghost[i]);
+            instance->ghost[i] = NULL;
+        }
+    }
+    free(instance);
+}
+
+/*
+ * hexter_instance_set_sample_rate
+ *
+ * change the sample rate, silencing all voices
+ */
+void
+hexter_instance_set_sample_rate(hexter_instance_t *instance,
+                                unsigned long sample_rate)
+{
+    int i;
+
+    dssp_voicelist_mutex_lock(instance);
+
+    hexter_instance_all_voices_off(instance);
+    hexter_instance_init_rate(instance, (float)sample_rate,
+                              hexter_instance_rate_factor(instance, (float)sample_rate));
+    /* parts' voices render into the instance's resampler */
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++)
+        hexter_instance_init_rate(instance->part[i], instance->sample_rate, 1);
+    instance->nugget_remains = 0;
+    dx7_lfo_reset(instance);
+    hexter_instance_reset_parts(instance);
+
+    dssp_voicelist_mutex_unlock(instance);
+}
+
+/*
+ * hexter_instance_reset_parts
+ *
+ * give each of a multitimbral instance's parts' LFOs a fresh start, as
+ * dx7_lfo_reset() does the instance's own
+ */
+void
+hexter_instance_reset_parts(hexter_instance_t *instance)
+{
+    int i;
+
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++)
+        dx7_lfo_reset(instance->part[i]);
+}
+
+/*
+ * hexter_instance_new_part
+ *
+ * return a new part for MIDI channel 'channel' of multitimbral instance
+ * 'instance', in the state of a new instance, or NULL if out of memory.
+ * A part has no voices, patches or mutexes of its own, only the state of
+ * its channel.
+ */
+static hexter_instance_t *
+hexter_instance_new_part(hexter_instance_t *instance, int channel)
+{
+    hexter_instance_t *part;
+
+    part = (hexter_instance_t *)calloc(1, sizeof(hexter_instance_t));
+    if (!part)
+        return NULL;
+
+    part->pool = instance;
+    part->output = instance->output;
+    part->tuning = instance->tuning;
+    part->volume = instance->volume;
+    hexter_instance_init_rate(part, instance->sample_rate, 1);
+    part->monophonic = DSSP_MONO_MODE_OFF;
+    part->last_key = 0;
+    hexter_instance_clear_held_keys(part);
+    part->pending_program_change = -1;
+    part->current_bank = 0;
+    part->current_program = 0;
+    part->overlay_program = -1;
+    memcpy(part->performance_buffer, instance->performance_buffer, DX7_PERFORMANCE_SIZE);
+    hexter_instance_set_performance_data(part);
+
+    hexter_instance_select_program(part, 0, 0);
+    hexter_instance_init_controls(part);
+    dx7_lfo_reset(part);
+
+    DEBUG_MESSAGE(DB_DSSI, " hexter_instance_new_part: part for channel %d\n", channel + 1);
+    return part;
+}
+
+/*
+ * hexter_instance_handle_multitimbral
+ *
+ * 'configure multitimbral on' has the instance play each MIDI channel
+ * with a part of its own, all sharing the instance's voices: a voice goes
+ * to whichever part needs it, and the parts render in one pass, with the
+ * LFOs of parts that have no voices playing left idle.  Channel 1 is the
+ * instance's own part, the one the host's program selection and the GUI's
+ * edit buffer apply to; the others follow program changes, and all take
+ * the 'performance' parameters.  Snapshots hold all the parts.  Monophonic mode is not
+ * available while multitimbral.
+ */
+char *
+hexter_instance_handle_multitimbral(hexter_instance_t *instance, const char *value)
+{
+    hexter_instance_t *parts[HEXTER_PARTS];
+    int multitimbral, i;
+
+    if (!strcmp(value, "on")) multitimbral = 1;
+    else if (!strcmp(value, "off")) multitimbral = 0;
+    else
+        return dssp_error_message("error: multitimbral value not recognized");
+
+    if (multitimbral == HEXTER_INSTANCE_MULTITIMBRAL(instance))
+        return NULL;
+    if (multitimbral && instance->monophonic)
+        return dssp_error_message("error: multitimbral operation is not available in monophonic mode");
+
+    /* parts are made and freed outside the locks, since the audio thread
+     * never waits */
+    memset(parts, 0, sizeof(parts));
+    if (multitimbral) {
+        parts[0] = instance;
+        pthread_mutex_lock(&instance->patches_mutex);
+        for (i = 1; i < HEXTER_PARTS; i++) {
+            parts[i] = hexter_instance_new_part(instance, i);
+            if (!parts[i]) {
+                pthread_mutex_unlock(&instance->patches_mutex);
+                while (--i > 0)
+                    free(parts[i]);
+                return dssp_error_message("error: out of memory allocating parts");
+            }
+        }
+        pthread_mutex_unlock(&instance->patches_mutex);
+    }
+
+    dssp_voicelist_mutex_lock(instance);
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    hexter_instance_all_voices_off(instance);
+    if (multitimbral) {
+        memcpy(instance->part, parts, sizeof(parts));
+    } else {
+        memcpy(parts, instance->part, sizeof(parts));
+        memset(instance->part, 0, sizeof(parts));
+    }
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+    dssp_voicelist_mutex_unlock(instance);
+
+    if (!multitimbral) {
+        for (i = 1; i < HEXTER_PARTS; i++)
+            free(parts[i]);
+    }
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_polyphony
+ */
+char *
+hexter_instance_handle_polyphony(hexter_instance_t *instance, const char *value)
+{
+    int polyphony = atoi(value);
+    int i;
+    dx7_voice_t *voice;
+
+    if (polyphony < 1 || polyphony > HEXTER_MAX_POLYPHONY) {
+        return dssp_error_message("error: polyphony value out of range");
+    }
+    if (!hexter_instance_allocate_voices(instance, polyphony)) {
+        return strdup("error: out of memory allocating voices");
+    }
+    /* set the new limit */
+    instance->polyphony = polyphony;
+
+    if (!instance->monophonic) {
+
+        dssp_voicelist_mutex_lock(instance);
+
+        instance->max_voices = polyphony;
+
+        /* turn off any voices above the new limit */
         for (i = polyphony; i < HEXTER_MAX_POLYPHONY; i++) {
             voice = instance->voice[i];
-            if (_PLAYING(voice)) {
+            if (voice && _PLAYING(voice)) {
                 if (instance->held_keys[0] != -1)
                     hexter_instance_clear_held_keys(instance);
                 dx7_voice_off(voice);
@@ -1048,30 +2020,810 @@ hexter_instance_handle_polyphony(hexter_instance_t *instance, const char *value)
 }
 
 /*
- * hexter_instance_render_voices
+ * hexter_instance_handle_governor
+ *
+ * 'configure governor on' lets the voice limit follow the measured CPU load,
+ * see hexter_instance_update_load().  Note that a session recorded with the
+ * governor on will not replay bit-identically, since its voice stealing
+ * depends on timing.
+ */
+char *
+hexter_instance_handle_governor(hexter_instance_t *instance, const char *value)
+{
+    int governor;
+
+    if (!strcmp(value, "on")) governor = 1;
+    else if (!strcmp(value, "off")) governor = 0;
+    else
+        return dssp_error_message("error: governor value not recognized");
+
+    dssp_voicelist_mutex_lock(instance);
+
+    if (governor && !instance->governor) {
+        instance->voice_limit = instance->max_voices;
+        instance->governor_holdoff = 0;
+    }
+    instance->governor = governor;
+
+    dssp_voicelist_mutex_unlock(instance);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_declick
+ *
+ * 'configure declick off' returns to cutting off stolen voices instantly
+ */
+char *
+hexter_instance_handle_declick(hexter_instance_t *instance, const char *value)
+{
+    if (!strcmp(value, "on"))
+        instance->declick = 1;
+    else if (!strcmp(value, "off"))
+        instance->declick = 0;
+    else
+        return dssp_error_message("error: declick value not recognized");
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_quality
+ *
+ * 'configure quality eco' trades accuracy for speed, for background parts
+ * or small machines, and 'configure quality high' speed for accuracy; see
+ * DX7_QUALITY_* in dx7_voice.h.  The default is 'standard'.  The change
+ * takes effect from the next run.
+ */
+char *
+hexter_instance_handle_quality(hexter_instance_t *instance, const char *value)
+{
+    if (!strcmp(value, "eco"))
+        instance->quality = DX7_QUALITY_ECO;
+    else if (!strcmp(value, "standard"))
+        instance->quality = DX7_QUALITY_STANDARD;
+    else if (!strcmp(value, "high"))
+        instance->quality = DX7_QUALITY_HIGH;
+    else
+        return dssp_error_message("error: quality value not recognized");
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_lod
+ *
+ * 'configure lod <eco dB> [<carriers dB>]' has voices whose output level
+ * estimate is below <eco dB> (relative to full scale) render at eco
+ * quality, and those below <carriers dB> render with their carriers alone,
+ * unmodulated; 'configure lod off' renders all voices in full.
+ */
+char *
+hexter_instance_handle_lod(hexter_instance_t *instance, const char *value)
+{
+    float eco_db, carriers_db;
+    int n;
+
+    if (!strcmp(value, "off")) {
+        instance->lod_eco_level = 0.0f;
+        instance->lod_carriers_level = 0.0f;
+        return NULL;
+    }
+
+    n = sscanf(value, "%f %f", &eco_db, &carriers_db);
+    if (n < 1 || eco_db > 0.0f || eco_db < -120.0f ||
+        (n == 2 && (carriers_db > eco_db || carriers_db < -120.0f)))
+        return dssp_error_message("error: lod value out of range");
+
+    instance->lod_eco_level = powf(10.0f, eco_db / 20.0f);
+    instance->lod_carriers_level = (n == 2 ? powf(10.0f, carriers_db / 20.0f) : 0.0f);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_wavetable
+ *
+ * 'configure wavetable on' has voices that reach a steady state play one
+ * captured period over and over, instead of running their operators, until
+ * anything changes; see DX7_WAVETABLE_* in dx7_voice.h.  The default is
+ * 'off'.
+ */
+char *
+hexter_instance_handle_wavetable(hexter_instance_t *instance, const char *value)
+{
+    if (!strcmp(value, "on"))
+        instance->wavetable = 1;
+    else if (!strcmp(value, "off"))
+        instance->wavetable = 0;
+    else
+        return dssp_error_message("error: wavetable value not recognized");
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_onset_cache
+ *
+ * 'configure onset_cache <entries> <ms>' has notes record their first
+ * <ms> milliseconds into a cache of <entries>, and replay them when a
+ * later note starts from the same state; see hexter_onset.h.  The length
+ * is taken at the sample rate the voices render at when configured.  The
+ * default is 'off'.
+ */
+char *
+hexter_instance_handle_onset_cache(hexter_instance_t *instance, const char *value)
+{
+    hexter_onset_cache_t *cache = NULL, *old;
+    int entries, time, i;
+
+    if (strcmp(value, "off")) {
+        if (sscanf(value, "%d %d", &entries, &time) != 2 ||
+            entries < 1 || entries > HEXTER_ONSET_MAX_ENTRIES ||
+            time < 1 || time > HEXTER_ONSET_MAX_TIME)
+            return dssp_error_message("error: onset_cache value out of range");
+
+        /* the cache is made and freed outside the lock, since the audio
+         * thread never waits */
+        cache = hexter_onset_cache_new(entries,
+                                       lrintf(instance->sample_rate * (float)time / 1000.0f),
+                                       DX7_VOICE_STATE_SIZE);
+        if (!cache)
+            return dssp_error_message("error: out of memory allocating the onset cache");
+    }
+
+    dssp_voicelist_mutex_lock(instance);
+    old = instance->onset_cache;
+    instance->onset_cache = cache;
+    for (i = 0; i < HEXTER_MAX_POLYPHONY; i++)
+        if (instance->voice[i])
+            instance->voice[i]->onset.state = DX7_ONSET_NONE;
+    dssp_voicelist_mutex_unlock(instance);
+
+    hexter_onset_cache_free(old);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_internal_rate
+ *
+ * 'configure internal_rate half' or 'quarter' has the voices render at
+ * that fraction of the host rate, resampled once per instance to the host
+ * rate; 'auto' picks the lowest fraction of at least
+ * HEXTER_INTERNAL_RATE_MIN, and 'host' (the default) renders at the host
+ * rate.  A change silences all voices.
+ */
+char *
+hexter_instance_handle_internal_rate(hexter_instance_t *instance,
+                                     const char *value)
+{
+    int divisor;
+
+    if (!strcmp(value, "host"))
+        divisor = 1;
+    else if (!strcmp(value, "half"))
+        divisor = 2;
+    else if (!strcmp(value, "quarter"))
+        divisor = 4;
+    else if (!strcmp(value, "auto"))
+        divisor = 0;
+    else
+        return dssp_error_message("error: internal_rate value not recognized");
+
+    instance->rate_divisor = divisor;
+    if (hexter_instance_rate_factor(instance, instance->host_rate) !=
+            instance->resampler.factor)
+        hexter_instance_set_sample_rate(instance, (unsigned long)instance->host_rate);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_global_polyphony
+ *
+ * 'configure global_polyphony <n>' has the instance join the global voice
+ * budget (see hexter_budget.h), and sets the budget, for all instances in
+ * it, to n voices; 'configure global_polyphony 0' has it leave.  The
+ * instance's own polyphony still applies as well.
+ */
+char *
+hexter_instance_handle_global_polyphony(hexter_instance_t *instance,
+                                        const char *value)
+{
+    int polyphony = atoi(value);
+    int slot;
+
+    if (polyphony < 0 || polyphony > HEXTER_MAX_POLYPHONY * HEXTER_BUDGET_SLOTS)
+        return dssp_error_message("error: global polyphony value out of range");
+
+    if (polyphony)
+        hexter_budget_set_limit(polyphony);
+
+    /* joining or leaving moves the instance's playing voices into or out of
+     * the count, so the audio thread must not change them meanwhile */
+    if (polyphony && instance->budget_slot < 0) {
+
+        dssp_voicelist_mutex_lock(instance);
+        slot = hexter_budget_join(instance->current_voices);
+        instance->budget_slot = slot;
+        dssp_voicelist_mutex_unlock(instance);
+        if (slot < 0)
+            return dssp_error_message("error: global voice budget has no room for more instances");
+
+    } else if (!polyphony && instance->budget_slot >= 0) {
+
+        dssp_voicelist_mutex_lock(instance);
+        hexter_budget_leave(instance->budget_slot, instance->current_voices);
+        instance->budget_slot = -1;
+        dssp_voicelist_mutex_unlock(instance);
+    }
+
+    return NULL; /* success */
+}
+
+/* the block of LFO state in hexter_instance_t, lfo_speed through lfo_buffer */
+#define LFO_STATE_OFFSET  offsetof(hexter_instance_t, lfo_speed)
+#define LFO_STATE_SIZE    (offsetof(hexter_instance_t, lfo_buffer) + \
+                           sizeof(((hexter_instance_t *)0)->lfo_buffer) - \
+                           LFO_STATE_OFFSET)
+
+/*
+ * hexter_freeze_t
+ *
+ * Playing voices and the state they depend on, as saved alongside a
+ * snapshot to 'freeze' an instance.  Unlike hexter_snapshot_t this holds
+ * native types, so it can only be restored within the same process (or at
+ * least the same build), and at the same sample rate.
+ */
+struct _hexter_freeze_t
+{
+    float           host_rate;
+    float           sample_rate;
+    int             count;             /* voices saved */
+    dx7_voice_t     voice[HEXTER_MAX_POLYPHONY];
+    int             mono_voice;        /* index of the instance's mono_voice, or -1 */
+    int             current_voices;
+    unsigned int    note_id;
+    unsigned char   last_key;
+    signed char     held_keys[8];
+    unsigned long   nugget_remains;
+    uint8_t         lfo_state[LFO_STATE_SIZE];
+    hexter_resampler_t resampler;
+};
+
+/*
+ * hexter_freeze_new
+ *
+ * return storage for a frozen instance's voices, or NULL if out of memory
+ */
+hexter_freeze_t *
+hexter_freeze_new(void)
+{
+    return (hexter_freeze_t *)calloc(1, sizeof(hexter_freeze_t));
+}
+
+/*
+ * hexter_freeze_free
+ */
+void
+hexter_freeze_free(hexter_freeze_t *freeze)
+{
+    free(freeze);
+}
+
+/*
+ * hexter_snapshot_save_channel
+ *
+ * save a part's program and controllers to the snapshot members pointed to
+ */
+static void
+hexter_snapshot_save_channel(hexter_instance_t *part, uint8_t *current_bank,
+                             uint8_t *current_program, uint8_t *channel_pressure,
+                             uint8_t *pitch_wheel, uint8_t *cc,
+                             uint8_t *key_pressure)
+{
+    unsigned int bank = part->current_bank,
+                 wheel = part->pitch_wheel + 8192;
+    int i;
+
+    for (i = 0; i < 3; i++, bank >>= 7)
+        current_bank[i] = bank & 0x7f;
+    *current_program = part->current_program;
+    *channel_pressure = part->channel_pressure & 0x7f;
+    pitch_wheel[0] = wheel & 0x7f;
+    pitch_wheel[1] = (wheel >> 7) & 0x7f;
+    memcpy(cc, part->cc, 128);
+    memcpy(key_pressure, part->key_pressure, 128);
+}
+
+/*
+ * hexter_snapshot_restore_channel
+ *
+ * Restore a part's program and controllers from the snapshot members
+ * pointed to.  Called with the voicelist and patches mutexes held.
+ */
+static void
+hexter_snapshot_restore_channel(hexter_instance_t *part,
+                                const uint8_t *current_bank,
+                                uint8_t current_program, uint8_t channel_pressure,
+                                const uint8_t *pitch_wheel, const uint8_t *cc,
+                                const uint8_t *key_pressure)
+{
+    unsigned long bank = current_bank[0] | (current_bank[1] << 7) |
+                         (current_bank[2] << 14);
+
+    if (bank &&
+        !hexter_library_patch(part->pool->library, (bank - 1) * 128 + current_program))
+        bank = 0;  /* not in this instance's library */
+    hexter_instance_select_program(part, bank, current_program);
+
+    memcpy(part->cc, cc, 128);
+    memcpy(part->key_pressure, key_pressure, 128);
+    part->channel_pressure = channel_pressure;
+    hexter_instance_update_mod_wheel(part);
+    hexter_instance_update_breath(part);
+    hexter_instance_update_foot(part);
+    hexter_instance_update_volume(part);
+    hexter_instance_pitch_bend(part, (pitch_wheel[0] | (pitch_wheel[1] << 7)) - 8192);
+}
+
+/*
+ * hexter_instance_save_snapshot
+ *
+ * Save the instance's state to 'snapshot', and, if 'freeze' is not NULL,
+ * its playing voices to 'freeze'.  Only freezing needs to lock out the
+ * audio thread; the controller values are single bytes, so a snapshot
+ * taken while they change holds each either before or after the change.
+ */
+void
+hexter_instance_save_snapshot(hexter_instance_t *instance,
+                              hexter_snapshot_t *snapshot,
+                              hexter_freeze_t *freeze)
+{
+    hexter_snapshot_part_t *part;
+    int i;
+
+    if (freeze)
+        dssp_voicelist_mutex_lock(instance);
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    snapshot->version = HEXTER_SNAPSHOT_VERSION;
+    snapshot->polyphony = instance->polyphony;
+    snapshot->monophonic = instance->monophonic;
+    hexter_snapshot_save_channel(instance, snapshot->current_bank,
+                                 &snapshot->current_program,
+                                 &snapshot->channel_pressure, snapshot->pitch_wheel,
+                                 snapshot->cc, snapshot->key_pressure);
+    snapshot->overlay = (instance->overlay_program >= 0);
+    snapshot->overlay_program = snapshot->overlay ? instance->overlay_program : 0;
+    memcpy(snapshot->performance, instance->performance_buffer, DX7_PERFORMANCE_SIZE);
+    memcpy(snapshot->overlay_patch, instance->overlay_patch_buffer, DX7_VOICE_SIZE_UNPACKED);
+    memcpy(snapshot->patches, instance->patches, 128 * DX7_VOICE_SIZE_PACKED);
+    snapshot->multitimbral = HEXTER_INSTANCE_MULTITIMBRAL(instance);
+    memset(snapshot->part, 0, sizeof(snapshot->part));
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        part = &snapshot->part[i - 1];
+        hexter_snapshot_save_channel(instance->part[i], part->current_bank,
+                                     &part->current_program, &part->channel_pressure,
+                                     part->pitch_wheel, part->cc, part->key_pressure);
+    }
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+
+    if (freeze) {
+        freeze->host_rate = instance->host_rate;
+        freeze->sample_rate = instance->sample_rate;
+        freeze->count = instance->polyphony;
+        freeze->mono_voice = -1;
+        for (i = 0; i < freeze->count; i++) {
+            memcpy(&freeze->voice[i], instance->voice[i], sizeof(dx7_voice_t));
+            if (instance->voice[i] == instance->mono_voice)
+                freeze->mono_voice = i;
+        }
+        freeze->current_voices = instance->current_voices;
+        freeze->note_id = instance->note_id;
+        freeze->last_key = instance->last_key;
+        memcpy(freeze->held_keys, instance->held_keys, 8);
+        freeze->nugget_remains = instance->nugget_remains;
+        memcpy(freeze->lfo_state, (uint8_t *)instance + LFO_STATE_OFFSET, LFO_STATE_SIZE);
+        freeze->resampler = instance->resampler;
+
+        dssp_voicelist_mutex_unlock(instance);
+    }
+}
+
+/*
+ * hexter_instance_restore_snapshot
+ *
+ * Restore the state saved by hexter_instance_save_snapshot(), by this or
+ * any other instance, with the voices in 'freeze' playing on if it is not
+ * NULL, or all voices silenced if it is.  Everything that can fail, or
+ * takes time (checking the snapshot, allocating voices, finding or
+ * creating the shared bank), is done first; the new state is then swapped
+ * in with the audio thread locked out, so no run sees part of it.
+ */
+char *
+hexter_instance_restore_snapshot(hexter_instance_t *instance,
+                                 const hexter_snapshot_t *snapshot,
+                                 const hexter_freeze_t *freeze)
+{
+    hexter_bank_t *bank, *old_bank;
+    const hexter_snapshot_part_t *part;
+    int polyphony = snapshot->polyphony;
+    int multitimbral, i;
+    char *errmsg;
+
+    if (snapshot->version < 1 || snapshot->version > HEXTER_SNAPSHOT_VERSION)
+        return dssp_error_message("snapshot restore failed: unsupported version %d",
+                                  snapshot->version);
+    /* a version 1 snapshot leaves the parts as they are */
+    if (snapshot->version >= 2)
+        multitimbral = snapshot->multitimbral;
+    else
+        multitimbral = HEXTER_INSTANCE_MULTITIMBRAL(instance);
+    if (polyphony < 1 || polyphony > HEXTER_MAX_POLYPHONY ||
+        snapshot->monophonic > DSSP_MONO_MODE_BOTH || multitimbral > 1)
+        return dssp_error_message("snapshot restore failed: corrupt data");
+    if (freeze && (freeze->host_rate != instance->host_rate ||
+                   freeze->sample_rate != instance->sample_rate ||
+                   freeze->count > polyphony))
+        return dssp_error_message("snapshot restore failed: frozen voices do not fit this instance");
+    if (multitimbral && (freeze || snapshot->monophonic))
+        return dssp_error_message("snapshot restore failed: frozen or monophonic state can not be restored while multitimbral");
+    if (!hexter_instance_allocate_voices(instance, polyphony))
+        return strdup("error: out of memory allocating voices");
+    if (multitimbral != HEXTER_INSTANCE_MULTITIMBRAL(instance) &&
+        (errmsg = hexter_instance_handle_multitimbral(instance, multitimbral ? "on" : "off")))
+        return errmsg;
+    bank = hexter_bank_get((const dx7_patch_t *)snapshot->patches);
+    if (!bank)
+        return dssp_error_message("snapshot restore failed: out of memory");
+
+    dssp_voicelist_mutex_lock(instance);
+    pthread_mutex_lock(&instance->patches_mutex);
+
+    /* patches, edit buffer and performance parameters */
+    old_bank = instance->bank;
+    instance->bank = bank;
+    instance->patches = hexter_bank_patches(bank);
+    instance->patches_configured = 1;
+    instance->patch_delta_version = 0;
+    instance->patch_delta_count = 0;
+    instance->pending_program_change = -1;
+    instance->overlay_program = snapshot->overlay ? snapshot->overlay_program : -1;
+    memcpy(instance->overlay_patch_buffer, snapshot->overlay_patch, DX7_VOICE_SIZE_UNPACKED);
+    memcpy(instance->performance_buffer, snapshot->performance, DX7_PERFORMANCE_SIZE);
+    hexter_instance_set_performance_data(instance);
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        memcpy(instance->part[i]->performance_buffer, instance->performance_buffer,
+               DX7_PERFORMANCE_SIZE);
+        hexter_instance_set_performance_data(instance->part[i]);
+    }
+    hexter_instance_update_parts(instance);
+
+    /* programs and controllers */
+    hexter_snapshot_restore_channel(instance, snapshot->current_bank,
+                                    snapshot->current_program,
+                                    snapshot->channel_pressure, snapshot->pitch_wheel,
+                                    snapshot->cc, snapshot->key_pressure);
+    if (snapshot->version >= 2) {
+        for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+            part = &snapshot->part[i - 1];
+            hexter_snapshot_restore_channel(instance->part[i], part->current_bank,
+                                            part->current_program,
+                                            part->channel_pressure, part->pitch_wheel,
+                                            part->cc, part->key_pressure);
+        }
+    }
+
+    /* voices */
+    hexter_instance_all_voices_off(instance);
+    instance->polyphony = polyphony;
+    instance->monophonic = snapshot->monophonic;
+    instance->max_voices = instance->monophonic ? 1 : polyphony;
+    instance->mono_voice = NULL;
+    if (freeze) {
+        for (i = 0; i < freeze->count; i++) {
+            memcpy(instance->voice[i], &freeze->voice[i], sizeof(dx7_voice_t));
+            instance->voice[i]->instance = instance;
+            instance->voice[i]->onset.state = DX7_ONSET_NONE;  /* its entry may be gone */
+        }
+        if (freeze->mono_voice >= 0)
+            instance->mono_voice = instance->voice[freeze->mono_voice];
+        if (instance->budget_slot >= 0)
+            hexter_budget_count(freeze->current_voices - instance->current_voices);
+        instance->current_voices = freeze->current_voices;
+        instance->note_id = freeze->note_id;
+        instance->last_key = freeze->last_key;
+        memcpy(instance->held_keys, freeze->held_keys, 8);
+        instance->nugget_remains = freeze->nugget_remains;
+        memcpy((uint8_t *)instance + LFO_STATE_OFFSET, freeze->lfo_state, LFO_STATE_SIZE);
+        instance->resampler = freeze->resampler;
+    }
+
+    pthread_mutex_unlock(&instance->patches_mutex);
+    dssp_voicelist_mutex_unlock(instance);
+
+    hexter_bank_release(old_bank);
+
+    return NULL; /* success */
+}
+
+/*
+ * hexter_instance_handle_snapshot
+ *
+ * 'configure snapshot' restores, in one step, a 7-in-6 encoded
+ * hexter_snapshot_t, of either version
+ */
+char *
+hexter_instance_handle_snapshot(hexter_instance_t *instance, const char *value)
+{
+    hexter_snapshot_t *snapshot;
+    char *errmsg;
+
+    DEBUG_MESSAGE(DB_DATA, " hexter_instance_handle_snapshot: received new snapshot\n");
+
+    snapshot = (hexter_snapshot_t *)malloc(sizeof(hexter_snapshot_t));
+    if (!snapshot)
+        return dssp_error_message("snapshot restore failed: out of memory");
+
+    /* the shorter version 1 snapshot is still accepted */
+    if (!decode_7in6(value, sizeof(hexter_snapshot_t), (uint8_t *)snapshot) &&
+        !(decode_7in6(value, HEXTER_SNAPSHOT_V1_SIZE, (uint8_t *)snapshot) &&
+          snapshot->version == 1))
+        errmsg = dssp_error_message("snapshot restore failed: corrupt data");
+    else
+        errmsg = hexter_instance_restore_snapshot(instance, snapshot, NULL);
+
+    free(snapshot);
+    return errmsg;
+}
+
+/*
+ * hexter_synth_shed_voices
+ *
+ * turn off voices until the instance is within a lowered governor limit,
+ * taking the quietest released voices first
+ */
+static void
+hexter_synth_shed_voices(hexter_instance_t *instance)
+{
+    int i;
+    dx7_voice_t *voice, *quietest;
+
+    while (instance->current_voices > instance->voice_limit) {
+
+        quietest = NULL;
+        for (i = 0; i < instance->max_voices; i++) {
+            voice = instance->voice[i];
+            if (_RELEASED(voice) && (!quietest || voice->level < quietest->level))
+                quietest = voice;
+        }
+
+        if (quietest) {
+            DEBUG_MESSAGE(DB_NOTE, " hexter_synth_shed_voices: killing released voice note id %d\n", quietest->note_id);
+            if (instance->declick)
+                hexter_synth_ghost_voice(instance, quietest);
+            dx7_voice_off(quietest);
+        } else if (!hexter_synth_free_voice_by_kill(instance)) {
+            break;
+        }
+        instance->stats.governor_steals++;
+    }
+}
+
+/*
+ * hexter_synth_budget_settle
+ *
+ * give up the voices other instances in the global voice budget have
+ * charged this one, then publish the priority of its weakest voice
+ */
+static void
+hexter_synth_budget_settle(hexter_instance_t *instance)
+{
+    int debt = hexter_budget_collect(instance->budget_slot);
+    dx7_voice_t *voice;
+    uint64_t priority;
+
+    while (debt-- > 0) {
+        voice = hexter_synth_budget_weakest(instance, &priority);
+        if (!voice)
+            break;
+        hexter_synth_budget_kill(instance, voice);
+    }
+    hexter_synth_budget_weakest(instance, &priority);
+    hexter_budget_publish(instance->budget_slot, priority);
+}
+
+/*
+ * hexter_instance_update_load
+ *
+ * called at the end of each run, with the voicelist mutex held, with the
+ * wall-clock time that run took to render.  Updates the load statistics,
+ * settles with the global voice budget if the instance has joined it, and,
+ * if the governor is on, lowers or raises the voice limit.
  */
 void
-hexter_instance_render_voices(hexter_instance_t *instance, unsigned long samples_done,
-                              unsigned long sample_count, int do_control_update)
+hexter_instance_update_load(hexter_instance_t *instance,
+                            unsigned long sample_count, double seconds)
+{
+    hexter_stats_t *stats = &instance->stats;
+    float load, weight;
+    int limit;
+
+    if (!sample_count)
+        return;
+
+    load = (float)(seconds * (double)instance->host_rate / (double)sample_count);
+    weight = (float)((double)sample_count /
+                     (HEXTER_GOVERNOR_TIME_CONSTANT * (double)instance->host_rate));
+    if (weight > 1.0f)
+        weight = 1.0f;
+    stats->load += (load - stats->load) * weight;
+    if (load > stats->peak_load)
+        stats->peak_load = load;
+    stats->runs++;
+    stats->frames += sample_count;
+
+    if (instance->budget_slot >= 0)
+        hexter_synth_budget_settle(instance);
+
+    if (!instance->governor) {
+        stats->governor_action = HEXTER_GOVERNOR_OFF;
+        return;
+    }
+
+    stats->governor_action = HEXTER_GOVERNOR_HOLD;
+    if (instance->voice_limit > instance->max_voices)
+        instance->voice_limit = instance->max_voices;  /* polyphony was lowered */
+
+    /* give the smoothed load time to reflect the last change */
+    if (instance->governor_holdoff > sample_count) {
+        instance->governor_holdoff -= sample_count;
+        return;
+    }
+    instance->governor_holdoff = 0;
+
+    if (stats->load > HEXTER_GOVERNOR_HIGH_LOAD &&
+        instance->voice_limit > HEXTER_GOVERNOR_MIN_VOICES) {
+
+        /* a limit above the number of voices playing would shed nothing */
+        limit = instance->voice_limit;
+        if (limit > instance->current_voices)
+            limit = instance->current_voices;
+        limit--;
+        if (limit < HEXTER_GOVERNOR_MIN_VOICES)
+            limit = HEXTER_GOVERNOR_MIN_VOICES;
+        DEBUG_MESSAGE(DB_NOTE, " hexter_instance_update_load: load %f, lowering voice limit from %d to %d\n", stats->load, instance->voice_limit, limit);
+        instance->voice_limit = limit;
+        hexter_synth_shed_voices(instance);
+
+        stats->governor_action = HEXTER_GOVERNOR_LOWER;
+        stats->governor_lowered++;
+        instance->governor_holdoff = (unsigned long)(HEXTER_GOVERNOR_TIME_CONSTANT *
+                                                     instance->host_rate);
+
+    } else if (stats->load < HEXTER_GOVERNOR_LOW_LOAD &&
+               instance->voice_limit < instance->max_voices) {
+
+        instance->voice_limit++;
+        DEBUG_MESSAGE(DB_NOTE, " hexter_instance_update_load: load %f, raising voice limit to %d\n", stats->load, instance->voice_limit);
+
+        stats->governor_action = HEXTER_GOVERNOR_RAISE;
+        stats->governor_raised++;
+        instance->governor_holdoff = (unsigned long)(HEXTER_GOVERNOR_TIME_CONSTANT *
+                                                     instance->host_rate);
+    }
+}
+
+/*
+ * hexter_instance_get_stats
+ *
+ * copy out the instance's run-time statistics.  This may be called from
+ * any thread; the audio thread updates them without locking, so figures
+ * may come from different runs.
+ */
+void
+hexter_instance_get_stats(hexter_instance_t *instance, hexter_stats_t *stats)
+{
+    *stats = instance->stats;
+    stats->current_voices = instance->current_voices;
+    stats->max_voices = instance->max_voices;
+    stats->voice_limit = hexter_instance_voice_limit(instance);
+    stats->governor = instance->governor;
+}
+
+/*
+ * hexter_instance_render_voices_at
+ *
+ * render 'sample_count' samples of all playing voices into 'out', at the
+ * voices' sample rate
+ */
+static void
+hexter_instance_render_voices_at(hexter_instance_t *instance, float *out,
+                                 unsigned long sample_count, int do_control_update)
 {
     unsigned long i;
     dx7_voice_t* voice;
+    hexter_instance_t *part;
+
+    /* update the LFO (a burst may end a nugget without a new sample when
+     * resampling) */
+    if (sample_count)
+        dx7_lfo_update(instance, sample_count);
+
+    /* and those of any parts with voices playing, which follow the
+     * instance's ports */
+    for (i = 1; i < HEXTER_PARTS && instance->part[i]; i++) {
+        part = instance->part[i];
+        part->tuning = instance->tuning;
+        part->volume = instance->volume;
+        if (part->current_voices && sample_count)
+            dx7_lfo_update(part, sample_count);
+    }
 
-    /* update the LFO */
-    dx7_lfo_update(instance, sample_count);
+    /* the note-onset cache counts nuggets to tell which entries are still
+     * being recorded */
+    if (instance->onset_cache && do_control_update)
+        instance->onset_cache->clock++;
 
-    /* render each active voice */
+    /* render each active voice, with the state of the part it plays for */
     for (i = 0; i < instance->max_voices; i++) {
         voice = instance->voice[i];
 
         if (_PLAYING(voice)) {
-            if (voice->mods_serial != instance->mods_serial) {
-                dx7_voice_update_mod_depths(instance, voice);
-                voice->mods_serial = instance->mods_serial;
+            part = voice->instance;
+            if (voice->mods_serial != part->mods_serial) {
+                dx7_voice_update_mod_depths(part, voice);
+                voice->mods_serial = part->mods_serial;
             }
-            dx7_voice_render(instance, voice,
-                             instance->output + samples_done,
-                             sample_count, do_control_update);
+            dx7_voice_render(part, voice, out, sample_count, do_control_update);
+        }
+    }
+
+    /* fade out stolen voices */
+    for (i = 0; i < HEXTER_MAX_GHOSTS; i++) {
+        voice = instance->ghost[i];
+
+        if (voice->volume_duration) {
+            part = voice->instance;
+            /* keep a volume change from restarting the ramp */
+            voice->last_port_volume = *instance->volume;
+            voice->last_cc_volume = part->cc_volume;
+            dx7_voice_render(part, voice, out,
+                             (sample_count < voice->volume_duration ?
+                                  sample_count : voice->volume_duration), 0);
         }
     }
 }
+
+/*
+ * hexter_instance_render_voices
+ *
+ * render 'sample_count' host frames of all playing voices into the
+ * instance's output, from frame 'samples_done' on
+ */
+void
+hexter_instance_render_voices(hexter_instance_t *instance, unsigned long samples_done,
+                              unsigned long sample_count, int do_control_update)
+{
+    hexter_resampler_t *resampler = &instance->resampler;
+    unsigned long inputs;
+    float *in;
+
+    if (resampler->factor == 1) {
+        hexter_instance_render_voices_at(instance, instance->output + samples_done,
+                                         sample_count, do_control_update);
+        return;
+    }
+
+    /* render at the internal rate, then resample to the host rate */
+    inputs = hexter_resampler_inputs(resampler, sample_count);
+    in = hexter_resampler_input(resampler);
+    memset(in, 0, sizeof(float) * inputs);
+    hexter_instance_render_voices_at(instance, in, inputs, do_control_update);
+    hexter_resampler_run(resampler, inputs, instance->output + samples_done,
+                         sample_count);
+}
@@ -26,19 +26,107 @@
 #ifndef _HEXTER_SYNTH_H
 #define _HEXTER_SYNTH_H
 
+#include <stddef.h>
 #include <pthread.h>
 
-#include <ladspa.h>
-#include <dssi.h>
-
 #include "hexter_types.h"
 #include "hexter.h"
+#include "hexter_resample.h"
+#include "dx7_voice_data.h"
 
 #define DSSP_MONO_MODE_OFF  0
 #define DSSP_MONO_MODE_ON   1
 #define DSSP_MONO_MODE_ONCE 2
 #define DSSP_MONO_MODE_BOTH 3
 
+/* governor actions, as reported in hexter_stats_t */
+#define HEXTER_GOVERNOR_OFF    0   /* governor disabled */
+#define HEXTER_GOVERNOR_HOLD   1   /* voice limit left as it was */
+#define HEXTER_GOVERNOR_LOWER  2   /* voice limit lowered, and voices stolen to meet it */
+#define HEXTER_GOVERNOR_RAISE  3   /* voice limit raised */
+
+/*
+ * hexter_stats_t
+ *
+ * run-time statistics, as returned by hexter_instance_get_stats()
+ */
+struct _hexter_stats_t
+{
+    unsigned long   runs;              /* run_synth() calls that rendered */
+    unsigned long   frames;            /* frames rendered by those calls */
+    float           load;              /* smoothed render time as a fraction of the block deadline */
+    float           peak_load;         /* highest unsmoothed load seen */
+    int             current_voices;
+    int             max_voices;        /* requested polyphony, or 1 in monophonic mode */
+    int             voice_limit;       /* max_voices, as lowered by the governor */
+    int             governor;          /* true if the governor is enabled */
+    int             governor_action;   /* HEXTER_GOVERNOR_* action taken after the last run */
+    unsigned long   governor_lowered;  /* times the governor lowered the limit */
+    unsigned long   governor_raised;   /* times the governor raised the limit */
+    unsigned long   governor_steals;   /* voices stolen to meet a lowered limit */
+    unsigned long   steals;            /* voices stolen to make room for a new note */
+    unsigned long   declicks;          /* stolen voices faded out rather than cut off */
+    unsigned long   budget_steals;     /* voices given up to keep within the global voice budget */
+    unsigned long   lod_eco;           /* voice nuggets rendered at eco level of detail */
+    unsigned long   lod_carriers;      /* voice nuggets rendered with carriers alone */
+    unsigned long   wavetable;         /* voice nuggets played from a steady-state wavetable */
+    unsigned long   onset_hits;        /* voice bursts played from the note-onset cache */
+};
+
+#define HEXTER_SNAPSHOT_VERSION  2   /* version 1 ended before 'multitimbral' */
+
+/*
+ * hexter_snapshot_part_t
+ *
+ * the state of one of a multitimbral instance's parts 2 to 16: its
+ * program and controllers (its patches and performance parameters are the
+ * instance's)
+ */
+struct _hexter_snapshot_part_t
+{
+    uint8_t         current_bank[3];   /* as in hexter_snapshot_t */
+    uint8_t         current_program;
+    uint8_t         channel_pressure;
+    uint8_t         pitch_wheel[2];
+    uint8_t         cc[128];
+    uint8_t         key_pressure[128];
+};
+
+/*
+ * hexter_snapshot_t
+ *
+ * The whole restorable state of an instance, as saved by
+ * hexter_instance_save_snapshot(): what a session would otherwise restore
+ * through 'patches0' to 'patches3', 'edit_buffer', 'performance',
+ * 'polyphony', 'monophonic' and 'multitimbral', plus the current program
+ * and controller state of each part.  Every member is a byte holding a
+ * 7-bit value, so the structure has no padding, and travels as-is as the
+ * 7-in-6 encoded value of the 'snapshot' configure key.  Playing voices
+ * are not part of it; see hexter_freeze_t.
+ */
+struct _hexter_snapshot_t
+{
+    uint8_t         version;           /* HEXTER_SNAPSHOT_VERSION */
+    uint8_t         polyphony;
+    uint8_t         monophonic;        /* DSSP_MONO_MODE_* */
+    uint8_t         current_bank[3];   /* 7 bits per byte, least significant first */
+    uint8_t         current_program;
+    uint8_t         overlay;           /* 1 if the edit buffer applies to overlay_program */
+    uint8_t         overlay_program;
+    uint8_t         channel_pressure;
+    uint8_t         pitch_wheel[2];    /* + 8192, 7 bits per byte, least significant first */
+    uint8_t         performance[DX7_PERFORMANCE_SIZE];
+    uint8_t         overlay_patch[DX7_VOICE_SIZE_UNPACKED];
+    uint8_t         cc[128];
+    uint8_t         key_pressure[128];
+    uint8_t         patches[128 * DX7_VOICE_SIZE_PACKED];
+    /* version 2 */
+    uint8_t         multitimbral;      /* 1 if 'part' holds parts 2 to 16 */
+    hexter_snapshot_part_t part[HEXTER_PARTS - 1];
+};
+
+#define HEXTER_SNAPSHOT_V1_SIZE  offsetof(hexter_snapshot_t, multitimbral)
+
 /*
  * hexter_instance_t
  */
@@ -47,14 +135,16 @@ struct _hexter_instance_t
     hexter_instance_t *next;
 
     /* output */
-    LADSPA_Data    *output;
+    float          *output;
     /* input */
-    LADSPA_Data    *tuning;
-    LADSPA_Data    *volume;
+    float          *tuning;
+    float          *volume;
 
-    float           sample_rate;
+    float           host_rate;         /* frames per second, as instantiated */
+    float           sample_rate;       /* the voices' samples per second, the host rate or, with 'configure internal_rate', a fraction of it */
     float           nugget_rate;       /* nuggets per second */
-    unsigned long   nugget_remains;
+    unsigned long   nugget_frames;     /* host frames per nugget, HEXTER_NUGGET_SIZE at the host rate */
+    unsigned long   nugget_remains;    /*   and frames left in the current one */
     int32_t         ramp_duration;     /* frames per ramp for mods and volume */
     dx7_sample_t    dx7_eg_max_slew;   /* max op eg increment, in units per frame */
 
@@ -76,9 +166,26 @@ struct _hexter_instance_t
     /* patches and edit buffer */
     pthread_mutex_t patches_mutex;
     int             pending_program_change;
+    int             pending_bank_change;
 
-    dx7_patch_t    *patches;
+    hexter_bank_t  *bank;              /* shared bank holding 'patches' */
+    dx7_patch_t    *patches;           /* the bank's patches, read-only */
+    int             patches_configured; /* host has sent patches via configure() */
+    unsigned long   patch_delta_version; /* of the last 'patch_delta' applied */
+    /* The last 'patch_delta' applied is reapplied over any 'patchesN' for a
+     * section it covers that comes after it, since a host restoring a
+     * session may send its stale 'patchesN' after the delta.  The patches
+     * such a 'patchesN' held instead are kept, and take over when a later
+     * delta drops them: a UI only drops patches from its delta once it
+     * has sent their sections in full. */
+    int             patch_delta_count;
+    uint8_t         patch_delta_numbers[PATCH_DELTA_MAX];
+    uint8_t         patch_delta_patches[PATCH_DELTA_MAX * DX7_VOICE_SIZE_PACKED];
+    uint8_t         patch_delta_superseded[PATCH_DELTA_MAX];  /* true once a 'patchesN' came after, */
+    uint8_t         patch_delta_section_patches[PATCH_DELTA_MAX * DX7_VOICE_SIZE_PACKED]; /*   holding these */
+    hexter_library_t *library;         /* patch library providing banks 1 and up, or NULL */
 
+    int             current_bank;      /* 0 for 'patches', else library bank + 1 */
     int             current_program;
     uint8_t         current_patch_buffer[DX7_VOICE_SIZE_UNPACKED];  /* current unpacked patch in use */
 
@@ -115,6 +222,8 @@ struct _hexter_instance_t
     float           foot;
     float           breath;
 
+    /* LFO state, saved as one block, lfo_speed through lfo_buffer, by
+     * hexter_instance_save_snapshot() when freezing voices */
     uint8_t         lfo_speed;
     uint8_t         lfo_wave;
     uint8_t         lfo_delay;
@@ -131,13 +240,50 @@ struct _hexter_instance_t
     dx7_sample_t    lfo_increment1;
     int32_t         lfo_duration0;
     int32_t         lfo_duration1;
+    uint32_t        lfo_random;               /* sample-and-hold generator state */
     dx7_sample_t    lfo_buffer[HEXTER_NUGGET_SIZE];
 #ifdef HEXTER_DEBUG_CONTROL
     dx7_sample_t    feedback_mod;
 #endif
+
+    hexter_recorder_t *recorder;       /* session recorder, or NULL if not recording */
+    hexter_loader_t *loader;           /* default bank loader, or NULL */
+
+    /* CPU-load governor and statistics */
+    int             governor;          /* true if 'configure governor on' */
+    int             voice_limit;       /* governor's voice limit, <= max_voices while it is on */
+    unsigned long   governor_holdoff;  /* frames to wait before the governor acts again */
+    hexter_stats_t  stats;
+
+    /* global voice budget, see hexter_budget.h */
+    int             budget_slot;       /* this instance's, or -1 if it has not joined */
+
+    /* de-clicking of stolen voices */
+    int             declick;           /* true unless 'configure declick off' */
+    unsigned long   declick_frames;    /* fade-out length, in frames */
+    dx7_voice_t    *ghost[HEXTER_MAX_GHOSTS];  /* stolen voices fading out, while volume_duration is non-zero */
+
+    int             quality;           /* DX7_QUALITY_*, 'configure quality', followed by any parts */
+    float           lod_eco_level;     /* 'configure lod' level of detail thresholds, as output */
+    float           lod_carriers_level; /*   level estimates; 0 when off */
+    int             wavetable;         /* true if 'configure wavetable on' */
+    hexter_onset_cache_t *onset_cache; /* 'configure onset_cache', or NULL when off */
+
+    int             rate_divisor;      /* 'configure internal_rate': host rate / sample_rate, or 0 for auto */
+    hexter_resampler_t resampler;      /* from sample_rate to the host rate */
+
+    /* multitimbral operation: a part is an instance of its own, for its
+     * channel's program, performance parameters, controllers and LFO, but
+     * it plays the voices, and shares the patches, of its 'pool' */
+    hexter_instance_t *pool;           /* this instance, or for a part, the multitimbral instance */
+    hexter_instance_t *part[HEXTER_PARTS];  /* while multitimbral, the parts for MIDI channels 1 to 16, part[0] being this instance; else NULL */
 };
 
 /* hexter_synth.c */
+hexter_instance_t *hexter_instance_new(unsigned long sample_rate);
+void  hexter_instance_free(hexter_instance_t *instance);
+void  hexter_instance_set_sample_rate(hexter_instance_t *instance,
+                                      unsigned long sample_rate);
 void  dx7_voice_off(dx7_voice_t* voice);
 void  dx7_voice_start_voice(dx7_voice_t *voice);
 void  hexter_instance_all_voices_off(hexter_instance_t *instance);
@@ -155,15 +301,26 @@ void  hexter_instance_channel_pressure(hexter_instance_t *instance,
                                        signed int pressure);
 void  hexter_instance_pitch_bend(hexter_instance_t *instance, signed int value);
 void  hexter_instance_init_controls(hexter_instance_t *instance);
+int   hexter_instance_allocate_voices(hexter_instance_t *instance, int count);
 void  hexter_instance_set_performance_data(hexter_instance_t *instance);
 void  hexter_instance_select_program(hexter_instance_t *instance,
                                      unsigned long bank, unsigned long program);
-int   hexter_instance_set_program_descriptor(hexter_instance_t *instance,
-                                             DSSI_Program_Descriptor *pd,
-                                             unsigned long bank,
-                                             unsigned long program);
+int   hexter_instance_set_patches(hexter_instance_t *instance,
+                                  const dx7_patch_t *patches);
+void  hexter_instance_update_parts(hexter_instance_t *instance);
+int   hexter_instance_try_select_program(hexter_instance_t *instance,
+                                         unsigned long bank,
+                                         unsigned long program);
+void  hexter_instance_handle_pending_program_change(hexter_instance_t *instance);
+int   hexter_instance_patch_name(hexter_instance_t *instance,
+                                 unsigned long bank, unsigned long program,
+                                 char *name);
+char *hexter_instance_configure(hexter_instance_t *instance,
+                                const char *key, const char *value);
 char *hexter_instance_handle_patches(hexter_instance_t *instance,
                                      const char *key, const char *value);
+char *hexter_instance_handle_patch_delta(hexter_instance_t *instance,
+                                         const char *value);
 char *hexter_instance_handle_edit_buffer(hexter_instance_t *instance,
                                          const char *value);
 char *hexter_instance_handle_monophonic(hexter_instance_t *instance,
@@ -172,12 +329,48 @@ char *hexter_instance_handle_polyphony(hexter_instance_t *instance,
                                        const char *value);
 char *hexter_instance_handle_performance(hexter_instance_t *instance,
                                          const char *value);
+char *hexter_instance_handle_governor(hexter_instance_t *instance,
+                                      const char *value);
+char *hexter_instance_handle_declick(hexter_instance_t *instance,
+                                     const char *value);
+char *hexter_instance_handle_quality(hexter_instance_t *instance,
+                                     const char *value);
+char *hexter_instance_handle_lod(hexter_instance_t *instance,
+                                 const char *value);
+char *hexter_instance_handle_wavetable(hexter_instance_t *instance,
+                                       const char *value);
+char *hexter_instance_handle_onset_cache(hexter_instance_t *instance,
+                                         const char *value);
+char *hexter_instance_handle_internal_rate(hexter_instance_t *instance,
+                                           const char *value);
+char *hexter_instance_handle_library(hexter_instance_t *instance,
+                                     const char *value);
+char *hexter_instance_handle_multitimbral(hexter_instance_t *instance,
+                                          const char *value);
+char *hexter_instance_handle_global_polyphony(hexter_instance_t *instance,
+                                              const char *value);
+void  hexter_instance_reset_parts(hexter_instance_t *instance);
+hexter_freeze_t *hexter_freeze_new(void);
+void  hexter_freeze_free(hexter_freeze_t *freeze);
+void  hexter_instance_save_snapshot(hexter_instance_t *instance,
+                                    hexter_snapshot_t *snapshot,
+                                    hexter_freeze_t *freeze);
+char *hexter_instance_restore_snapshot(hexter_instance_t *instance,
+                                       const hexter_snapshot_t *snapshot,
+                                       const hexter_freeze_t *freeze);
+char *hexter_instance_handle_snapshot(hexter_instance_t *instance,
+                                      const char *value);
+void  hexter_instance_update_load(hexter_instance_t *instance,
+                                  unsigned long sample_count, double seconds);
+void  hexter_instance_get_stats(hexter_instance_t *instance,
+                                hexter_stats_t *stats);
 void  hexter_instance_render_voices(hexter_instance_t *instance,
                                     unsigned long samples_done,
                                     unsigned long sample_count,
                                     int do_control_update);
 
 /* these come right out of alsa/asoundef.h */
+#define MIDI_CTL_MSB_BANK               0x00    /**< Bank selection */
 #define MIDI_CTL_MSB_MODWHEEL           0x01    /**< Modulation */
 #define MIDI_CTL_MSB_BREATH             0x02    /**< Breath */
 #define MIDI_CTL_MSB_FOOT               0x04    /**< Foot */
@@ -190,6 +383,7 @@ void  hexter_instance_render_voices(hexter_instance_t *instance,
 #define MIDI_CTL_MSB_GENERAL_PURPOSE2   0x11    /**< General purpose 2 */
 #define MIDI_CTL_MSB_GENERAL_PURPOSE3   0x12    /**< General purpose 3 */
 #define MIDI_CTL_MSB_GENERAL_PURPOSE4   0x13    /**< General purpose 4 */
+#define MIDI_CTL_LSB_BANK               0x20    /**< Bank selection */
 #define MIDI_CTL_LSB_MODWHEEL           0x21    /**< Modulation */
 #define MIDI_CTL_LSB_BREATH             0x22    /**< Breath */
 #define MIDI_CTL_LSB_FOOT               0x24    /**< Foot */
@@ -209,4 +403,10 @@ void  hexter_instance_render_voices(hexter_instance_t *instance,
 
 #define HEXTER_INSTANCE_SUSTAINED(_s)  ((_s)->cc[MIDI_CTL_SUSTAIN] >= 64)
 
+#define HEXTER_INSTANCE_MULTITIMBRAL(_s)  ((_s)->part[0] != NULL)
+
+/* the instance or part to handle a message on MIDI channel '_ch' */
+#define HEXTER_INSTANCE_PART(_s, _ch)  \
+    (HEXTER_INSTANCE_MULTITIMBRAL(_s) ? (_s)->part[(_ch) & 0x0f] : (_s))
+
 #endif /* _HEXTER_SYNTH_H */
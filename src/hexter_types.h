@@ -31,6 +31,18 @@
 #define DX7_DUMP_SIZE_VOICE_BULK    4096+8
 
 typedef struct _hexter_instance_t hexter_instance_t;
+typedef struct _hexter_recorder_t hexter_recorder_t;
+typedef struct _hexter_stats_t    hexter_stats_t;
+typedef struct _hexter_library_t  hexter_library_t;
+typedef struct _hexter_loader_t   hexter_loader_t;
+typedef struct _hexter_bank_t     hexter_bank_t;
+typedef struct _hexter_snapshot_t hexter_snapshot_t;
+typedef struct _hexter_snapshot_part_t hexter_snapshot_part_t;
+typedef struct _hexter_freeze_t   hexter_freeze_t;
+typedef struct _hexter_resampler_t hexter_resampler_t;
+typedef struct _hexter_onset_cache_t  hexter_onset_cache_t;
+typedef struct _hexter_onset_entry_t  hexter_onset_entry_t;
+typedef struct _hexter_onset_record_t hexter_onset_record_t;
 
 typedef struct _dx7_patch_t       dx7_patch_t;
 typedef struct _dx7_voice_t       dx7_voice_t;
@@ -38,6 +50,8 @@ typedef struct _dx7_op_eg_t       dx7_op_eg_t;
 typedef struct _dx7_pitch_eg_t    dx7_pitch_eg_t;
 typedef struct _dx7_portamento_t  dx7_portamento_t;
 typedef struct _dx7_op_t          dx7_op_t;
+typedef struct _dx7_wavetable_t   dx7_wavetable_t;
+typedef struct _dx7_onset_t       dx7_onset_t;
 
 #ifndef HEXTER_USE_FLOATING_POINT
 // #warning Note: using fixed point
@@ -47,7 +61,8 @@ typedef int32_t dx7_sample_t;
 typedef float   dx7_sample_t;
 #endif /* HEXTER_USE_FLOATING_POINT */
 
-/* in hexter.c: */
+/* in hexter_synth.c: */
+int   dssp_voicelist_mutex_trylock(hexter_instance_t *instance);
 int   dssp_voicelist_mutex_lock(hexter_instance_t *instance);
 int   dssp_voicelist_mutex_unlock(hexter_instance_t *instance);
 